@@ -0,0 +1,57 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'the clock by sporniket -- ESP32/IDF firmware'.
+// ---
+// 'the clock by sporniket -- ESP32/IDF firmware' is free software: you can
+// redistribute it and/or modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+
+// 'the clock by sporniket -- ESP32/IDF firmware' is distributed in the hope
+// that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'the clock by sporniket -- ESP32/IDF firmware'. If not, see
+// <https://www.gnu.org/licenses/>. 
+#ifndef MACROS_ALLOCATION_HPP
+#define MACROS_ALLOCATION_HPP
+
+// standard includes
+#include <cstdint>
+#include <new>
+
+// esp32 includes
+#include "sdkconfig.h"
+
+// ========[ Code generator macros ]========
+// allocate a long lived object : 'ALLOCATE(Foo)(bar)' instead of
+// 'new Foo(bar)'. With CONFIG_STATIC_ALLOCATION, the object is built in a
+// storage reserved at compile time for each call site, so such a call site must
+// run only once (e.g. during the setup of the application).
+#ifdef CONFIG_STATIC_ALLOCATION
+template <typename T, int site> void *staticStorageOf() {
+  alignas(T) static uint8_t storage[sizeof(T)];
+  return storage;
+}
+#define ALLOCATE(type) new (staticStorageOf<type, __COUNTER__>()) type
+#else
+#define ALLOCATE(type) new type
+#endif
+
+// reserve the stack of a task at compile time with CONFIG_STATIC_ALLOCATION,
+// the stack is taken from the heap at the start of the task otherwise.
+#ifdef CONFIG_STATIC_ALLOCATION
+#define ALLOCATE_STACK(task, size)                                             \
+  do {                                                                         \
+    static StackType_t stack[size];                                            \
+    (task)->setStack(stack, size);                                             \
+  } while (0)
+#else
+#define ALLOCATE_STACK(task, size)                                             \
+  do {                                                                         \
+  } while (0)
+#endif
+
+#endif
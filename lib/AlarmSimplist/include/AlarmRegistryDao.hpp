@@ -0,0 +1,78 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist'.
+// ---
+// 'Alarm Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef ALARM_REGISTRY_DAO_HPP
+#define ALARM_REGISTRY_DAO_HPP
+
+// standard includes
+#include <cstdint>
+#include <ctime>
+#include <string>
+
+// esp32 includes
+
+// project includes
+#include "AlarmScheduler.hpp"
+
+/** @brief An interface to save and load the alarm rules of a scheduler.
+ */
+class AlarmRegistryDao {
+private:
+  std::string designator;
+
+public:
+  virtual ~AlarmRegistryDao();
+  /**
+   * @brief Setup the designator. The usage of the designator depends on the
+   * actual implementation. E.g. as a prefix, as a file name,...
+   *
+   * @param value the new value of the designator
+   * @return AlarmRegistryDao* the dao, to be able to fluently chain with a load
+   * or save, or to instanciate and setup.
+   */
+  AlarmRegistryDao *withDesignator(std::string value) {
+    designator = value;
+    return this;
+  }
+
+  /**
+   * @brief Get the Designator.
+   *
+   * @return std::string* the current designator.
+   */
+  std::string *getDesignator() { return &designator; }
+
+  /**
+   * @brief Load the rules and put them into the provided scheduler.
+   *
+   * @param recipient the scheduler to update.
+   * @param now the current time, to schedule the rules.
+   *
+   * @return true when all went well.
+   */
+  virtual bool loadInto(AlarmScheduler *recipient, time_t now) = 0;
+
+  /**
+   * @brief Extract the rules of the provided scheduler and save them.
+   *
+   * @param source
+   *
+   * @return true when all went well.
+   */
+  virtual bool saveFrom(AlarmScheduler *const source) = 0;
+};
+
+#endif
@@ -0,0 +1,144 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist'.
+// ---
+// 'Alarm Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef ALARM_RULE_HPP
+#define ALARM_RULE_HPP
+
+// standard includes
+#include <cstdint>
+#include <ctime>
+
+// esp32 includes
+
+// project includes
+#include "AlarmSimplistTypes.hpp"
+#include "CivilDate.hpp"
+#include "HolidayCalendar.hpp"
+
+/** @brief When an alarm fires : at a time of the day, on some days of the week,
+ * or once at a given date.
+ *
+ * The fire times are computed from the civil time of the local time zone, so
+ * that an alarm set at 7:00 still fires at 7:00 after a change of daylight
+ * saving time. When the time does not exist (spring forward), the alarm fires
+ * at the same time after the change (e.g. 2:30 becomes 3:30) ; when the time
+ * happens twice (fall back), the alarm fires once.
+ */
+class AlarmRule {
+private:
+  uint16_t minuteOfDay = 0;
+  uint8_t weekdays = 0;
+  bool enabled = false;
+  bool skipHolidays = false;
+  uint8_t snoozeMinutes = ALARM_DEFAULT_SNOOZE_MINUTES;
+  uint16_t date = ALARM_NO_DATE;
+
+  /**
+   * @brief Get the fire time on the date part of the given broken down time.
+   *
+   * @param day the broken down time to update and normalize.
+   * @return time_t the fire time.
+   */
+  time_t fireTimeOn(struct tm *day);
+
+public:
+  virtual ~AlarmRule();
+
+  /**
+   * @brief Setup a recurring alarm.
+   *
+   * @param hour the hour, from 0 to 23.
+   * @param minute the minute, from 0 to 59.
+   * @param days bitmask of `AlarmWeekday`.
+   * @return AlarmRule* the rule, enabled.
+   */
+  AlarmRule *recurring(uint8_t hour, uint8_t minute, uint8_t days) {
+    minuteOfDay = (hour % 24) * 60 + minute % 60;
+    weekdays = days & ALARM_EVERY_DAY;
+    date = ALARM_NO_DATE;
+    enabled = true;
+    return this;
+  }
+
+  /**
+   * @brief Setup a one shot alarm, that is disabled once fired.
+   *
+   * @param year the year, from 2000.
+   * @param month the month, from 1 to 12.
+   * @param day the day of the month, from 1 to 31.
+   * @param hour the hour, from 0 to 23.
+   * @param minute the minute, from 0 to 59.
+   * @return AlarmRule* the rule, enabled.
+   */
+  AlarmRule *oneShot(int year, int month, int day, uint8_t hour,
+                     uint8_t minute) {
+    minuteOfDay = (hour % 24) * 60 + minute % 60;
+    weekdays = 0;
+    date = (uint16_t)CivilDate::toDayNumber(year, month, day);
+    enabled = true;
+    return this;
+  }
+
+  AlarmRule *withSkipHolidays(bool value) {
+    skipHolidays = value;
+    return this;
+  }
+
+  AlarmRule *withSnoozeMinutes(uint8_t value) {
+    snoozeMinutes =
+        value > ALARM_MAX_SNOOZE_MINUTES ? ALARM_MAX_SNOOZE_MINUTES : value;
+    return this;
+  }
+
+  AlarmRule *withEnabled(bool value) {
+    enabled = value;
+    return this;
+  }
+
+  uint8_t getHour() { return minuteOfDay / 60; }
+  uint8_t getMinute() { return minuteOfDay % 60; }
+  uint8_t getWeekdays() { return weekdays; }
+  bool isEnabled() { return enabled; }
+  bool isSkipHolidays() { return skipHolidays; }
+  uint8_t getSnoozeMinutes() { return snoozeMinutes; }
+  bool isOneShot() { return ALARM_NO_DATE != date; }
+
+  /**
+   * @brief Get the first fire time strictly after the given time.
+   *
+   * @param after the time to start from.
+   * @param holidays the holidays to skip when required, may be null.
+   * @return time_t the fire time, or `ALARM_NEVER`.
+   */
+  time_t getNextFireTime(time_t after, HolidayCalendar *holidays);
+
+  /**
+   * @brief Convert to the storage format.
+   *
+   * @param record the record to fill.
+   */
+  void pack(AlarmRuleRecord *record);
+
+  /**
+   * @brief Setup from the storage format.
+   *
+   * @param record the record to read.
+   * @return AlarmRule* the rule.
+   */
+  AlarmRule *unpack(const AlarmRuleRecord *record);
+};
+
+#endif
@@ -0,0 +1,164 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist'.
+// ---
+// 'Alarm Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef ALARM_SCHEDULER_HPP
+#define ALARM_SCHEDULER_HPP
+
+// standard includes
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+// esp32 includes
+
+// project includes
+#include "AlarmListener.hpp"
+#include "AlarmRule.hpp"
+#include "AlarmSimplistTypes.hpp"
+#include "HolidayCalendar.hpp"
+
+/**
+ * @brief Entry of the schedule : the next fire time of an alarm, or the end of
+ * a snooze.
+ */
+typedef struct {
+  time_t fireAt;
+  uint8_t index;
+  //**@brief The entry is obsolete when the alarm has changed since.
+  uint8_t generation;
+  bool snoozed;
+} AlarmScheduleEntry;
+
+/** @brief The alarms and their schedule, as a min-heap of fire times.
+ *
+ * The next fire time is at the top of the heap, changing an alarm or firing it
+ * costs O(log n). Changed alarms leave obsolete entries in the heap, they are
+ * discarded when reaching the top.
+ *
+ * The scheduler does not wait by itself, the caller sleeps until
+ * `getNextFireTime()` then calls `fireDue()`. It is not thread safe.
+ */
+class AlarmScheduler {
+private:
+  AlarmRule rules[ALARM_MAX_COUNT];
+  uint8_t generations[ALARM_MAX_COUNT];
+  std::vector<AlarmScheduleEntry> heap;
+  HolidayCalendar *holidays = nullptr;
+  AlarmListener *listener = nullptr;
+  /**
+   * @brief When a one shot alarm has been disabled, the rules should be saved.
+   */
+  bool dirty = false;
+
+  static bool isLater(const AlarmScheduleEntry &left,
+                      const AlarmScheduleEntry &right) {
+    return left.fireAt > right.fireAt;
+  }
+  bool isObsolete(const AlarmScheduleEntry *entry) {
+    return entry->generation != generations[entry->index];
+  }
+  void push(time_t fireAt, uint8_t index, bool snoozed);
+  /**
+   * @brief Remove the obsolete entries from the top of the heap.
+   */
+  void dropObsolete();
+  /**
+   * @brief Obsolete all the pending entries of an alarm and schedule its next
+   * fire time.
+   */
+  void renew(uint8_t index, time_t now);
+
+public:
+  AlarmScheduler();
+  virtual ~AlarmScheduler();
+
+  AlarmScheduler *withHolidayCalendar(HolidayCalendar *value) {
+    holidays = value;
+    return this;
+  }
+
+  AlarmScheduler *withListener(AlarmListener *value) {
+    listener = value;
+    return this;
+  }
+
+  uint8_t getCapacity() { return ALARM_MAX_COUNT; }
+
+  /**
+   * @brief Access to a rule, to read it. Use `setRule` to change it.
+   */
+  AlarmRule *getRule(uint8_t index) {
+    return index < ALARM_MAX_COUNT ? &rules[index] : nullptr;
+  }
+
+  /**
+   * @brief Replace an alarm rule and schedule it.
+   *
+   * @param index the index of the alarm.
+   * @param rule the new rule.
+   * @param now the current time.
+   * @return true when the index is valid.
+   */
+  bool setRule(uint8_t index, const AlarmRule *rule, time_t now);
+
+  /**
+   * @brief Schedule all the alarms again, e.g. after a change of time zone, or
+   * when the time has been set. Pending snoozes are kept.
+   *
+   * @param now the current time.
+   */
+  void reschedule(time_t now);
+
+  /**
+   * @brief Get the time of the next alarm.
+   *
+   * @return time_t the fire time, or `ALARM_NEVER`.
+   */
+  time_t getNextFireTime();
+
+  /**
+   * @brief Notify all the alarms that are due, and schedule them again.
+   *
+   * @param now the current time.
+   * @return uint8_t the number of notified alarms.
+   */
+  uint8_t fireDue(time_t now);
+
+  /**
+   * @brief Ring the alarm again after its snooze duration.
+   *
+   * @param index the index of the alarm.
+   * @param now the current time.
+   * @return true when the index is valid.
+   */
+  bool snooze(uint8_t index, time_t now);
+
+  /**
+   * @brief Cancel the pending snooze of an alarm.
+   *
+   * @param index the index of the alarm.
+   * @param now the current time.
+   * @return true when the index is valid.
+   */
+  bool dismiss(uint8_t index, time_t now);
+
+  bool isDirty() { return dirty; }
+  void clearDirty() { dirty = false; }
+  size_t getScheduleSize() { return heap.size(); }
+};
+
+#endif
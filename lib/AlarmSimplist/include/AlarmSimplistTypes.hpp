@@ -0,0 +1,71 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist'.
+// ---
+// 'Alarm Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef ALARM_SIMPLIST_TYPES_HPP
+#define ALARM_SIMPLIST_TYPES_HPP
+
+// standard includes
+#include <cstdint>
+#include <ctime>
+
+// esp32 includes
+
+// project includes
+
+//**@brief Maximum number of alarms.
+const uint8_t ALARM_MAX_COUNT = 32;
+
+//**@brief Fire time of an alarm that will not fire anymore.
+const time_t ALARM_NEVER = (time_t)-1;
+
+//**@brief Default duration of a snooze.
+const uint8_t ALARM_DEFAULT_SNOOZE_MINUTES = 9;
+
+//**@brief Maximum duration of a snooze (6 bits).
+const uint8_t ALARM_MAX_SNOOZE_MINUTES = 63;
+
+//**@brief Day number of an alarm that is not a one shot alarm.
+const uint16_t ALARM_NO_DATE = 0xffff;
+
+/**
+ * @brief Days of the week, as a bitmask of the `tm_wday` of `struct tm`.
+ */
+enum AlarmWeekday {
+  ALARM_SUNDAY = 1 << 0,
+  ALARM_MONDAY = 1 << 1,
+  ALARM_TUESDAY = 1 << 2,
+  ALARM_WEDNESDAY = 1 << 3,
+  ALARM_THURSDAY = 1 << 4,
+  ALARM_FRIDAY = 1 << 5,
+  ALARM_SATURDAY = 1 << 6,
+  ALARM_WORKING_DAYS = ALARM_MONDAY | ALARM_TUESDAY | ALARM_WEDNESDAY |
+                       ALARM_THURSDAY | ALARM_FRIDAY,
+  ALARM_WEEKEND = ALARM_SATURDAY | ALARM_SUNDAY,
+  ALARM_EVERY_DAY = ALARM_WORKING_DAYS | ALARM_WEEKEND
+};
+
+/**
+ * @brief Storage format of an alarm rule (8 bytes).
+ */
+typedef struct {
+  //**@brief bits 0-10 : minute of the day ; bits 11-17 : weekdays ; bit 18 :
+  // enabled ; bit 19 : skip holidays ; bits 20-25 : snooze minutes.
+  uint32_t rule;
+  //**@brief Day of a one shot alarm, counted from 2000-01-01.
+  uint16_t date;
+} AlarmRuleRecord;
+
+#endif
@@ -0,0 +1,65 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist'.
+// ---
+// 'Alarm Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef CIVIL_DATE_HPP
+#define CIVIL_DATE_HPP
+
+// standard includes
+#include <cstdint>
+#include <ctime>
+
+// esp32 includes
+
+// project includes
+
+/** @brief Conversions between the civil dates and compact day numbers,
+ * counted from 2000-01-01.
+ *
+ * The computations do not depend on the time zone.
+ */
+class CivilDate {
+public:
+  /**
+   * @brief Get the day number of a date.
+   *
+   * @param year the year, e.g. 2023.
+   * @param month the month, from 1 to 12.
+   * @param day the day of the month, from 1 to 31.
+   * @return int32_t the number of days since 2000-01-01.
+   */
+  static int32_t toDayNumber(int year, int month, int day);
+
+  /**
+   * @brief Get the day number of the date part of a broken down time.
+   *
+   * @param date the (normalized) broken down time.
+   * @return int32_t the number of days since 2000-01-01.
+   */
+  static int32_t toDayNumber(const struct tm *date) {
+    return toDayNumber(date->tm_year + 1900, date->tm_mon + 1, date->tm_mday);
+  }
+
+  /**
+   * @brief Set the date part of a broken down time, the other fields are not
+   * changed.
+   *
+   * @param dayNumber the number of days since 2000-01-01.
+   * @param date the broken down time to update.
+   */
+  static void fromDayNumber(int32_t dayNumber, struct tm *date);
+};
+
+#endif
@@ -0,0 +1,97 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist'.
+// ---
+// 'Alarm Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef HOLIDAY_CALENDAR_HPP
+#define HOLIDAY_CALENDAR_HPP
+
+// standard includes
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+// esp32 includes
+
+// project includes
+#include "CivilDate.hpp"
+
+/** @brief The days when the alarms marked to skip holidays do not fire.
+ *
+ * There are yearly holidays (e.g. new year's day) and holidays at a given date
+ * (e.g. easter monday, or a leave). Lookups are binary searches.
+ */
+class HolidayCalendar {
+private:
+  /**
+   * @brief Sorted day numbers.
+   */
+  std::vector<int32_t> dates;
+  /**
+   * @brief Sorted `month * 32 + day`.
+   */
+  std::vector<uint16_t> yearly;
+
+  template <typename T> static void insertSorted(std::vector<T> *into, T value) {
+    typename std::vector<T>::iterator position =
+        std::lower_bound(into->begin(), into->end(), value);
+    if (position == into->end() || *position != value) {
+      into->insert(position, value);
+    }
+  }
+
+public:
+  virtual ~HolidayCalendar();
+
+  /**
+   * @brief Add a holiday happening once.
+   *
+   * @param year the year, e.g. 2023.
+   * @param month the month, from 1 to 12.
+   * @param day the day of the month, from 1 to 31.
+   * @return HolidayCalendar* the calendar, to chain the additions.
+   */
+  HolidayCalendar *withDate(int year, int month, int day) {
+    insertSorted(&dates, CivilDate::toDayNumber(year, month, day));
+    return this;
+  }
+
+  /**
+   * @brief Add a holiday happening every year.
+   *
+   * @param month the month, from 1 to 12.
+   * @param day the day of the month, from 1 to 31.
+   * @return HolidayCalendar* the calendar, to chain the additions.
+   */
+  HolidayCalendar *withYearly(int month, int day) {
+    insertSorted(&yearly, (uint16_t)(month * 32 + day));
+    return this;
+  }
+
+  void clear() {
+    dates.clear();
+    yearly.clear();
+  }
+
+  /**
+   * @brief Tells whether the date part of a broken down time is a holiday.
+   *
+   * @param date the (normalized) broken down time.
+   * @return true when it is a holiday.
+   */
+  bool isHoliday(const struct tm *date);
+};
+
+#endif
@@ -0,0 +1,96 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist'.
+// ---
+// 'Alarm Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "AlarmRule.hpp"
+
+AlarmRule::~AlarmRule() {}
+// write code here...
+
+//**@brief Maximum number of days to look at, e.g. when skipping holidays.
+static const int32_t SEARCH_DAYS = 372;
+
+static const uint8_t SHIFT_WEEKDAYS = 11;
+static const uint8_t SHIFT_ENABLED = 18;
+static const uint8_t SHIFT_SKIP_HOLIDAYS = 19;
+static const uint8_t SHIFT_SNOOZE = 20;
+
+time_t AlarmRule::fireTimeOn(struct tm *day) {
+  day->tm_hour = minuteOfDay / 60;
+  day->tm_min = minuteOfDay % 60;
+  day->tm_sec = 0;
+  day->tm_isdst = -1; // let the time zone rules decide
+  return mktime(day);
+}
+
+time_t AlarmRule::getNextFireTime(time_t after, HolidayCalendar *holidays) {
+  if (!enabled) {
+    return ALARM_NEVER;
+  }
+  struct tm start;
+  localtime_r(&after, &start);
+  int32_t today = CivilDate::toDayNumber(&start);
+  // Today only when the time of the alarm has not been reached, so that a time
+  // happening twice fires once.
+  int32_t firstDay =
+      start.tm_hour * 60 + start.tm_min < minuteOfDay ? today : today + 1;
+
+  if (isOneShot()) {
+    if (date < firstDay) {
+      return ALARM_NEVER;
+    }
+    struct tm day = start;
+    CivilDate::fromDayNumber(date, &day);
+    return fireTimeOn(&day);
+  }
+
+  if (0 == weekdays) {
+    return ALARM_NEVER;
+  }
+  for (int32_t dayNumber = firstDay; dayNumber <= today + SEARCH_DAYS;
+       dayNumber++) {
+    struct tm day = start;
+    CivilDate::fromDayNumber(dayNumber, &day);
+    time_t fireAt = fireTimeOn(&day); // also computes tm_wday
+    if (0 == (weekdays & (1 << day.tm_wday)) || fireAt <= after) {
+      continue;
+    }
+    if (skipHolidays && nullptr != holidays && holidays->isHoliday(&day)) {
+      continue;
+    }
+    return fireAt;
+  }
+  return ALARM_NEVER;
+}
+
+void AlarmRule::pack(AlarmRuleRecord *record) {
+  record->rule = (uint32_t)minuteOfDay | (uint32_t)weekdays << SHIFT_WEEKDAYS |
+                 (uint32_t)enabled << SHIFT_ENABLED |
+                 (uint32_t)skipHolidays << SHIFT_SKIP_HOLIDAYS |
+                 (uint32_t)snoozeMinutes << SHIFT_SNOOZE;
+  record->date = date;
+}
+
+AlarmRule *AlarmRule::unpack(const AlarmRuleRecord *record) {
+  minuteOfDay = (record->rule & 0x7ff) % (24 * 60);
+  weekdays = (record->rule >> SHIFT_WEEKDAYS) & ALARM_EVERY_DAY;
+  enabled = (record->rule >> SHIFT_ENABLED) & 1;
+  skipHolidays = (record->rule >> SHIFT_SKIP_HOLIDAYS) & 1;
+  snoozeMinutes = (record->rule >> SHIFT_SNOOZE) & ALARM_MAX_SNOOZE_MINUTES;
+  date = record->date;
+  return this;
+}
@@ -0,0 +1,131 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist'.
+// ---
+// 'Alarm Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "AlarmScheduler.hpp"
+
+AlarmScheduler::~AlarmScheduler() {}
+// write code here...
+
+AlarmScheduler::AlarmScheduler() {
+  for (uint8_t i = 0; i < ALARM_MAX_COUNT; i++) {
+    generations[i] = 0;
+  }
+  heap.reserve(ALARM_MAX_COUNT * 2);
+}
+
+void AlarmScheduler::push(time_t fireAt, uint8_t index, bool snoozed) {
+  if (ALARM_NEVER == fireAt) {
+    return;
+  }
+  if (heap.size() >= ALARM_MAX_COUNT * 4) {
+    // too many obsolete entries, compact
+    heap.erase(std::remove_if(heap.begin(), heap.end(),
+                              [this](const AlarmScheduleEntry &entry) {
+                                return isObsolete(&entry);
+                              }),
+               heap.end());
+    std::make_heap(heap.begin(), heap.end(), isLater);
+  }
+  heap.push_back({.fireAt = fireAt,
+                  .index = index,
+                  .generation = generations[index],
+                  .snoozed = snoozed});
+  std::push_heap(heap.begin(), heap.end(), isLater);
+}
+
+void AlarmScheduler::dropObsolete() {
+  while (!heap.empty() && isObsolete(&heap.front())) {
+    std::pop_heap(heap.begin(), heap.end(), isLater);
+    heap.pop_back();
+  }
+}
+
+void AlarmScheduler::renew(uint8_t index, time_t now) {
+  ++generations[index];
+  push(rules[index].getNextFireTime(now, holidays), index, false);
+}
+
+bool AlarmScheduler::setRule(uint8_t index, const AlarmRule *rule,
+                             time_t now) {
+  if (index >= ALARM_MAX_COUNT) {
+    return false;
+  }
+  rules[index] = *rule;
+  renew(index, now);
+  return true;
+}
+
+void AlarmScheduler::reschedule(time_t now) {
+  // keep the snoozes, they are relative to the time they started.
+  heap.erase(std::remove_if(heap.begin(), heap.end(),
+                            [this](const AlarmScheduleEntry &entry) {
+                              return !entry.snoozed || isObsolete(&entry);
+                            }),
+             heap.end());
+  std::make_heap(heap.begin(), heap.end(), isLater);
+  for (uint8_t i = 0; i < ALARM_MAX_COUNT; i++) {
+    push(rules[i].getNextFireTime(now, holidays), i, false);
+  }
+}
+
+time_t AlarmScheduler::getNextFireTime() {
+  dropObsolete();
+  return heap.empty() ? ALARM_NEVER : heap.front().fireAt;
+}
+
+uint8_t AlarmScheduler::fireDue(time_t now) {
+  uint8_t count = 0;
+  while (ALARM_NEVER != getNextFireTime() && heap.front().fireAt <= now) {
+    AlarmScheduleEntry entry = heap.front();
+    std::pop_heap(heap.begin(), heap.end(), isLater);
+    heap.pop_back();
+    AlarmRule *rule = &rules[entry.index];
+    if (!entry.snoozed) {
+      if (rule->isOneShot()) {
+        rule->withEnabled(false);
+        dirty = true;
+      } else {
+        // from now, in case the alarms have been missed for a while.
+        push(rule->getNextFireTime(now > entry.fireAt ? now : entry.fireAt,
+                                   holidays),
+             entry.index, false);
+      }
+    }
+    ++count;
+    if (nullptr != listener) {
+      listener->onAlarm(entry.index, rule, entry.snoozed);
+    }
+  }
+  return count;
+}
+
+bool AlarmScheduler::snooze(uint8_t index, time_t now) {
+  if (index >= ALARM_MAX_COUNT) {
+    return false;
+  }
+  push(now + rules[index].getSnoozeMinutes() * 60, index, true);
+  return true;
+}
+
+bool AlarmScheduler::dismiss(uint8_t index, time_t now) {
+  if (index >= ALARM_MAX_COUNT) {
+    return false;
+  }
+  renew(index, now);
+  return true;
+}
@@ -0,0 +1,48 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist'.
+// ---
+// 'Alarm Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "CivilDate.hpp"
+
+// write code here...
+
+// see http://howardhinnant.github.io/date_algorithms.html
+static const int32_t DAYS_FROM_0000_TO_2000 = 730425;
+
+int32_t CivilDate::toDayNumber(int year, int month, int day) {
+  year -= month <= 2;
+  int32_t era = (year >= 0 ? year : year - 399) / 400;
+  int32_t yearOfEra = year - era * 400;
+  int32_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int32_t dayOfEra =
+      yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - DAYS_FROM_0000_TO_2000;
+}
+
+void CivilDate::fromDayNumber(int32_t dayNumber, struct tm *date) {
+  int32_t days = dayNumber + DAYS_FROM_0000_TO_2000;
+  int32_t era = (days >= 0 ? days : days - 146096) / 146097;
+  int32_t dayOfEra = days - era * 146097;
+  int32_t yearOfEra =
+      (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  int32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  int32_t monthIndex = (5 * dayOfYear + 2) / 153;
+  int32_t month = monthIndex + (monthIndex < 10 ? 3 : -9);
+  date->tm_mday = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+  date->tm_mon = month - 1;
+  date->tm_year = yearOfEra + era * 400 + (month <= 2) - 1900;
+}
@@ -0,0 +1,30 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist'.
+// ---
+// 'Alarm Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "HolidayCalendar.hpp"
+
+HolidayCalendar::~HolidayCalendar() {}
+// write code here...
+
+bool HolidayCalendar::isHoliday(const struct tm *date) {
+  return std::binary_search(yearly.begin(), yearly.end(),
+                            (uint16_t)((date->tm_mon + 1) * 32 +
+                                       date->tm_mday)) ||
+         std::binary_search(dates.begin(), dates.end(),
+                            CivilDate::toDayNumber(date));
+}
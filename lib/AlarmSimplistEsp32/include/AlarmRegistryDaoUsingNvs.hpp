@@ -0,0 +1,63 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist for ESP32'.
+// ---
+// 'Alarm Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef ALARM_REGISTRY_DAO_USING_NVS_HPP
+#define ALARM_REGISTRY_DAO_USING_NVS_HPP
+
+// standard includes
+#include <cstdint>
+#include <memory>
+
+// esp32 includes
+#include <esp_log.h>
+#include <nvs.h>
+#include <nvs_flash.h>
+#include <nvs_handle.hpp>
+
+// project includes
+#include "AlarmSimplist.hpp"
+
+/** @brief Dao for the alarm rules, that use the non volatile storage.
+ *
+ * The designator is used as namespace. All the rules are stored as a single
+ * blob of `AlarmRuleRecord` (8 bytes per alarm). The NVS **MUST** have been
+ * initialized beforehand.
+ */
+class AlarmRegistryDaoUsingNvs : public AlarmRegistryDao {
+public:
+  virtual ~AlarmRegistryDaoUsingNvs();
+
+  /**
+   * @brief Load the rules and put them into the provided scheduler.
+   *
+   * @param recipient the scheduler to update.
+   * @param now the current time, to schedule the rules.
+   *
+   * @return true when all went well.
+   */
+  virtual bool loadInto(AlarmScheduler *recipient, time_t now);
+
+  /**
+   * @brief Extract the rules of the provided scheduler and save them.
+   *
+   * @param source
+   *
+   * @return true when all went well.
+   */
+  virtual bool saveFrom(AlarmScheduler *const source);
+};
+
+#endif
@@ -0,0 +1,91 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist for ESP32'.
+// ---
+// 'Alarm Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef ALARM_TASK_ESP32_HPP
+#define ALARM_TASK_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+#include <ctime>
+
+// esp32 includes
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// project includes
+#include "AlarmSimplist.hpp"
+#include "StaticTaskEsp32.hpp"
+
+/** @brief Run the alarm scheduler : sleep until the next alarm, fire it, and
+ * save the rules when needed.
+ *
+ * The task does not poll, it is woken up by the changes made through its
+ * methods. As the system time may be set meanwhile (e.g. by SNTP) without the
+ * task knowing, the sleep does not last more than `MAX_SLEEP_SECONDS`, and a
+ * wake up too far from the expected time is handled as a change of time : the
+ * alarms are rescheduled instead of fired. Use `onTimeChanged()` to reschedule
+ * at once.
+ *
+ * The listener of the scheduler is called from this task.
+ */
+class AlarmTaskEsp32 : public StaticTaskEsp32 {
+private:
+  static const time_t MAX_SLEEP_SECONDS = 3600;
+  static const time_t MAX_LATENESS_SECONDS = 60;
+  AlarmScheduler *scheduler;
+  AlarmRegistryDao *dao;
+  SemaphoreHandle_t lock;
+  SemaphoreHandle_t wakeUp;
+  volatile bool timeChanged = true;
+
+  void saveIfDirty();
+
+public:
+  /**
+   * @brief Setup the task.
+   *
+   * @param scheduler the scheduler, with its listener and holidays.
+   * @param dao the dao to load and save the rules, may be null.
+   */
+  AlarmTaskEsp32(AlarmScheduler *scheduler, AlarmRegistryDao *dao);
+  virtual ~AlarmTaskEsp32();
+
+  void run(void *data);
+
+  /**
+   * @brief Replace an alarm rule, save it and schedule it.
+   */
+  bool setRule(uint8_t index, const AlarmRule *rule);
+
+  /**
+   * @brief Ring the alarm again after its snooze duration.
+   */
+  bool snooze(uint8_t index);
+
+  /**
+   * @brief Cancel the pending snooze of an alarm.
+   */
+  bool dismiss(uint8_t index);
+
+  /**
+   * @brief The system time or the time zone has changed, schedule all the
+   * alarms again.
+   */
+  void onTimeChanged();
+};
+
+#endif
@@ -0,0 +1,80 @@
+
+// header include
+#include "AlarmRegistryDaoUsingNvs.hpp"
+
+AlarmRegistryDaoUsingNvs::~AlarmRegistryDaoUsingNvs() {}
+// write code here...
+
+static const char *TAG_LOAD = "AlarmRegistryDaoUsingNvs::loadInto";
+static const char *TAG_SAVE = "AlarmRegistryDaoUsingNvs::saveFrom";
+
+static const char *KEY_RULES = "rules";
+
+bool AlarmRegistryDaoUsingNvs::loadInto(AlarmScheduler *recipient,
+                                        time_t now) {
+  esp_err_t err;
+  std::unique_ptr<nvs::NVSHandle> handle =
+      nvs::open_nvs_handle(getDesignator()->c_str(), NVS_READWRITE, &err);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG_LOAD, "Error (%s) opening NVS handle!", esp_err_to_name(err));
+    return false;
+  }
+
+  size_t size = 0;
+  err = handle->get_item_size(nvs::ItemType::BLOB, KEY_RULES, size);
+  if (err == ESP_ERR_NVS_NOT_FOUND) {
+    // nothing to read, done
+    return true;
+  }
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG_LOAD, "Error (%s) reading '%s.%s' !", esp_err_to_name(err),
+             getDesignator()->c_str(), KEY_RULES);
+    return false;
+  }
+
+  // a smaller blob comes from a build with less alarms, load what is there.
+  AlarmRuleRecord records[ALARM_MAX_COUNT];
+  if (size > sizeof(records)) {
+    size = sizeof(records);
+  }
+  err = handle->get_blob(KEY_RULES, records, size);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG_LOAD, "Error (%s) reading '%s.%s' !", esp_err_to_name(err),
+             getDesignator()->c_str(), KEY_RULES);
+    return false;
+  }
+  AlarmRule rule;
+  for (uint8_t i = 0; i < size / sizeof(AlarmRuleRecord); i++) {
+    recipient->setRule(i, rule.unpack(&records[i]), now);
+  }
+  return true;
+}
+
+bool AlarmRegistryDaoUsingNvs::saveFrom(AlarmScheduler *const source) {
+  esp_err_t err;
+  std::unique_ptr<nvs::NVSHandle> handle =
+      nvs::open_nvs_handle(getDesignator()->c_str(), NVS_READWRITE, &err);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG_SAVE, "Error (%s) opening NVS handle!", esp_err_to_name(err));
+    return false;
+  }
+
+  AlarmRuleRecord records[ALARM_MAX_COUNT];
+  for (uint8_t i = 0; i < ALARM_MAX_COUNT; i++) {
+    source->getRule(i)->pack(&records[i]);
+  }
+  ESP_LOGI(TAG_SAVE, "Writing key %s...", KEY_RULES);
+  err = handle->set_blob(KEY_RULES, records, sizeof(records));
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG_SAVE, "Error (%s) writing '%s.%s'!", esp_err_to_name(err),
+             getDesignator()->c_str(), KEY_RULES);
+    return false;
+  }
+  err = handle->commit();
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG_SAVE, "Error (%s) commiting '%s.%s'!", esp_err_to_name(err),
+             getDesignator()->c_str(), KEY_RULES);
+    return false;
+  }
+  return true;
+}
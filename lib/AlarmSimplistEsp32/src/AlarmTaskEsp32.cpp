@@ -0,0 +1,92 @@
+
+// header include
+#include "AlarmTaskEsp32.hpp"
+
+static constexpr char *TAG = (char *)"AlarmTaskEsp32";
+
+AlarmTaskEsp32::~AlarmTaskEsp32() {}
+// write code here...
+
+AlarmTaskEsp32::AlarmTaskEsp32(AlarmScheduler *scheduler,
+                               AlarmRegistryDao *dao)
+    : StaticTaskEsp32("alarms"), scheduler(scheduler), dao(dao) {
+  lock = xSemaphoreCreateMutex();
+  wakeUp = xSemaphoreCreateBinary();
+  if (nullptr != dao && !dao->loadInto(scheduler, time(NULL))) {
+    ESP_LOGW(TAG, "Could not load the alarms.");
+  }
+}
+
+void AlarmTaskEsp32::saveIfDirty() {
+  if (nullptr != dao && scheduler->isDirty()) {
+    if (dao->saveFrom(scheduler)) {
+      scheduler->clearDirty();
+    }
+  }
+}
+
+void AlarmTaskEsp32::run(void *data) {
+  time_t wokenUpAt = time(NULL);
+  time_t sleep = 0;
+  while (true) {
+    countWakeUp();
+    time_t now = time(NULL);
+    // a jump of the system time (e.g. the first synchronization) must not
+    // fire all the alarms in between.
+    if (now < wokenUpAt || now > wokenUpAt + sleep + MAX_LATENESS_SECONDS) {
+      ESP_LOGI(TAG, "The time has jumped, rescheduling.");
+      timeChanged = true;
+    }
+    wokenUpAt = now;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (timeChanged) {
+      timeChanged = false;
+      scheduler->reschedule(now);
+    }
+    uint8_t fired = scheduler->fireDue(now);
+    saveIfDirty();
+    time_t next = scheduler->getNextFireTime();
+    xSemaphoreGive(lock);
+    if (fired > 0) {
+      ESP_LOGI(TAG, "Fired %d alarm(s).", fired);
+    }
+
+    sleep = ALARM_NEVER == next ? MAX_SLEEP_SECONDS : next - now;
+    if (sleep > MAX_SLEEP_SECONDS) {
+      sleep = MAX_SLEEP_SECONDS;
+    }
+    xSemaphoreTake(wakeUp, pdMS_TO_TICKS(sleep * 1000));
+  }
+}
+
+bool AlarmTaskEsp32::setRule(uint8_t index, const AlarmRule *rule) {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  bool result = scheduler->setRule(index, rule, time(NULL));
+  if (result && nullptr != dao) {
+    dao->saveFrom(scheduler);
+  }
+  xSemaphoreGive(lock);
+  xSemaphoreGive(wakeUp);
+  return result;
+}
+
+bool AlarmTaskEsp32::snooze(uint8_t index) {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  bool result = scheduler->snooze(index, time(NULL));
+  xSemaphoreGive(lock);
+  xSemaphoreGive(wakeUp);
+  return result;
+}
+
+bool AlarmTaskEsp32::dismiss(uint8_t index) {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  bool result = scheduler->dismiss(index, time(NULL));
+  xSemaphoreGive(lock);
+  xSemaphoreGive(wakeUp);
+  return result;
+}
+
+void AlarmTaskEsp32::onTimeChanged() {
+  timeChanged = true;
+  xSemaphoreGive(wakeUp);
+}
@@ -0,0 +1,93 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Boot Simplist'.
+// ---
+// 'Boot Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Boot Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Boot Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef BOOT_PROFILER_HPP
+#define BOOT_PROFILER_HPP
+
+// standard includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "BootSimplistTypes.hpp"
+
+/** @brief Timestamp the stages of the boot, to find the ones that dominate.
+ *
+ * A stage is marked when it is done, from any task (e.g. from an event
+ * handler when the network is up) ; only the first mark of a stage is kept,
+ * so that a stage repeated later (e.g. a reconnection) does not blur the
+ * profile. The timestamps come from the clock given at creation (on the
+ * device, `esp_timer_get_time`, i.e. the time since the reset).
+ */
+class BootProfiler {
+private:
+  struct Slot {
+    BootStage stage;
+    std::atomic<bool> ready{false};
+  };
+  Slot slots[BOOT_PROFILER_MAX_STAGES];
+  std::atomic<uint8_t> claimed{0};
+  int64_t (*clock)();
+
+public:
+  /**
+   * @brief Setup the profiler.
+   *
+   * @param clock the source of timestamps, in microseconds.
+   */
+  BootProfiler(int64_t (*clock)()) : clock(clock) {}
+  virtual ~BootProfiler();
+
+  /**
+   * @brief Mark the end of a stage, now.
+   *
+   * @param name the name of the stage, kept as is.
+   * @return true when the stage has been recorded, false when it was already
+   * marked or when there are too many stages.
+   */
+  bool mark(const char *name);
+
+  /**
+   * @brief Tell whether a stage has been marked.
+   *
+   * @param name the name of the stage.
+   * @param at where to copy the time of the stage, if not null.
+   */
+  bool isMarked(const char *name, int64_t *at = nullptr);
+
+  /**
+   * @brief The number of stages recorded, in the order of marking.
+   */
+  uint8_t getStageCount();
+
+  const BootStage *getStage(uint8_t index) { return &slots[index].stage; }
+
+  /**
+   * @brief Write the summary : for each stage its end time and its duration
+   * since the previous stage, in milliseconds, e.g. `nvs 352(+14) gpio
+   * 355(+3)`.
+   *
+   * @param buffer the target, always terminated.
+   * @param size the size of the buffer.
+   * @return size_t the length of the summary.
+   */
+  size_t format(char *buffer, size_t size);
+};
+
+#endif
@@ -0,0 +1,126 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Boot Simplist'.
+// ---
+// 'Boot Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Boot Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Boot Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef BOOT_SEQUENCER_HPP
+#define BOOT_SEQUENCER_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "BootLaneSync.hpp"
+#include "BootProfiler.hpp"
+#include "BootSimplistTypes.hpp"
+
+/** @brief Run the stages of the boot, each one as soon as the stages it
+ * depends on are done, so that independent stages overlap (e.g. the start of
+ * the display while the wifi stack initializes).
+ *
+ * Each stage belongs to a lane, a lane runs its stages in the order of
+ * addition, and the lanes run at the same time (on the device, one task per
+ * core). A stage may only depend on stages already added, thus the sequence
+ * cannot deadlock, and running all the stages in the order of addition is
+ * always a valid, sequential, boot.
+ */
+class BootSequencer {
+private:
+  BootStageDefinition stages[BOOT_SEQUENCER_MAX_STAGES];
+  uint8_t count = 0;
+  bool valid = true;
+  BootProfiler *profiler = nullptr;
+
+public:
+  virtual ~BootSequencer();
+
+  /**
+   * @brief Mark each stage in the given profiler once done.
+   */
+  BootSequencer *withProfiler(BootProfiler *profiler) {
+    this->profiler = profiler;
+    return this;
+  }
+
+  /**
+   * @brief Add a stage.
+   *
+   * @param name the name of the stage, kept as is.
+   * @param run the work to do.
+   * @param lane the lane running the stage.
+   * @param dependencies the stages to be done before, see `maskOf`.
+   * @return int8_t the index of the stage, `BOOT_SEQUENCER_NO_STAGE` when
+   * there are too many stages, the lane does not exist or a dependency is not
+   * an added stage ; the sequence is then invalid.
+   */
+  int8_t addStage(const char *name, BootStageFunction run, uint8_t lane,
+                  uint32_t dependencies = 0);
+
+  /**
+   * @brief The mask of a stage, to build dependencies, e.g. `maskOf(nvs) |
+   * maskOf(display)`.
+   *
+   * @param stage the index of the stage.
+   * @return uint32_t the mask, all bits for `BOOT_SEQUENCER_NO_STAGE`, that
+   * no stage can depend on.
+   */
+  static uint32_t maskOf(int8_t stage) {
+    return 0 <= stage && stage < BOOT_SEQUENCER_MAX_STAGES ? 1UL << stage
+                                                           : UINT32_MAX;
+  }
+
+  /**
+   * @brief Tell whether all the stages have been added.
+   */
+  bool isValid() { return valid; }
+
+  uint8_t getStageCount() { return count; }
+  const BootStageDefinition *getStage(uint8_t index) { return &stages[index]; }
+
+  /**
+   * @brief The mask of all the stages.
+   */
+  uint32_t getAllStages() {
+    return 0 == count ? 0 : UINT32_MAX >> (32 - count);
+  }
+
+  /**
+   * @brief The number of lanes used by the stages.
+   */
+  uint8_t getLaneCount();
+
+  /**
+   * @brief Run one stage, then mark it in the profiler.
+   */
+  void runStage(uint8_t index);
+
+  /**
+   * @brief Run the stages of a lane, in the order of addition, each one after
+   * its dependencies.
+   *
+   * @param lane the lane.
+   * @param sync shared by all the lanes.
+   */
+  void runLane(uint8_t lane, BootLaneSync *sync);
+
+  /**
+   * @brief Run all the stages, one after the other, in the order of
+   * addition.
+   */
+  void runInOrder();
+};
+
+#endif
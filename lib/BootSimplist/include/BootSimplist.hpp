@@ -0,0 +1,31 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Boot Simplist'.
+// ---
+// 'Boot Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Boot Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Boot Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef BOOT_SIMPLIST_HPP
+#define BOOT_SIMPLIST_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "BootLaneSync.hpp"
+#include "BootProfiler.hpp"
+#include "BootSequencer.hpp"
+#include "BootSimplistTypes.hpp"
+
+#endif
@@ -0,0 +1,69 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Boot Simplist'.
+// ---
+// 'Boot Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Boot Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Boot Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef BOOT_SIMPLIST_TYPES_HPP
+#define BOOT_SIMPLIST_TYPES_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+//**@brief Maximum number of stages followed by a boot profiler.
+const uint8_t BOOT_PROFILER_MAX_STAGES = 32;
+
+//**@brief Size of a buffer large enough for the summary of a boot profile.
+const uint16_t BOOT_PROFILER_SUMMARY_SIZE = 768;
+
+//**@brief Maximum number of stages run by a boot sequencer, one bit each.
+const uint8_t BOOT_SEQUENCER_MAX_STAGES = 24;
+
+//**@brief Maximum number of lanes, i.e. of stages running at the same time.
+const uint8_t BOOT_SEQUENCER_MAX_LANES = 2;
+
+//**@brief Returned instead of the index of a stage that could not be added.
+const int8_t BOOT_SEQUENCER_NO_STAGE = -1;
+
+/** @brief The end of a stage of the boot.
+ */
+struct BootStage {
+  /** @brief Name of the stage, kept as is (e.g. a literal). */
+  const char *name;
+  /** @brief When the stage was done, in microseconds since the reset. */
+  int64_t at;
+};
+
+/** @brief The work of a stage of the boot.
+ */
+typedef void (*BootStageFunction)();
+
+/** @brief A stage of the boot, as given to a boot sequencer.
+ */
+struct BootStageDefinition {
+  /** @brief Name of the stage, kept as is, also used for the profile. */
+  const char *name;
+  /** @brief The work to do. */
+  BootStageFunction run;
+  /** @brief The lane running the stage, 0 being the task calling the
+   * sequencer. */
+  uint8_t lane;
+  /** @brief The stages to be done before, one bit per stage index. */
+  uint32_t dependencies;
+};
+
+#endif
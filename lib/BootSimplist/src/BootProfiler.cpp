@@ -0,0 +1,87 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Boot Simplist'.
+// ---
+// 'Boot Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Boot Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Boot Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "BootProfiler.hpp"
+
+// standard includes
+#include <cstdio>
+#include <cstring>
+
+BootProfiler::~BootProfiler() {}
+// write code here...
+
+bool BootProfiler::mark(const char *name) {
+  int64_t now = clock();
+  if (isMarked(name)) {
+    return false;
+  }
+  uint8_t index = claimed.fetch_add(1);
+  if (index >= BOOT_PROFILER_MAX_STAGES) {
+    claimed.store(BOOT_PROFILER_MAX_STAGES);
+    return false;
+  }
+  slots[index].stage.name = name;
+  slots[index].stage.at = now;
+  slots[index].ready.store(true, std::memory_order_release);
+  return true;
+}
+
+uint8_t BootProfiler::getStageCount() {
+  uint8_t count = 0;
+  while (count < BOOT_PROFILER_MAX_STAGES &&
+         slots[count].ready.load(std::memory_order_acquire)) {
+    ++count;
+  }
+  return count;
+}
+
+bool BootProfiler::isMarked(const char *name, int64_t *at) {
+  uint8_t count = getStageCount();
+  for (uint8_t i = 0; i < count; i++) {
+    if (0 == strcmp(name, slots[i].stage.name)) {
+      if (nullptr != at) {
+        *at = slots[i].stage.at;
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t BootProfiler::format(char *buffer, size_t size) {
+  if (0 == size) {
+    return 0;
+  }
+  buffer[0] = 0;
+  size_t length = 0;
+  int64_t previous = 0;
+  uint8_t count = getStageCount();
+  for (uint8_t i = 0; i < count && length < size - 1; i++) {
+    const BootStage &stage = slots[i].stage;
+    int written = snprintf(buffer + length, size - length, "%s%s %lld(+%lld)",
+                           0 == i ? "" : " ", stage.name,
+                           (long long)(stage.at / 1000),
+                           (long long)((stage.at - previous) / 1000));
+    if (written < 0) {
+      break;
+    }
+    length += (size_t)written;
+    previous = stage.at;
+  }
+  return length < size ? length : size - 1;
+}
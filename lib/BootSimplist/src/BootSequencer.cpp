@@ -0,0 +1,70 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Boot Simplist'.
+// ---
+// 'Boot Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Boot Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Boot Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "BootSequencer.hpp"
+
+BootSequencer::~BootSequencer() {}
+// write code here...
+
+int8_t BootSequencer::addStage(const char *name, BootStageFunction run,
+                               uint8_t lane, uint32_t dependencies) {
+  if (count >= BOOT_SEQUENCER_MAX_STAGES || lane >= BOOT_SEQUENCER_MAX_LANES ||
+      0 != (dependencies & ~getAllStages())) {
+    valid = false;
+    return BOOT_SEQUENCER_NO_STAGE;
+  }
+  stages[count] = {
+      .name = name, .run = run, .lane = lane, .dependencies = dependencies};
+  return count++;
+}
+
+uint8_t BootSequencer::getLaneCount() {
+  uint8_t lanes = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    if (stages[i].lane >= lanes) {
+      lanes = stages[i].lane + 1;
+    }
+  }
+  return lanes;
+}
+
+void BootSequencer::runStage(uint8_t index) {
+  stages[index].run();
+  if (nullptr != profiler) {
+    profiler->mark(stages[index].name);
+  }
+}
+
+void BootSequencer::runLane(uint8_t lane, BootLaneSync *sync) {
+  for (uint8_t i = 0; i < count; i++) {
+    if (lane != stages[i].lane) {
+      continue;
+    }
+    if (0 != stages[i].dependencies) {
+      sync->waitFor(stages[i].dependencies);
+    }
+    runStage(i);
+    sync->signal(maskOf(i));
+  }
+}
+
+void BootSequencer::runInOrder() {
+  for (uint8_t i = 0; i < count; i++) {
+    runStage(i);
+  }
+}
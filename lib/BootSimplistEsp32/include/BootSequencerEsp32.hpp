@@ -0,0 +1,81 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Boot Simplist for ESP32'.
+// ---
+// 'Boot Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Boot Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Boot Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef BOOT_SEQUENCER_ESP32_HPP
+#define BOOT_SEQUENCER_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "esp_err.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/task.h"
+
+// project includes
+#include "BootSimplist.hpp"
+
+//**@brief Stack of a task running a lane, in bytes, freed when the lane ends.
+const uint32_t BOOT_LANE_STACK_SIZE = 4096;
+
+/** @brief Run a boot sequence, the lane 0 in the calling task (`app_main`,
+ * on the core 0), each other lane in a task pinned to the next core.
+ *
+ * The done stages are the bits of an event group, reserved with the
+ * sequencer.
+ *
+ * ```cpp
+ * BootSequencer sequence;
+ * int8_t nvs = sequence.addStage("nvs", setupNvs, 0);
+ * int8_t display = sequence.addStage("display", setupDisplay, 1);
+ * sequence.addStage("wifi", setupWifi, 0, BootSequencer::maskOf(nvs));
+ * BootSequencerEsp32 boot(&sequence);
+ * boot.run(); // returns when all the stages are done
+ * ```
+ */
+class BootSequencerEsp32 : public BootLaneSync {
+private:
+  struct Lane {
+    BootSequencerEsp32 *owner;
+    uint8_t index;
+  };
+  BootSequencer *sequencer;
+  StaticEventGroup_t doneBuffer;
+  EventGroupHandle_t done = nullptr;
+  Lane lanes[BOOT_SEQUENCER_MAX_LANES];
+
+  static void runLaneTask(void *lane);
+
+public:
+  BootSequencerEsp32(BootSequencer *sequencer) : sequencer(sequencer) {}
+  virtual ~BootSequencerEsp32();
+
+  void waitFor(uint32_t stages);
+  void signal(uint32_t stages);
+
+  /**
+   * @brief Run all the stages, then return.
+   *
+   * @param parallel false to run the stages one after the other, in the
+   * order of addition, e.g. to compare the boot profiles.
+   * @return false when the sequence is invalid, nothing is run then.
+   */
+  bool run(bool parallel = true);
+};
+
+#endif
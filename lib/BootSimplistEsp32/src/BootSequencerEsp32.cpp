@@ -0,0 +1,55 @@
+
+// header include
+#include "BootSequencerEsp32.hpp"
+
+static constexpr char *TAG = (char *)"BootSequencerEsp32";
+
+BootSequencerEsp32::~BootSequencerEsp32() {}
+// write code here...
+
+void BootSequencerEsp32::runLaneTask(void *lane) {
+  Lane *self = (Lane *)lane;
+  self->owner->sequencer->runLane(self->index, self->owner);
+  vTaskDelete(nullptr);
+}
+
+void BootSequencerEsp32::waitFor(uint32_t stages) {
+  xEventGroupWaitBits(done, stages, pdFALSE, pdTRUE, portMAX_DELAY);
+}
+
+void BootSequencerEsp32::signal(uint32_t stages) {
+  xEventGroupSetBits(done, stages);
+}
+
+bool BootSequencerEsp32::run(bool parallel) {
+  if (!sequencer->isValid()) {
+    ESP_LOGE(TAG, "Invalid boot sequence, not run.");
+    return false;
+  }
+  if (!parallel) {
+    sequencer->runInOrder();
+    return true;
+  }
+  if (nullptr == done) {
+    done = xEventGroupCreateStatic(&doneBuffer);
+  }
+  uint8_t laneCount = sequencer->getLaneCount();
+  for (uint8_t i = 1; i < laneCount; i++) {
+    lanes[i] = {.owner = this, .index = i};
+    if (pdPASS != xTaskCreatePinnedToCore(runLaneTask, "boot-lane",
+                                          BOOT_LANE_STACK_SIZE, &lanes[i],
+                                          uxTaskPriorityGet(nullptr), nullptr,
+                                          i % portNUM_PROCESSORS)) {
+      if (1 == i) { // no other lane is running yet
+        ESP_LOGW(TAG, "Could not create a lane, runs in order.");
+        sequencer->runInOrder();
+        return true;
+      }
+      ESP_LOGE(TAG, "Could not create the lane %d.", i);
+      ESP_ERROR_CHECK(ESP_ERR_NO_MEM); // the other lanes could wait forever
+    }
+  }
+  sequencer->runLane(0, this);
+  waitFor(sequencer->getAllStages());
+  return true;
+}
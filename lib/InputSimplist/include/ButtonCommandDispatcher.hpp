@@ -0,0 +1,72 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef BUTTON_COMMAND_DISPATCHER_HPP
+#define BUTTON_COMMAND_DISPATCHER_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "GestureListener.hpp"
+#include "InputJournal.hpp"
+#include "InputSimplistTypes.hpp"
+#include "TheClockCommandListener.hpp"
+
+/** @brief Translate the gestures of the control panel into the commands of the
+ * clock, journaling both when a journal is given.
+ */
+class ButtonCommandDispatcher : public GestureListener {
+private:
+  uint8_t menu;
+  uint8_t back;
+  uint8_t up;
+  uint8_t down;
+  TheClockCommandListener *listener = nullptr;
+  InputJournal *journal = nullptr;
+
+  void dispatch(TheClockCommand command, Gesture *gesture);
+
+public:
+  /**
+   * @brief Setup the dispatcher with the ids of the buttons.
+   */
+  ButtonCommandDispatcher(uint8_t menu, uint8_t back, uint8_t up, uint8_t down)
+      : menu(menu), back(back), up(up), down(down) {}
+  virtual ~ButtonCommandDispatcher();
+
+  ButtonCommandDispatcher *withListener(TheClockCommandListener *listener) {
+    this->listener = listener;
+    return this;
+  }
+  ButtonCommandDispatcher *withJournal(InputJournal *journal) {
+    this->journal = journal;
+    return this;
+  }
+
+  virtual void onGesture(Gesture *gesture);
+
+  /**
+   * @brief Translate the steps of a rotary encoder into 'up' and 'down' clicks.
+   *
+   * @param steps the steps, negative when turning backward ('down').
+   */
+  void onRotation(int32_t steps);
+};
+
+#endif
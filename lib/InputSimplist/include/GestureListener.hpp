@@ -0,0 +1,42 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef GESTURE_LISTENER_HPP
+#define GESTURE_LISTENER_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "InputSimplistTypes.hpp"
+
+/** @brief Receive the gestures of a `GestureRecognizer`.
+ */
+class GestureListener {
+public:
+  virtual ~GestureListener();
+
+  /**
+   * @brief A gesture has been recognized.
+   *
+   * @param gesture the gesture, valid during the call.
+   */
+  virtual void onGesture(Gesture *gesture) = 0;
+};
+
+#endif
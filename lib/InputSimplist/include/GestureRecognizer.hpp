@@ -0,0 +1,144 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef GESTURE_RECOGNIZER_HPP
+#define GESTURE_RECOGNIZER_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "GestureListener.hpp"
+#include "InputSimplistTypes.hpp"
+
+/** @brief Recognize the gestures of a set of buttons, each button being a state
+ * machine defined by a transition table, timed in milliseconds.
+ *
+ * The recognizer is fed with the presses and releases of the debounced
+ * buttons, and ticked to expire its deadlines ; `getNextDeadline()` tells
+ * when to tick it next, so that the caller can sleep until then.
+ *
+ * ```cpp
+ * static const GestureProfile UP_DOWN = {0, 0, 500, 250, 40, 20};
+ * recognizer.withButton(UP, &UP_DOWN)->withButton(DOWN, &UP_DOWN);
+ * recognizer.withChord(UP, DOWN)->withListener(this);
+ * // on button change
+ * recognizer.update(UP, pressed, nowMs);
+ * // when the deadline is reached
+ * recognizer.tick(nowMs);
+ * ```
+ */
+class GestureRecognizer {
+private:
+  struct Slot {
+    uint8_t id;
+    const GestureProfile *profile;
+    GestureState state;
+    bool armed;
+    uint32_t deadline;
+    uint16_t repeatCount;
+    uint16_t repeatPeriodMs;
+    /**
+     * @brief The click waits for the release, to be told apart from a double
+     * click or a chord.
+     */
+    bool deferredClick;
+  };
+  struct Chord {
+    uint8_t first;
+    uint8_t second;
+  };
+
+  static const GestureTransition TRANSITIONS[GESTURE_STATE_COUNT]
+                                            [GESTURE_INPUT_COUNT];
+
+  Slot slots[GESTURE_MAX_BUTTONS];
+  uint8_t slotCount = 0;
+  Chord chords[GESTURE_MAX_CHORDS];
+  uint8_t chordCount = 0;
+  GestureListener *listener = nullptr;
+
+  Slot *findSlot(uint8_t id);
+  bool isChord(uint8_t first, uint8_t second);
+  void dispatch(Slot *slot, GestureInput input, uint32_t now,
+                Slot *other = nullptr);
+
+  /**
+   * @brief Do the action of a transition.
+   *
+   * @return GestureState the state to go to instead of the one of the table,
+   * `GESTURE_STATE_COUNT` to keep the one of the table.
+   */
+  GestureState perform(Slot *slot, GestureAction action, uint32_t now,
+                       Slot *other);
+  void emit(GestureType type, Slot *slot, Slot *other = nullptr);
+  void arm(Slot *slot, uint32_t deadline) {
+    slot->armed = true;
+    slot->deadline = deadline;
+  }
+
+public:
+  virtual ~GestureRecognizer();
+
+  /**
+   * @brief Register a button.
+   *
+   * @param id the id of the button, e.g. its GPIO.
+   * @param profile the timings, to be kept by the caller.
+   * @return GestureRecognizer* the recognizer.
+   */
+  GestureRecognizer *withButton(uint8_t id, const GestureProfile *profile);
+
+  /**
+   * @brief Register a chord of two registered buttons.
+   *
+   * @return GestureRecognizer* the recognizer.
+   */
+  GestureRecognizer *withChord(uint8_t first, uint8_t second);
+
+  GestureRecognizer *withListener(GestureListener *listener) {
+    this->listener = listener;
+    return this;
+  }
+
+  /**
+   * @brief Feed a change of a button.
+   *
+   * @param id the id of the button.
+   * @param pressed the new state of the button.
+   * @param now the current time in milliseconds.
+   */
+  void update(uint8_t id, bool pressed, uint32_t now);
+
+  /**
+   * @brief Expire the deadlines that have been reached.
+   *
+   * @param now the current time in milliseconds.
+   */
+  void tick(uint32_t now);
+
+  /**
+   * @brief Get the earliest deadline.
+   *
+   * @param deadline where to store the deadline, in milliseconds.
+   * @return true when there is a deadline, e.g. a button is held.
+   */
+  bool getNextDeadline(uint32_t *deadline);
+};
+
+#endif
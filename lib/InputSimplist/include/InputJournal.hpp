@@ -0,0 +1,137 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef INPUT_JOURNAL_HPP
+#define INPUT_JOURNAL_HPP
+
+// standard includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "InputSimplistTypes.hpp"
+
+/** @brief Record the processing of the inputs in a ring buffer, the oldest
+ * entries being overwritten.
+ *
+ * The recording is lock free, so that it can be done from an interrupt ; the
+ * timestamps come from the clock given at creation (on the device,
+ * `esp_timer_get_time`).
+ *
+ * The journal can be exported as text (one entry per line) to be imported and
+ * replayed on the native environment, see `InputJournalReplayer`.
+ */
+class InputJournal {
+private:
+  InputJournalEntry entries[INPUT_JOURNAL_CAPACITY];
+  std::atomic<uint32_t> written{0};
+  int64_t (*clock)();
+
+public:
+  /**
+   * @brief Setup the journal.
+   *
+   * @param clock the source of timestamps, in microseconds.
+   */
+  InputJournal(int64_t (*clock)()) : clock(clock) {}
+  virtual ~InputJournal();
+
+  int64_t now() { return clock(); }
+
+  /**
+   * @brief Record an entry, timestamped now.
+   */
+  void record(InputJournalKind kind, uint8_t source, uint8_t code,
+              uint8_t other = 0, uint16_t count = 0) {
+    recordAt(clock(), kind, source, code, other, count);
+  }
+
+  /**
+   * @brief Record an entry with the given timestamp.
+   */
+  void recordAt(int64_t time, InputJournalKind kind, uint8_t source,
+                uint8_t code, uint8_t other = 0, uint16_t count = 0);
+
+  /**
+   * @brief Get the number of available entries.
+   */
+  uint32_t getSize();
+
+  /**
+   * @brief Get the number of entries recorded since the creation.
+   */
+  uint32_t getRecordedCount() { return written.load(); }
+
+  /**
+   * @brief Get an entry.
+   *
+   * @param index the index, 0 being the oldest available entry.
+   * @return const InputJournalEntry* the entry.
+   */
+  const InputJournalEntry *get(uint32_t index);
+
+  void clear() { written.store(0); }
+
+  /**
+   * @brief Write an entry as a line of text (see `exportTo`).
+   *
+   * @param index the index of the entry, 0 being the oldest.
+   * @param buffer where to write.
+   * @param size the size of the buffer.
+   * @return int the length of the line, as `snprintf`.
+   */
+  int exportEntry(uint32_t index, char *buffer, size_t size);
+
+  /**
+   * @brief Write the entries as text, one line per entry :
+   * `time kind source code other count`.
+   *
+   * @param buffer where to write.
+   * @param size the size of the buffer.
+   * @return size_t the length written, the last incomplete line being dropped.
+   */
+  size_t exportTo(char *buffer, size_t size);
+
+  /**
+   * @brief Replace the entries by the ones of an export.
+   *
+   * @param text the text of the export, the lines may keep the prefix of a
+   * capture of the log, e.g. `I (1234) the-clock: `.
+   * @return uint32_t the number of entries read.
+   */
+  uint32_t importFrom(const char *text);
+
+  /**
+   * @brief Measure the delay from each entry of a kind to each following
+   * entry of another kind.
+   *
+   * E.g. from `INPUT_JOURNAL_EDGE` to `INPUT_JOURNAL_DISPLAY`, for the end
+   * to end latency.
+   *
+   * @param from the kind starting the delay, the first one since the previous
+   * measure is used.
+   * @param to the kind ending the delay.
+   * @param latency where to store the statistics.
+   * @return true when there was at least one measure.
+   */
+  bool measure(InputJournalKind from, InputJournalKind to,
+               InputLatency *latency);
+};
+
+#endif
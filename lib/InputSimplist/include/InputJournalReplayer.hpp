@@ -0,0 +1,76 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef INPUT_JOURNAL_REPLAYER_HPP
+#define INPUT_JOURNAL_REPLAYER_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "GestureRecognizer.hpp"
+#include "InputJournal.hpp"
+#include "InputSimplistTypes.hpp"
+
+/** @brief Feed the debounced changes of a recorded journal to a gesture
+ * recognizer, on a simulated time line, e.g. to check on the native
+ * environment that the same commands are dispatched at the same times.
+ *
+ * The journal of the replay must use `InputJournalReplayer::clock`, it
+ * records the replayed changes and whatever the listeners of the recognizer
+ * record.
+ */
+class InputJournalReplayer {
+private:
+  static int64_t simulatedNow;
+  GestureRecognizer *recognizer;
+  InputJournal *output;
+
+  /**
+   * @brief Expire the deadlines of the recognizer up to the given time.
+   */
+  void runUntil(int64_t until);
+
+public:
+  /**
+   * @brief Setup the replay.
+   *
+   * @param recognizer the recognizer, with its listeners.
+   * @param output the journal of the replay.
+   */
+  InputJournalReplayer(GestureRecognizer *recognizer, InputJournal *output)
+      : recognizer(recognizer), output(output) {}
+  virtual ~InputJournalReplayer();
+
+  /**
+   * @brief The simulated time, to be the clock of the output journal.
+   */
+  static int64_t clock() { return simulatedNow; }
+
+  /**
+   * @brief Replay the changes.
+   *
+   * @param recorded the journal to replay.
+   * @param settleMicros how long to run after the last change, e.g. to get the
+   * deferred clicks.
+   * @return uint32_t the number of replayed changes.
+   */
+  uint32_t replay(InputJournal *recorded, int64_t settleMicros = 5000000);
+};
+
+#endif
@@ -0,0 +1,243 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef INPUT_SIMPLIST_TYPES_HPP
+#define INPUT_SIMPLIST_TYPES_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+//**@brief Maximum number of buttons followed by a gesture recognizer.
+const uint8_t GESTURE_MAX_BUTTONS = 8;
+//**@brief Maximum number of chords followed by a gesture recognizer.
+const uint8_t GESTURE_MAX_CHORDS = 4;
+
+/**
+ * @brief What the user did with a button.
+ */
+enum GestureType {
+  /**
+   * @brief Press, or press and release when the click must be told apart from
+   * a double click or a chord.
+   */
+  GESTURE_CLICK,
+  /**
+   * @brief Kept pressed long enough, once until released.
+   */
+  GESTURE_LONG_CLICK,
+  /**
+   * @brief Second press shortly after a click.
+   */
+  GESTURE_DOUBLE_CLICK,
+  /**
+   * @brief Kept pressed, repeated faster and faster until released.
+   */
+  GESTURE_REPEAT,
+  /**
+   * @brief Two buttons pressed together.
+   */
+  GESTURE_CHORD
+};
+
+/**
+ * @brief A recognized gesture.
+ */
+struct Gesture {
+  GestureType type;
+  /**
+   * @brief The button, or the first button of the chord.
+   */
+  uint8_t button;
+  /**
+   * @brief The second button of the chord.
+   */
+  uint8_t other;
+  /**
+   * @brief The number of the repetition, starting at 1.
+   */
+  uint16_t count;
+};
+
+/**
+ * @brief How the gestures of a button are timed, 0 to disable a gesture.
+ *
+ * When the repeat is enabled, there is no long click. When the double click
+ * is enabled, or when the button is part of a chord, the click is given on
+ * release (or after the double click delay) instead of on press.
+ */
+struct GestureProfile {
+  uint16_t longClickMs;
+  uint16_t doubleClickMs;
+  uint16_t repeatDelayMs;
+  uint16_t repeatPeriodMs;
+  uint16_t repeatMinPeriodMs;
+  /**
+   * @brief At each repetition, the period is shortened by this ratio of itself.
+   */
+  uint8_t repeatAccelerationPercent;
+};
+
+/**
+ * @brief Internal state of each button of the recognizer.
+ */
+enum GestureState {
+  GESTURE_STATE_IDLE,
+  GESTURE_STATE_PRESSED,
+  GESTURE_STATE_HELD,
+  GESTURE_STATE_RELEASED_ONCE,
+  GESTURE_STATE_PRESSED_TWICE,
+  GESTURE_STATE_CHORDED,
+  GESTURE_STATE_COUNT
+};
+
+/**
+ * @brief What happens to a button of the recognizer.
+ */
+enum GestureInput {
+  GESTURE_INPUT_PRESS,
+  GESTURE_INPUT_RELEASE,
+  GESTURE_INPUT_TIMEOUT,
+  GESTURE_INPUT_CHORD,
+  GESTURE_INPUT_COUNT
+};
+
+/**
+ * @brief What the recognizer does on a transition.
+ */
+enum GestureAction {
+  GESTURE_ACTION_NONE,
+  GESTURE_ACTION_PRESS,
+  GESTURE_ACTION_RELEASE,
+  GESTURE_ACTION_HOLD,
+  GESTURE_ACTION_REPEAT,
+  GESTURE_ACTION_CLICK,
+  GESTURE_ACTION_DOUBLE_CLICK,
+  GESTURE_ACTION_CHORD
+};
+
+/**
+ * @brief A cell of the transition table.
+ */
+struct GestureTransition {
+  GestureState next;
+  GestureAction action;
+};
+
+//**@brief Number of entries kept by an input journal.
+const uint32_t INPUT_JOURNAL_CAPACITY = 256;
+
+/**
+ * @brief The stages of the processing of an input, from the pin to the
+ * display.
+ */
+enum InputJournalKind {
+  /**
+   * @brief Raw change of a pin (interrupt), `code` is the level.
+   */
+  INPUT_JOURNAL_EDGE,
+  /**
+   * @brief Debounced change of a button, `code` is 1 when pressed.
+   */
+  INPUT_JOURNAL_STATE_CHANGE,
+  /**
+   * @brief Recognized gesture, `code` is the `GestureType`.
+   */
+  INPUT_JOURNAL_GESTURE,
+  /**
+   * @brief Call to the clock, `code` is the `TheClockCommand`.
+   */
+  INPUT_JOURNAL_COMMAND,
+  /**
+   * @brief Upload of a new content to the display.
+   */
+  INPUT_JOURNAL_DISPLAY
+};
+
+/**
+ * @brief A recorded input event, 16 bytes.
+ */
+struct InputJournalEntry {
+  /**
+   * @brief Timestamp in microseconds.
+   */
+  int64_t time;
+  uint8_t kind;
+  /**
+   * @brief The button (e.g. its GPIO).
+   */
+  uint8_t source;
+  uint8_t code;
+  /**
+   * @brief The second button of a chord.
+   */
+  uint8_t other;
+  /**
+   * @brief The repetition count of a gesture.
+   */
+  uint16_t count;
+  uint16_t reserved;
+};
+
+/**
+ * @brief Statistics of the delay between two stages.
+ */
+struct InputLatency {
+  uint32_t count;
+  int64_t min;
+  int64_t max;
+  int64_t total;
+};
+
+/**
+ * @brief The calls of the `TheClockCommandListener`, as recorded.
+ */
+enum TheClockCommand {
+  COMMAND_MENU_CLICK,
+  COMMAND_MENU_LONG_CLICK,
+  COMMAND_MENU_DOUBLE_CLICK,
+  COMMAND_MENU_BACK_CHORD,
+  COMMAND_BACK_CLICK,
+  COMMAND_BACK_LONG_CLICK,
+  COMMAND_UP_CLICK,
+  COMMAND_UP_LONG_CLICK,
+  COMMAND_DOWN_CLICK,
+  COMMAND_DOWN_LONG_CLICK
+};
+
+/**
+ * @brief How the rotation of an encoder is turned into steps.
+ */
+struct RotaryProfile {
+  /**
+   * @brief Counts of the quadrature decoder for one detent, usually 4.
+   */
+  uint8_t countsPerDetent;
+  /**
+   * @brief Up to this speed, one step per detent.
+   */
+  uint16_t slowDetentsPerSecond;
+  /**
+   * @brief From this speed, `maxStepsPerDetent` steps per detent.
+   */
+  uint16_t fastDetentsPerSecond;
+  uint8_t maxStepsPerDetent;
+};
+
+#endif
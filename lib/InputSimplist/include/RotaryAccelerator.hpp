@@ -0,0 +1,77 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef ROTARY_ACCELERATOR_HPP
+#define ROTARY_ACCELERATOR_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "InputSimplistTypes.hpp"
+
+/** @brief Turn the successive counts of a quadrature decoder into steps,
+ * more steps per detent the faster the encoder is turned.
+ *
+ * The counts of an incomplete detent are kept until the detent is completed,
+ * so that the jitter around a detent gives no step. The speed is smoothed
+ * over the successive updates, and starts again from zero when the direction
+ * changes or after a pause.
+ */
+class RotaryAccelerator {
+private:
+  const RotaryProfile *profile;
+  bool started = false;
+  int32_t lastCount = 0;
+  int32_t pendingCounts = 0;
+  int8_t direction = 0;
+  /**
+   * @brief Smoothed speed, in detents per second, times 16.
+   */
+  uint32_t speed16 = 0;
+  uint32_t idleMs = 0;
+
+  uint8_t getStepsPerDetent();
+
+public:
+  /**
+   * @brief Setup the accelerator.
+   *
+   * @param profile the profile, to be kept by the caller.
+   */
+  RotaryAccelerator(const RotaryProfile *profile) : profile(profile) {}
+  virtual ~RotaryAccelerator();
+
+  /**
+   * @brief Take the current count of the decoder.
+   *
+   * @param count the count, accumulated since the start (it may wrap around).
+   * @param elapsedMs the time since the previous update.
+   * @return int32_t the steps to do, negative when turning backward.
+   */
+  int32_t update(int32_t count, uint32_t elapsedMs);
+
+  /**
+   * @brief Get the smoothed speed.
+   *
+   * @return uint32_t the speed in detents per second.
+   */
+  uint32_t getSpeed() { return speed16 / 16; }
+};
+
+#endif
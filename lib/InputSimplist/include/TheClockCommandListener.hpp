@@ -0,0 +1,72 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef THE_CLOCK_COMMAND_LISTENER_HPP
+#define THE_CLOCK_COMMAND_LISTENER_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+/**
+ * @brief The interface implemented by the clock, relative to buttons message.
+ *
+ * @note For each button, the clock will acknowledge two types of messages :
+ * @note - A normal click, that happens when a buttons is transitioning from
+ * high to low ;
+ * @note - A long click, when the button is maintained push for a long enough
+ * time
+ * @note ---
+ * @note For menu and back buttons, the long click will happen only once, until
+ * the button is released.
+ * @note ---
+ * @note For up and down buttons, the long click will happen regularly, until
+ * the button is released, faster and faster.
+ * @note ---
+ * @note The menu button is also double clicked, its click happens after the
+ * double click delay ; the menu and back buttons pressed together make a
+ * chord, their click happens on release.
+ *
+ */
+class TheClockCommandListener {
+public:
+  virtual ~TheClockCommandListener();
+
+  virtual void onMenuClick() = 0;
+
+  virtual void onMenuLongClick() = 0;
+
+  virtual void onMenuDoubleClick() = 0;
+
+  virtual void onMenuBackChord() = 0;
+
+  virtual void onBackClick() = 0;
+
+  virtual void onBackLongClick() = 0;
+
+  virtual void onUpClick() = 0;
+
+  virtual void onUpLongClick() = 0;
+
+  virtual void onDownClick() = 0;
+
+  virtual void onDownLongClick() = 0;
+};
+
+#endif
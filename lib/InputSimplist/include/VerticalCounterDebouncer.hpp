@@ -0,0 +1,83 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef VERTICAL_COUNTER_DEBOUNCER_HPP
+#define VERTICAL_COUNTER_DEBOUNCER_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+/** @brief Debounce up to 64 inputs at once, sampled together in a bitmask.
+ *
+ * Each bit has a 2 bits counter, stored 'vertically' in two words : a bit of
+ * the debounced state toggles after 4 consecutive samples differing from it,
+ * in a handful of bitwise operations whatever the number of inputs.
+ */
+class VerticalCounterDebouncer {
+private:
+  uint64_t mask;
+  uint64_t state;
+  uint64_t count0 = ~0ULL;
+  uint64_t count1 = ~0ULL;
+
+public:
+  /**
+   * @brief Setup the debouncer.
+   *
+   * @param mask the bits to debounce, the others are ignored.
+   * @param initial the initial state, e.g. all high for released buttons with
+   * pull ups.
+   */
+  VerticalCounterDebouncer(uint64_t mask = 0, uint64_t initial = ~0ULL)
+      : mask(mask), state(initial & mask) {}
+  virtual ~VerticalCounterDebouncer();
+
+  /**
+   * @brief Start again from the given state.
+   */
+  void reset(uint64_t mask, uint64_t initial) {
+    this->mask = mask;
+    state = initial & mask;
+    count0 = ~0ULL;
+    count1 = ~0ULL;
+  }
+
+  /**
+   * @brief Take a new sample.
+   *
+   * @param sample the raw inputs.
+   * @return uint64_t the bits of the debounced state that have toggled.
+   */
+  uint64_t update(uint64_t sample) {
+    uint64_t changed = (state ^ sample) & mask;
+    // the counters of the unchanged bits are reset to 3, the others count down
+    count0 = ~(count0 & changed);
+    count1 = count0 ^ (count1 & changed);
+    uint64_t toggled = changed & count0 & count1;
+    state ^= toggled;
+    return toggled;
+  }
+
+  uint64_t getState() { return state; }
+  uint64_t getMask() { return mask; }
+  bool isHigh(uint8_t bit) { return 0 != (state & (1ULL << bit)); }
+};
+
+#endif
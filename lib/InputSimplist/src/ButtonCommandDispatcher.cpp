@@ -0,0 +1,134 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "ButtonCommandDispatcher.hpp"
+
+ButtonCommandDispatcher::~ButtonCommandDispatcher() {}
+// write code here...
+
+void ButtonCommandDispatcher::onGesture(Gesture *gesture) {
+  if (nullptr != journal) {
+    journal->record(INPUT_JOURNAL_GESTURE, gesture->button, gesture->type,
+                    gesture->other, gesture->count);
+  }
+  uint8_t button = gesture->button;
+  switch (gesture->type) {
+  case GESTURE_CLICK:
+    if (menu == button) {
+      dispatch(COMMAND_MENU_CLICK, gesture);
+    } else if (back == button) {
+      dispatch(COMMAND_BACK_CLICK, gesture);
+    } else if (up == button) {
+      dispatch(COMMAND_UP_CLICK, gesture);
+    } else if (down == button) {
+      dispatch(COMMAND_DOWN_CLICK, gesture);
+    }
+    break;
+  case GESTURE_LONG_CLICK:
+    if (menu == button) {
+      dispatch(COMMAND_MENU_LONG_CLICK, gesture);
+    } else if (back == button) {
+      dispatch(COMMAND_BACK_LONG_CLICK, gesture);
+    }
+    break;
+  case GESTURE_REPEAT:
+    if (up == button) {
+      dispatch(COMMAND_UP_LONG_CLICK, gesture);
+    } else if (down == button) {
+      dispatch(COMMAND_DOWN_LONG_CLICK, gesture);
+    }
+    break;
+  case GESTURE_DOUBLE_CLICK:
+    if (menu == button) {
+      dispatch(COMMAND_MENU_DOUBLE_CLICK, gesture);
+    }
+    break;
+  case GESTURE_CHORD:
+    if ((menu == button && back == gesture->other) ||
+        (back == button && menu == gesture->other)) {
+      dispatch(COMMAND_MENU_BACK_CHORD, gesture);
+    }
+    break;
+  }
+}
+
+void ButtonCommandDispatcher::onRotation(int32_t steps) {
+  if (0 == steps) {
+    return;
+  }
+  bool forward = 0 < steps;
+  uint32_t count = forward ? steps : -steps;
+  TheClockCommand command = forward ? COMMAND_UP_CLICK : COMMAND_DOWN_CLICK;
+  if (nullptr != journal) {
+    journal->record(INPUT_JOURNAL_COMMAND, forward ? up : down, command, 0,
+                    count);
+  }
+  if (nullptr == listener) {
+    return;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    if (forward) {
+      listener->onUpClick();
+    } else {
+      listener->onDownClick();
+    }
+  }
+}
+
+void ButtonCommandDispatcher::dispatch(TheClockCommand command,
+                                       Gesture *gesture) {
+  if (nullptr != journal) {
+    journal->record(INPUT_JOURNAL_COMMAND, gesture->button, command,
+                    gesture->other, gesture->count);
+  }
+  if (nullptr == listener) {
+    return;
+  }
+  switch (command) {
+  case COMMAND_MENU_CLICK:
+    listener->onMenuClick();
+    break;
+  case COMMAND_MENU_LONG_CLICK:
+    listener->onMenuLongClick();
+    break;
+  case COMMAND_MENU_DOUBLE_CLICK:
+    listener->onMenuDoubleClick();
+    break;
+  case COMMAND_MENU_BACK_CHORD:
+    listener->onMenuBackChord();
+    break;
+  case COMMAND_BACK_CLICK:
+    listener->onBackClick();
+    break;
+  case COMMAND_BACK_LONG_CLICK:
+    listener->onBackLongClick();
+    break;
+  case COMMAND_UP_CLICK:
+    listener->onUpClick();
+    break;
+  case COMMAND_UP_LONG_CLICK:
+    listener->onUpLongClick();
+    break;
+  case COMMAND_DOWN_CLICK:
+    listener->onDownClick();
+    break;
+  case COMMAND_DOWN_LONG_CLICK:
+    listener->onDownLongClick();
+    break;
+  }
+}
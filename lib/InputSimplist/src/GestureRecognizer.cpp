@@ -0,0 +1,240 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "GestureRecognizer.hpp"
+
+GestureRecognizer::~GestureRecognizer() {}
+// write code here...
+
+// clang-format off
+const GestureTransition GestureRecognizer::TRANSITIONS[GESTURE_STATE_COUNT]
+                                                     [GESTURE_INPUT_COUNT] = {
+    // PRESS, RELEASE, TIMEOUT, CHORD
+    /* IDLE */ {
+        {GESTURE_STATE_PRESSED, GESTURE_ACTION_PRESS},
+        {GESTURE_STATE_IDLE, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_IDLE, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_CHORDED, GESTURE_ACTION_NONE}},
+    /* PRESSED */ {
+        {GESTURE_STATE_PRESSED, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_RELEASED_ONCE, GESTURE_ACTION_RELEASE},
+        {GESTURE_STATE_HELD, GESTURE_ACTION_HOLD},
+        {GESTURE_STATE_CHORDED, GESTURE_ACTION_CHORD}},
+    /* HELD */ {
+        {GESTURE_STATE_HELD, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_IDLE, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_HELD, GESTURE_ACTION_REPEAT},
+        {GESTURE_STATE_HELD, GESTURE_ACTION_NONE}},
+    /* RELEASED_ONCE */ {
+        {GESTURE_STATE_PRESSED_TWICE, GESTURE_ACTION_DOUBLE_CLICK},
+        {GESTURE_STATE_RELEASED_ONCE, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_IDLE, GESTURE_ACTION_CLICK},
+        {GESTURE_STATE_RELEASED_ONCE, GESTURE_ACTION_NONE}},
+    /* PRESSED_TWICE */ {
+        {GESTURE_STATE_PRESSED_TWICE, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_IDLE, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_PRESSED_TWICE, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_PRESSED_TWICE, GESTURE_ACTION_NONE}},
+    /* CHORDED */ {
+        {GESTURE_STATE_CHORDED, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_IDLE, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_CHORDED, GESTURE_ACTION_NONE},
+        {GESTURE_STATE_CHORDED, GESTURE_ACTION_NONE}}};
+// clang-format on
+
+GestureRecognizer *GestureRecognizer::withButton(uint8_t id,
+                                                 const GestureProfile *profile) {
+  if (GESTURE_MAX_BUTTONS <= slotCount || nullptr != findSlot(id)) {
+    return this;
+  }
+  Slot *slot = &slots[slotCount++];
+  slot->id = id;
+  slot->profile = profile;
+  slot->state = GESTURE_STATE_IDLE;
+  slot->armed = false;
+  slot->deadline = 0;
+  slot->repeatCount = 0;
+  slot->repeatPeriodMs = 0;
+  slot->deferredClick = 0 < profile->doubleClickMs;
+  return this;
+}
+
+GestureRecognizer *GestureRecognizer::withChord(uint8_t first,
+                                                uint8_t second) {
+  Slot *firstSlot = findSlot(first);
+  Slot *secondSlot = findSlot(second);
+  if (GESTURE_MAX_CHORDS <= chordCount || nullptr == firstSlot ||
+      nullptr == secondSlot || first == second) {
+    return this;
+  }
+  chords[chordCount++] = {.first = first, .second = second};
+  firstSlot->deferredClick = true;
+  secondSlot->deferredClick = true;
+  return this;
+}
+
+GestureRecognizer::Slot *GestureRecognizer::findSlot(uint8_t id) {
+  for (uint8_t i = 0; i < slotCount; i++) {
+    if (id == slots[i].id) {
+      return &slots[i];
+    }
+  }
+  return nullptr;
+}
+
+bool GestureRecognizer::isChord(uint8_t first, uint8_t second) {
+  for (uint8_t i = 0; i < chordCount; i++) {
+    if ((first == chords[i].first && second == chords[i].second) ||
+        (first == chords[i].second && second == chords[i].first)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void GestureRecognizer::update(uint8_t id, bool pressed, uint32_t now) {
+  Slot *slot = findSlot(id);
+  if (nullptr == slot) {
+    return;
+  }
+  if (!pressed) {
+    dispatch(slot, GESTURE_INPUT_RELEASE, now);
+    return;
+  }
+  if (GESTURE_STATE_IDLE == slot->state) {
+    for (uint8_t i = 0; i < slotCount; i++) {
+      Slot *first = &slots[i];
+      if (GESTURE_STATE_PRESSED == first->state && isChord(first->id, id)) {
+        dispatch(first, GESTURE_INPUT_CHORD, now, slot);
+        dispatch(slot, GESTURE_INPUT_CHORD, now, first);
+        return;
+      }
+    }
+  }
+  dispatch(slot, GESTURE_INPUT_PRESS, now);
+}
+
+void GestureRecognizer::tick(uint32_t now) {
+  for (uint8_t i = 0; i < slotCount; i++) {
+    Slot *slot = &slots[i];
+    // wrap around safe
+    if (slot->armed && 0 <= (int32_t)(now - slot->deadline)) {
+      slot->armed = false;
+      dispatch(slot, GESTURE_INPUT_TIMEOUT, now);
+    }
+  }
+}
+
+bool GestureRecognizer::getNextDeadline(uint32_t *deadline) {
+  bool found = false;
+  for (uint8_t i = 0; i < slotCount; i++) {
+    Slot *slot = &slots[i];
+    if (slot->armed &&
+        (!found || 0 > (int32_t)(slot->deadline - *deadline))) {
+      *deadline = slot->deadline;
+      found = true;
+    }
+  }
+  return found;
+}
+
+void GestureRecognizer::dispatch(Slot *slot, GestureInput input, uint32_t now,
+                                 Slot *other) {
+  const GestureTransition *transition = &TRANSITIONS[slot->state][input];
+  if (GESTURE_STATE_IDLE == transition->next ||
+      GESTURE_STATE_CHORDED == transition->next) {
+    slot->armed = false;
+  }
+  GestureState next = perform(slot, transition->action, now, other);
+  slot->state = (GESTURE_STATE_COUNT == next) ? transition->next : next;
+}
+
+GestureState GestureRecognizer::perform(Slot *slot, GestureAction action,
+                                        uint32_t now, Slot *other) {
+  const GestureProfile *profile = slot->profile;
+  switch (action) {
+  case GESTURE_ACTION_NONE:
+    break;
+  case GESTURE_ACTION_PRESS:
+    if (!slot->deferredClick) {
+      emit(GESTURE_CLICK, slot);
+    }
+    if (0 < profile->repeatDelayMs) {
+      arm(slot, now + profile->repeatDelayMs);
+    } else if (0 < profile->longClickMs) {
+      arm(slot, now + profile->longClickMs);
+    } else {
+      slot->armed = false;
+    }
+    break;
+  case GESTURE_ACTION_RELEASE:
+    slot->armed = false;
+    if (0 < profile->doubleClickMs) {
+      arm(slot, now + profile->doubleClickMs);
+      break; // wait for a second press
+    }
+    if (slot->deferredClick) {
+      emit(GESTURE_CLICK, slot);
+    }
+    return GESTURE_STATE_IDLE;
+  case GESTURE_ACTION_HOLD:
+    if (0 < profile->repeatDelayMs) {
+      slot->repeatCount = 1;
+      slot->repeatPeriodMs = profile->repeatPeriodMs;
+      emit(GESTURE_REPEAT, slot);
+      arm(slot, now + slot->repeatPeriodMs);
+    } else {
+      emit(GESTURE_LONG_CLICK, slot);
+    }
+    break;
+  case GESTURE_ACTION_REPEAT: {
+    ++slot->repeatCount;
+    uint16_t shortening =
+        slot->repeatPeriodMs * profile->repeatAccelerationPercent / 100;
+    slot->repeatPeriodMs =
+        (slot->repeatPeriodMs - shortening > profile->repeatMinPeriodMs)
+            ? slot->repeatPeriodMs - shortening
+            : profile->repeatMinPeriodMs;
+    emit(GESTURE_REPEAT, slot);
+    arm(slot, now + slot->repeatPeriodMs);
+  } break;
+  case GESTURE_ACTION_CLICK:
+    emit(GESTURE_CLICK, slot);
+    break;
+  case GESTURE_ACTION_DOUBLE_CLICK:
+    slot->armed = false;
+    emit(GESTURE_DOUBLE_CLICK, slot);
+    break;
+  case GESTURE_ACTION_CHORD:
+    emit(GESTURE_CHORD, slot, other);
+    break;
+  }
+  return GESTURE_STATE_COUNT;
+}
+
+void GestureRecognizer::emit(GestureType type, Slot *slot, Slot *other) {
+  if (nullptr == listener) {
+    return;
+  }
+  Gesture gesture = {.type = type,
+                     .button = slot->id,
+                     .other = (nullptr != other) ? other->id : slot->id,
+                     .count = (GESTURE_REPEAT == type) ? slot->repeatCount
+                                                       : (uint16_t)1};
+  listener->onGesture(&gesture);
+}
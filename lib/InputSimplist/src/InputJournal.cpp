@@ -0,0 +1,146 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "InputJournal.hpp"
+
+// standard includes
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+InputJournal::~InputJournal() {}
+// write code here...
+
+void InputJournal::recordAt(int64_t time, InputJournalKind kind,
+                            uint8_t source, uint8_t code, uint8_t other,
+                            uint16_t count) {
+  uint32_t index = written.fetch_add(1) % INPUT_JOURNAL_CAPACITY;
+  InputJournalEntry *entry = &entries[index];
+  entry->time = time;
+  entry->kind = kind;
+  entry->source = source;
+  entry->code = code;
+  entry->other = other;
+  entry->count = count;
+  entry->reserved = 0;
+}
+
+uint32_t InputJournal::getSize() {
+  uint32_t count = written.load();
+  return count < INPUT_JOURNAL_CAPACITY ? count : INPUT_JOURNAL_CAPACITY;
+}
+
+const InputJournalEntry *InputJournal::get(uint32_t index) {
+  uint32_t count = written.load();
+  uint32_t oldest =
+      count < INPUT_JOURNAL_CAPACITY ? 0 : count - INPUT_JOURNAL_CAPACITY;
+  return &entries[(oldest + index) % INPUT_JOURNAL_CAPACITY];
+}
+
+int InputJournal::exportEntry(uint32_t index, char *buffer, size_t size) {
+  const InputJournalEntry *entry = get(index);
+  return snprintf(buffer, size, "%" PRId64 " %u %u %u %u %u\n", entry->time,
+                  entry->kind, entry->source, entry->code, entry->other,
+                  entry->count);
+}
+
+size_t InputJournal::exportTo(char *buffer, size_t size) {
+  size_t length = 0;
+  uint32_t count = getSize();
+  for (uint32_t i = 0; i < count; i++) {
+    int lineLength = exportEntry(i, buffer + length, size - length);
+    if (lineLength < 0 || (size_t)lineLength >= size - length) {
+      break;
+    }
+    length += lineLength;
+  }
+  if (length < size) {
+    buffer[length] = 0;
+  }
+  return length;
+}
+
+/**
+ * @brief Skip the prefix of a line of the log, e.g. `I (1234) the-clock: `.
+ */
+static const char *skipLogPrefix(const char *line) {
+  if ('0' <= *line && *line <= '9') {
+    return line;
+  }
+  for (const char *c = line; 0 != *c && '\n' != *c; c++) {
+    if (':' == c[0] && ' ' == c[1]) {
+      return c + 2;
+    }
+  }
+  return line;
+}
+
+uint32_t InputJournal::importFrom(const char *text) {
+  clear();
+  const char *cursor = text;
+  while (0 != *cursor) {
+    cursor = skipLogPrefix(cursor);
+    char *end;
+    int64_t time = strtoll(cursor, &end, 10);
+    if (end == cursor) {
+      break;
+    }
+    unsigned long fields[5];
+    for (uint8_t i = 0; i < 5; i++) {
+      cursor = end;
+      fields[i] = strtoul(cursor, &end, 10);
+    }
+    recordAt(time, (InputJournalKind)fields[0], fields[1], fields[2],
+             fields[3], fields[4]);
+    cursor = end;
+    while (0 != *cursor && '\n' != *cursor) {
+      ++cursor; // e.g. the color codes of the log
+    }
+    while ('\n' == *cursor || '\r' == *cursor) {
+      ++cursor;
+    }
+  }
+  return getSize();
+}
+
+bool InputJournal::measure(InputJournalKind from, InputJournalKind to,
+                           InputLatency *latency) {
+  *latency = {.count = 0, .min = 0, .max = 0, .total = 0};
+  bool hasStart = false;
+  int64_t start = 0;
+  uint32_t count = getSize();
+  for (uint32_t i = 0; i < count; i++) {
+    const InputJournalEntry *entry = get(i);
+    if (from == entry->kind && !hasStart) {
+      start = entry->time;
+      hasStart = true;
+    } else if (to == entry->kind && hasStart) {
+      int64_t delay = entry->time - start;
+      if (0 == latency->count || delay < latency->min) {
+        latency->min = delay;
+      }
+      if (0 == latency->count || delay > latency->max) {
+        latency->max = delay;
+      }
+      latency->total += delay;
+      ++latency->count;
+      hasStart = false; // one measure per start
+    }
+  }
+  return 0 < latency->count;
+}
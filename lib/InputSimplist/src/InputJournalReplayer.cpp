@@ -0,0 +1,60 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "InputJournalReplayer.hpp"
+
+int64_t InputJournalReplayer::simulatedNow = 0;
+
+InputJournalReplayer::~InputJournalReplayer() {}
+// write code here...
+
+void InputJournalReplayer::runUntil(int64_t until) {
+  uint32_t deadline;
+  while (recognizer->getNextDeadline(&deadline) &&
+         (int64_t)deadline * 1000 <= until) {
+    if ((int64_t)deadline * 1000 > simulatedNow) {
+      simulatedNow = (int64_t)deadline * 1000;
+    }
+    recognizer->tick(deadline);
+  }
+  simulatedNow = until;
+}
+
+uint32_t InputJournalReplayer::replay(InputJournal *recorded,
+                                      int64_t settleMicros) {
+  uint32_t replayed = 0;
+  uint32_t count = recorded->getSize();
+  for (uint32_t i = 0; i < count; i++) {
+    const InputJournalEntry *entry = recorded->get(i);
+    if (INPUT_JOURNAL_STATE_CHANGE != entry->kind) {
+      continue;
+    }
+    if (0 == replayed) {
+      simulatedNow = entry->time;
+    }
+    runUntil(entry->time);
+    output->record(INPUT_JOURNAL_STATE_CHANGE, entry->source, entry->code);
+    recognizer->update(entry->source, 0 != entry->code,
+                       (uint32_t)(entry->time / 1000));
+    ++replayed;
+  }
+  if (0 < replayed) {
+    runUntil(simulatedNow + settleMicros);
+  }
+  return replayed;
+}
@@ -0,0 +1,85 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "RotaryAccelerator.hpp"
+
+//**@brief A pause that long resets the speed.
+static const uint32_t ROTARY_IDLE_RESET_MS = 300;
+
+RotaryAccelerator::~RotaryAccelerator() {}
+// write code here...
+
+int32_t RotaryAccelerator::update(int32_t count, uint32_t elapsedMs) {
+  if (!started) {
+    started = true;
+    lastCount = count;
+    return 0;
+  }
+  // wrap around safe
+  int32_t delta = (int32_t)((uint32_t)count - (uint32_t)lastCount);
+  lastCount = count;
+
+  // time since the previous movement, the slow rotations giving one count
+  // every few updates
+  uint32_t movingMs = idleMs + elapsedMs;
+  if (0 == delta) {
+    idleMs = movingMs;
+    if (ROTARY_IDLE_RESET_MS <= idleMs) {
+      speed16 = 0;
+      pendingCounts = 0; // drop half a detent left alone
+    }
+    return 0;
+  }
+  idleMs = 0;
+
+  int8_t newDirection = (0 < delta) ? 1 : -1;
+  if (newDirection != direction) {
+    direction = newDirection;
+    speed16 = 0;
+  }
+
+  pendingCounts += delta;
+  int32_t detents = pendingCounts / profile->countsPerDetent;
+  pendingCounts -= detents * profile->countsPerDetent;
+  // the steps use the speed known so far, a reversal starts slow
+  int32_t steps = detents * getStepsPerDetent();
+
+  // smoothing : speed = 3/4 speed + 1/4 instant speed
+  uint32_t absoluteDelta = (0 < delta) ? delta : -delta;
+  uint32_t instant16 = (0 < movingMs) ? absoluteDelta * 16000 /
+                                            profile->countsPerDetent /
+                                            movingMs
+                                      : speed16;
+  speed16 = (0 == speed16) ? instant16 : (3 * speed16 + instant16) / 4;
+
+  return steps;
+}
+
+uint8_t RotaryAccelerator::getStepsPerDetent() {
+  uint32_t speed = speed16 / 16;
+  if (speed <= profile->slowDetentsPerSecond) {
+    return 1;
+  }
+  if (speed >= profile->fastDetentsPerSecond) {
+    return profile->maxStepsPerDetent;
+  }
+  // linear in between
+  return 1 + (profile->maxStepsPerDetent - 1) *
+                 (speed - profile->slowDetentsPerSecond) /
+                 (profile->fastDetentsPerSecond - profile->slowDetentsPerSecond);
+}
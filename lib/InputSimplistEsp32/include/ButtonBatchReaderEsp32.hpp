@@ -0,0 +1,87 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist for ESP32'.
+// ---
+// 'Input Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef BUTTON_BATCH_READER_ESP32_HPP
+#define BUTTON_BATCH_READER_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "driver/gpio.h"
+#include "esp_log.h"
+#include "soc/gpio_reg.h"
+#include "soc/soc.h"
+
+// project includes
+#include "InputButton.hpp"
+#include "VerticalCounterDebouncer.hpp"
+
+//**@brief Maximum number of buttons.
+const uint8_t BUTTON_BATCH_MAX = 8;
+
+/** @brief Sample all the buttons with one read of the input registers, and
+ * debounce them all at once.
+ *
+ * The buttons are updated only when their debounced level changes, so their
+ * listeners receive the same events as with a per button debouncer. The
+ * buttons are expected to be created without debouncer.
+ */
+class ButtonBatchReaderEsp32 {
+private:
+  InputButton *buttons[BUTTON_BATCH_MAX];
+  uint8_t pins[BUTTON_BATCH_MAX];
+  uint8_t count = 0;
+  uint64_t mask = 0;
+  VerticalCounterDebouncer debouncer;
+
+public:
+  virtual ~ButtonBatchReaderEsp32();
+
+  /**
+   * @brief Register a button, its id being the GPIO number.
+   *
+   * @param button the button.
+   * @return ButtonBatchReaderEsp32* the reader.
+   */
+  ButtonBatchReaderEsp32 *withButton(InputButton *button);
+
+  /**
+   * @brief Configure the inputs and start from their current levels, once all
+   * the buttons are registered.
+   */
+  void start();
+
+  /**
+   * @brief Read GPIO 0 to 39 at once.
+   *
+   * @return uint64_t the levels, bit n being GPIO n.
+   */
+  static uint64_t sample() {
+    // GPIO_IN1_REG : GPIO 32 to 39 in bits 0 to 7
+    return (uint64_t)REG_READ(GPIO_IN_REG) |
+           ((uint64_t)(REG_READ(GPIO_IN1_REG) & 0xff) << 32);
+  }
+
+  /**
+   * @brief Sample, debounce and update the buttons that changed.
+   *
+   * @return true when a button has changed.
+   */
+  bool update();
+};
+
+#endif
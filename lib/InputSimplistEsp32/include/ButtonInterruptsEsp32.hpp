@@ -0,0 +1,134 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist for ESP32'.
+// ---
+// 'Input Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef BUTTON_INTERRUPTS_ESP32_HPP
+#define BUTTON_INTERRUPTS_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "driver/gpio.h"
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+// project includes
+#include "InputButton.hpp"
+#include "InputJournal.hpp"
+
+//**@brief Maximum number of buttons.
+const uint8_t BUTTON_INTERRUPTS_MAX = 8;
+
+/** @brief Update buttons from GPIO interrupts instead of polling them.
+ *
+ * Each input has a level interrupt armed for the opposite of its current
+ * level, so that it also wakes the chip up from light sleep. On interrupt, the
+ * input is disarmed and the new level is given at once to the button ; a one
+ * shot timer then lets the contact settle, reads the level again (a change
+ * during the bounces is not lost) and arms the input again.
+ *
+ * The buttons are updated by the task calling `waitForChange()`, so that
+ * their listeners run in that task.
+ *
+ * The buttons are expected to be created without debouncer.
+ */
+class ButtonInterruptsEsp32 {
+private:
+  struct Channel {
+    ButtonInterruptsEsp32 *owner;
+    InputButton *button;
+    gpio_num_t pin;
+    uint8_t index;
+    esp_timer_handle_t settleTimer;
+    int accepted;
+  };
+  struct Event {
+    uint8_t index;
+    bool settled;
+  };
+
+  Channel channels[BUTTON_INTERRUPTS_MAX];
+  uint8_t count = 0;
+  QueueHandle_t events;
+  int64_t settleMicros;
+  uint32_t interruptCount = 0;
+  uint32_t changeCount = 0;
+  InputJournal *journal = nullptr;
+
+  static void onInterrupt(void *arg);
+  static void onSettled(void *arg);
+
+  /**
+   * @brief Interrupt on the next change of level.
+   */
+  void arm(Channel *channel);
+
+  /**
+   * @brief Give the level to the button, then let the contact settle.
+   */
+  void accept(Channel *channel, int level);
+
+public:
+  /**
+   * @brief Setup the service.
+   *
+   * @param settleMs the time to let the contacts settle after a change.
+   */
+  ButtonInterruptsEsp32(uint32_t settleMs);
+  virtual ~ButtonInterruptsEsp32();
+
+  /**
+   * @brief Register a button, its id being the GPIO number.
+   *
+   * @param button the button.
+   * @return ButtonInterruptsEsp32* the service.
+   */
+  ButtonInterruptsEsp32 *withButton(InputButton *button);
+
+  /**
+   * @brief Record the interrupts (`INPUT_JOURNAL_EDGE`) into the journal.
+   */
+  ButtonInterruptsEsp32 *withJournal(InputJournal *journal) {
+    this->journal = journal;
+    return this;
+  }
+
+  /**
+   * @brief Configure the inputs and arm the interrupts, once all the buttons
+   * are registered.
+   *
+   * @return true when all the inputs are armed.
+   */
+  bool start();
+
+  /**
+   * @brief Wait for the next interrupt or end of settling, and update the
+   * button accordingly.
+   *
+   * @param timeout the maximum time to wait, `portMAX_DELAY` to sleep until
+   * there is some activity.
+   * @return true when a button has changed.
+   */
+  bool waitForChange(TickType_t timeout);
+
+  uint32_t getInterruptCount() { return interruptCount; }
+  uint32_t getChangeCount() { return changeCount; }
+};
+
+#endif
@@ -0,0 +1,65 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist for ESP32'.
+// ---
+// 'Input Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef ROTARY_ENCODER_PCNT_ESP32_HPP
+#define ROTARY_ENCODER_PCNT_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "driver/pulse_cnt.h"
+#include "esp_log.h"
+
+// project includes
+
+//**@brief Pulses shorter than that are glitches.
+const uint32_t ROTARY_GLITCH_FILTER_NS = 1000;
+
+/** @brief Decode a quadrature rotary encoder with the pulse counter.
+ *
+ * Both edges of both channels are counted (4 counts per full cycle), in
+ * hardware, so that no edge is lost whatever the load of the cpu. The count is
+ * accumulated over the overflows of the 16 bits counter, it is to be read
+ * periodically, e.g. to feed a `RotaryAccelerator`.
+ */
+class RotaryEncoderPcntEsp32 {
+private:
+  gpio_num_t pinA;
+  gpio_num_t pinB;
+  pcnt_unit_handle_t unit = nullptr;
+
+public:
+  RotaryEncoderPcntEsp32(gpio_num_t pinA, gpio_num_t pinB)
+      : pinA(pinA), pinB(pinB) {}
+  virtual ~RotaryEncoderPcntEsp32();
+
+  /**
+   * @brief Setup the pulse counter and start counting.
+   *
+   * @return true when successful.
+   */
+  bool start();
+
+  /**
+   * @brief Get the count accumulated since the start.
+   *
+   * @return int32_t the count, wrapping around.
+   */
+  int32_t getCount();
+};
+
+#endif
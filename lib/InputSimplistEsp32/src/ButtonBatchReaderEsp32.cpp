@@ -0,0 +1,49 @@
+
+// header include
+#include "ButtonBatchReaderEsp32.hpp"
+
+static constexpr char *TAG = (char *)"ButtonBatchReaderEsp32";
+
+ButtonBatchReaderEsp32::~ButtonBatchReaderEsp32() {}
+// write code here...
+
+ButtonBatchReaderEsp32 *
+ButtonBatchReaderEsp32::withButton(InputButton *button) {
+  uint8_t pin = (uint8_t)button->getId();
+  if (BUTTON_BATCH_MAX <= count || GPIO_NUM_MAX <= pin) {
+    ESP_LOGE(TAG, "Cannot read GPIO %d.", pin);
+    return this;
+  }
+  buttons[count] = button;
+  pins[count] = pin;
+  mask |= 1ULL << pin;
+  ++count;
+  return this;
+}
+
+void ButtonBatchReaderEsp32::start() {
+  gpio_config_t config = {.pin_bit_mask = mask,
+                          .mode = GPIO_MODE_INPUT,
+                          .pull_up_en = GPIO_PULLUP_DISABLE,
+                          .pull_down_en = GPIO_PULLDOWN_DISABLE,
+                          .intr_type = GPIO_INTR_DISABLE};
+  ESP_ERROR_CHECK(gpio_config(&config));
+  uint64_t levels = sample();
+  debouncer.reset(mask, levels);
+  for (uint8_t i = 0; i < count; i++) {
+    buttons[i]->update(debouncer.isHigh(pins[i]));
+  }
+}
+
+bool ButtonBatchReaderEsp32::update() {
+  uint64_t toggled = debouncer.update(sample());
+  if (0 == toggled) {
+    return false; // the usual case
+  }
+  for (uint8_t i = 0; i < count; i++) {
+    if (0 != (toggled & (1ULL << pins[i]))) {
+      buttons[i]->update(debouncer.isHigh(pins[i]));
+    }
+  }
+  return true;
+}
@@ -0,0 +1,124 @@
+
+// header include
+#include "ButtonInterruptsEsp32.hpp"
+
+static constexpr char *TAG = (char *)"ButtonInterruptsEsp32";
+
+ButtonInterruptsEsp32::~ButtonInterruptsEsp32() {}
+// write code here...
+
+ButtonInterruptsEsp32::ButtonInterruptsEsp32(uint32_t settleMs)
+    : settleMicros((int64_t)settleMs * 1000) {
+  // at most one pending event of each kind per input, the queue cannot overflow
+  events = xQueueCreate(2 * BUTTON_INTERRUPTS_MAX, sizeof(Event));
+}
+
+ButtonInterruptsEsp32 *ButtonInterruptsEsp32::withButton(InputButton *button) {
+  if (BUTTON_INTERRUPTS_MAX <= count) {
+    ESP_LOGE(TAG, "Too many buttons, GPIO %d ignored.", (int)button->getId());
+    return this;
+  }
+  Channel *channel = &channels[count];
+  channel->owner = this;
+  channel->button = button;
+  channel->pin = gpio_num_t(button->getId());
+  channel->index = count;
+  channel->settleTimer = nullptr;
+  channel->accepted = 1;
+  ++count;
+  return this;
+}
+
+bool ButtonInterruptsEsp32::start() {
+  esp_err_t err = gpio_install_isr_service(0);
+  if (ESP_OK != err && ESP_ERR_INVALID_STATE != err) { // already installed
+    ESP_LOGE(TAG, "Could not install the ISR service (%s).",
+             esp_err_to_name(err));
+    return false;
+  }
+  bool success = true;
+  for (uint8_t i = 0; i < count; i++) {
+    Channel *channel = &channels[i];
+    gpio_config_t config = {.pin_bit_mask = 1ULL << channel->pin,
+                            .mode = GPIO_MODE_INPUT,
+                            .pull_up_en = GPIO_PULLUP_DISABLE,
+                            .pull_down_en = GPIO_PULLDOWN_DISABLE,
+                            .intr_type = GPIO_INTR_DISABLE};
+    esp_timer_create_args_t timerArgs = {.callback = onSettled,
+                                         .arg = channel,
+                                         .dispatch_method = ESP_TIMER_TASK,
+                                         .name = "button-settle",
+                                         .skip_unhandled_events = true};
+    if (ESP_OK != gpio_config(&config) ||
+        ESP_OK != esp_timer_create(&timerArgs, &channel->settleTimer) ||
+        ESP_OK != gpio_isr_handler_add(channel->pin, onInterrupt, channel)) {
+      ESP_LOGE(TAG, "Could not setup GPIO %d.", channel->pin);
+      success = false;
+      continue;
+    }
+    channel->accepted = gpio_get_level(channel->pin);
+    channel->button->update(channel->accepted);
+    arm(channel);
+  }
+  esp_sleep_enable_gpio_wakeup();
+  return success;
+}
+
+void ButtonInterruptsEsp32::arm(Channel *channel) {
+  gpio_int_type_t type =
+      channel->accepted ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL;
+  gpio_set_intr_type(channel->pin, type);
+  gpio_wakeup_enable(channel->pin, type);
+  gpio_intr_enable(channel->pin);
+}
+
+void ButtonInterruptsEsp32::onInterrupt(void *arg) {
+  Channel *channel = (Channel *)arg;
+  // level triggered : disarm until handled
+  gpio_intr_disable(channel->pin);
+  if (nullptr != channel->owner->journal) {
+    channel->owner->journal->record(INPUT_JOURNAL_EDGE, channel->pin,
+                                    gpio_get_level(channel->pin));
+  }
+  Event event = {.index = channel->index, .settled = false};
+  BaseType_t woken = pdFALSE;
+  xQueueSendFromISR(channel->owner->events, &event, &woken);
+  if (woken) {
+    portYIELD_FROM_ISR();
+  }
+}
+
+void ButtonInterruptsEsp32::onSettled(void *arg) {
+  Channel *channel = (Channel *)arg;
+  Event event = {.index = channel->index, .settled = true};
+  xQueueSend(channel->owner->events, &event, 0);
+}
+
+void ButtonInterruptsEsp32::accept(Channel *channel, int level) {
+  channel->accepted = level;
+  ++changeCount;
+  channel->button->update(level);
+}
+
+bool ButtonInterruptsEsp32::waitForChange(TickType_t timeout) {
+  Event event;
+  if (pdTRUE != xQueueReceive(events, &event, timeout)) {
+    return false;
+  }
+  Channel *channel = &channels[event.index];
+  int level = gpio_get_level(channel->pin);
+  bool changed = (level != channel->accepted);
+  if (!event.settled) {
+    ++interruptCount;
+  }
+  if (changed) {
+    accept(channel, level);
+  }
+  if (changed || !event.settled) {
+    // bouncing, or too short a glitch : wait again
+    esp_timer_start_once(channel->settleTimer, settleMicros);
+  } else {
+    arm(channel);
+  }
+  return changed;
+}
@@ -0,0 +1,66 @@
+
+// header include
+#include "RotaryEncoderPcntEsp32.hpp"
+
+static constexpr char *TAG = (char *)"RotaryEncoderPcntEsp32";
+
+//**@brief Limits of the hardware counter, the count is accumulated beyond.
+static const int ROTARY_PCNT_HIGH_LIMIT = 10000;
+static const int ROTARY_PCNT_LOW_LIMIT = -10000;
+
+RotaryEncoderPcntEsp32::~RotaryEncoderPcntEsp32() {}
+// write code here...
+
+bool RotaryEncoderPcntEsp32::start() {
+  pcnt_unit_config_t unitConfig = {.low_limit = ROTARY_PCNT_LOW_LIMIT,
+                                   .high_limit = ROTARY_PCNT_HIGH_LIMIT,
+                                   .intr_priority = 0,
+                                   .flags = {.accum_count = 1}};
+  if (ESP_OK != pcnt_new_unit(&unitConfig, &unit)) {
+    ESP_LOGE(TAG, "Could not get a pulse counter unit.");
+    return false;
+  }
+  pcnt_glitch_filter_config_t filterConfig = {.max_glitch_ns =
+                                                  ROTARY_GLITCH_FILTER_NS};
+  pcnt_unit_set_glitch_filter(unit, &filterConfig);
+
+  // channel a counts the edges of A, channel b the edges of B, the other
+  // signal giving the direction
+  pcnt_chan_config_t configA = {.edge_gpio_num = pinA, .level_gpio_num = pinB};
+  pcnt_chan_config_t configB = {.edge_gpio_num = pinB, .level_gpio_num = pinA};
+  pcnt_channel_handle_t channelA = nullptr;
+  pcnt_channel_handle_t channelB = nullptr;
+  if (ESP_OK != pcnt_new_channel(unit, &configA, &channelA) ||
+      ESP_OK != pcnt_new_channel(unit, &configB, &channelB)) {
+    ESP_LOGE(TAG, "Could not setup the channels on GPIO %d and %d.", pinA,
+             pinB);
+    return false;
+  }
+  pcnt_channel_set_edge_action(channelA, PCNT_CHANNEL_EDGE_ACTION_DECREASE,
+                               PCNT_CHANNEL_EDGE_ACTION_INCREASE);
+  pcnt_channel_set_level_action(channelA, PCNT_CHANNEL_LEVEL_ACTION_KEEP,
+                                PCNT_CHANNEL_LEVEL_ACTION_INVERSE);
+  pcnt_channel_set_edge_action(channelB, PCNT_CHANNEL_EDGE_ACTION_INCREASE,
+                               PCNT_CHANNEL_EDGE_ACTION_DECREASE);
+  pcnt_channel_set_level_action(channelB, PCNT_CHANNEL_LEVEL_ACTION_KEEP,
+                                PCNT_CHANNEL_LEVEL_ACTION_INVERSE);
+
+  // the watch points at the limits let the driver accumulate the overflows
+  pcnt_unit_add_watch_point(unit, ROTARY_PCNT_HIGH_LIMIT);
+  pcnt_unit_add_watch_point(unit, ROTARY_PCNT_LOW_LIMIT);
+
+  if (ESP_OK != pcnt_unit_enable(unit) || ESP_OK != pcnt_unit_clear_count(unit) ||
+      ESP_OK != pcnt_unit_start(unit)) {
+    ESP_LOGE(TAG, "Could not start the pulse counter.");
+    return false;
+  }
+  return true;
+}
+
+int32_t RotaryEncoderPcntEsp32::getCount() {
+  int count = 0;
+  if (nullptr != unit) {
+    pcnt_unit_get_count(unit, &count);
+  }
+  return count;
+}
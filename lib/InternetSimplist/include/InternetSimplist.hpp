@@ -25,6 +25,7 @@
 // project includes
 #include "InternetSimplistTypes.hpp"
 #include "HostConfigurationEventListener.hpp"
+#include "UdpEndpoint.hpp"
 
 //write code here
 
@@ -61,4 +61,15 @@ typedef struct {
   IpAddress defaultGateway ;
 } HostConfigurationDescription ;
 
+//**@brief Value of a timeout to wait without limit.
+const uint32_t UDP_WAIT_FOREVER = UINT32_MAX;
+
+/**
+ * @brief One end of an UDP exchange, IPv4 only (`v4` field of the address).
+ */
+typedef struct {
+  IpAddress address;
+  uint16_t port;
+} UdpPeer;
+
 #endif
\ No newline at end of file
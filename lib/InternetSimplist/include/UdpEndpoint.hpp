@@ -0,0 +1,95 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Internet Simplist'.
+// ---
+// 'Internet Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Internet Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Internet Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef UDP_ENDPOINT_HPP
+#define UDP_ENDPOINT_HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "InternetSimplistTypes.hpp"
+
+/** @brief Interface of an UDP endpoint (IPv4), to send and receive datagrams.
+ *
+ * Protocols are written against this interface, so that they can run on the
+ * target with the actual network stack, and on the host with either real
+ * sockets or a simulated network.
+ */
+class UdpEndpoint {
+public:
+  virtual ~UdpEndpoint();
+
+  /**
+   * @brief Open the endpoint, listening on the given local port.
+   *
+   * @param localPort the local port to bind to, 0 to let the stack choose.
+   * @param acceptBroadcast when `true`, the endpoint can send and receive
+   * broadcast datagrams.
+   * @return true when the endpoint is ready to use.
+   */
+  virtual bool open(uint16_t localPort, bool acceptBroadcast) = 0;
+
+  /**
+   * @brief Subscribe to the given multicast group, the endpoint must be open.
+   *
+   * @param group the IPv4 address of the group.
+   * @return true when the subscription succeeded.
+   */
+  virtual bool joinMulticastGroup(const IpAddress *group) = 0;
+
+  /**
+   * @brief Send a datagram.
+   *
+   * @param to the recipient.
+   * @param data the payload.
+   * @param length the size of the payload.
+   * @return int the number of bytes sent, or -1 on error.
+   */
+  virtual int sendTo(const UdpPeer *to, const uint8_t *data,
+                     size_t length) = 0;
+
+  /**
+   * @brief Wait for a datagram.
+   *
+   * @param buffer where to store the payload.
+   * @param capacity the size of the buffer.
+   * @param from where to store the sender, may be `nullptr`.
+   * @param timeoutMs how long to wait, `UDP_WAIT_FOREVER` to wait forever.
+   * @return int the size of the payload, 0 on timeout, -1 on error.
+   */
+  virtual int receiveFrom(uint8_t *buffer, size_t capacity, UdpPeer *from,
+                          uint32_t timeoutMs) = 0;
+
+  /**
+   * @brief Release the endpoint, it can be opened again afterwards.
+   */
+  virtual void close() = 0;
+
+  /**
+   * @brief Get the IPv4 address of the given host name.
+   *
+   * @param hostname the name to resolve, or a dotted IPv4 address.
+   * @param result where to store the address.
+   * @return true when the name has been resolved.
+   */
+  virtual bool resolve(const char *hostname, IpAddress *result) = 0;
+};
+
+#endif
@@ -0,0 +1,74 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Internet Simplist'.
+// ---
+// 'Internet Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Internet Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Internet Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef UDP_ENDPOINT_USING_SOCKETS_HPP
+#define UDP_ENDPOINT_USING_SOCKETS_HPP
+
+// standard includes
+#include <cstdint>
+#include <cstring>
+
+// esp32 includes -- the lwip port provides the BSD sockets API, so this
+// implementation works on the target and on the host.
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// project includes
+#include "InternetSimplist.hpp"
+
+/** @brief UDP endpoint implemented with the BSD sockets API.
+ */
+class UdpEndpointUsingSockets : public UdpEndpoint {
+private:
+  /**
+   * @brief The socket, or -1 when closed.
+   */
+  int socketDescriptor = -1;
+
+  static void toSocketAddress(const UdpPeer *peer, struct sockaddr_in *addr);
+  static void fromSocketAddress(const struct sockaddr_in *addr, UdpPeer *peer);
+
+public:
+  virtual ~UdpEndpointUsingSockets();
+
+  /**
+   * @brief Tells whether the endpoint has been opened.
+   *
+   * @return true when open.
+   */
+  bool isOpen() { return socketDescriptor >= 0; }
+
+  /**
+   * @brief Get the local port actually bound, useful after opening on port 0.
+   *
+   * @return uint16_t the port, or 0 when closed.
+   */
+  uint16_t getLocalPort();
+
+  virtual bool open(uint16_t localPort, bool acceptBroadcast);
+  virtual bool joinMulticastGroup(const IpAddress *group);
+  virtual int sendTo(const UdpPeer *to, const uint8_t *data, size_t length);
+  virtual int receiveFrom(uint8_t *buffer, size_t capacity, UdpPeer *from,
+                          uint32_t timeoutMs);
+  virtual void close();
+  virtual bool resolve(const char *hostname, IpAddress *result);
+};
+
+#endif
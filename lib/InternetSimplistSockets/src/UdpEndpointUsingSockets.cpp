@@ -0,0 +1,155 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Internet Simplist'.
+// ---
+// 'Internet Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Internet Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Internet Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "UdpEndpointUsingSockets.hpp"
+
+UdpEndpointUsingSockets::~UdpEndpointUsingSockets() { close(); }
+// write code here...
+
+void UdpEndpointUsingSockets::toSocketAddress(const UdpPeer *peer,
+                                              struct sockaddr_in *addr) {
+  memset(addr, 0, sizeof(struct sockaddr_in));
+  addr->sin_family = AF_INET;
+  addr->sin_port = htons(peer->port);
+  memcpy(&addr->sin_addr.s_addr, peer->address.v4, SIZE_OF_IPV4);
+}
+
+void UdpEndpointUsingSockets::fromSocketAddress(const struct sockaddr_in *addr,
+                                                UdpPeer *peer) {
+  memcpy(peer->address.v4, &addr->sin_addr.s_addr, SIZE_OF_IPV4);
+  peer->port = ntohs(addr->sin_port);
+}
+
+bool UdpEndpointUsingSockets::open(uint16_t localPort, bool acceptBroadcast) {
+  if (isOpen()) {
+    close();
+  }
+  socketDescriptor = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (socketDescriptor < 0) {
+    return false;
+  }
+  int enabled = 1;
+  setsockopt(socketDescriptor, SOL_SOCKET, SO_REUSEADDR, &enabled,
+             sizeof(enabled));
+  if (acceptBroadcast &&
+      0 != setsockopt(socketDescriptor, SOL_SOCKET, SO_BROADCAST, &enabled,
+                      sizeof(enabled))) {
+    close();
+    return false;
+  }
+  struct sockaddr_in local;
+  memset(&local, 0, sizeof(local));
+  local.sin_family = AF_INET;
+  local.sin_port = htons(localPort);
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (0 != bind(socketDescriptor, (struct sockaddr *)&local, sizeof(local))) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+uint16_t UdpEndpointUsingSockets::getLocalPort() {
+  if (!isOpen()) {
+    return 0;
+  }
+  struct sockaddr_in local;
+  socklen_t length = sizeof(local);
+  if (0 != getsockname(socketDescriptor, (struct sockaddr *)&local, &length)) {
+    return 0;
+  }
+  return ntohs(local.sin_port);
+}
+
+bool UdpEndpointUsingSockets::joinMulticastGroup(const IpAddress *group) {
+  if (!isOpen()) {
+    return false;
+  }
+  struct ip_mreq request;
+  memset(&request, 0, sizeof(request));
+  memcpy(&request.imr_multiaddr.s_addr, group->v4, SIZE_OF_IPV4);
+  request.imr_interface.s_addr = htonl(INADDR_ANY);
+  return 0 == setsockopt(socketDescriptor, IPPROTO_IP, IP_ADD_MEMBERSHIP,
+                         &request, sizeof(request));
+}
+
+int UdpEndpointUsingSockets::sendTo(const UdpPeer *to, const uint8_t *data,
+                                    size_t length) {
+  if (!isOpen()) {
+    return -1;
+  }
+  struct sockaddr_in recipient;
+  toSocketAddress(to, &recipient);
+  return sendto(socketDescriptor, data, length, 0,
+                (struct sockaddr *)&recipient, sizeof(recipient));
+}
+
+int UdpEndpointUsingSockets::receiveFrom(uint8_t *buffer, size_t capacity,
+                                         UdpPeer *from, uint32_t timeoutMs) {
+  if (!isOpen()) {
+    return -1;
+  }
+  if (UDP_WAIT_FOREVER != timeoutMs) {
+    fd_set readable;
+    FD_ZERO(&readable);
+    FD_SET(socketDescriptor, &readable);
+    struct timeval timeout = {.tv_sec = (time_t)(timeoutMs / 1000),
+                              .tv_usec = (suseconds_t)(timeoutMs % 1000) *
+                                         1000};
+    int ready =
+        select(socketDescriptor + 1, &readable, nullptr, nullptr, &timeout);
+    if (ready < 0) {
+      return -1;
+    }
+    if (0 == ready) {
+      return 0;
+    }
+  }
+  struct sockaddr_in sender;
+  socklen_t senderLength = sizeof(sender);
+  int received = recvfrom(socketDescriptor, buffer, capacity, 0,
+                          (struct sockaddr *)&sender, &senderLength);
+  if (received >= 0 && nullptr != from) {
+    fromSocketAddress(&sender, from);
+  }
+  return received;
+}
+
+void UdpEndpointUsingSockets::close() {
+  if (isOpen()) {
+    ::close(socketDescriptor);
+    socketDescriptor = -1;
+  }
+}
+
+bool UdpEndpointUsingSockets::resolve(const char *hostname,
+                                      IpAddress *result) {
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_DGRAM;
+  struct addrinfo *found = nullptr;
+  if (0 != getaddrinfo(hostname, nullptr, &hints, &found) ||
+      nullptr == found) {
+    return false;
+  }
+  memcpy(result->v4, &((struct sockaddr_in *)found->ai_addr)->sin_addr.s_addr,
+         SIZE_OF_IPV4);
+  freeaddrinfo(found);
+  return true;
+}
@@ -0,0 +1,57 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Menu Simplist'.
+// ---
+// 'Menu Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Menu Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Menu Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef MENU_LISTENER_HPP
+#define MENU_LISTENER_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+/** @brief What the items of a menu act upon.
+ */
+class MenuListener {
+public:
+  virtual ~MenuListener();
+
+  /**
+   * @brief An action has been selected.
+   *
+   * @param id the id of the action.
+   */
+  virtual void onMenuAction(uint8_t id) = 0;
+
+  /**
+   * @brief Get the current value, to start editing it.
+   *
+   * @param id the id of the value.
+   * @return int16_t the value.
+   */
+  virtual int16_t getMenuValue(uint8_t id) = 0;
+
+  /**
+   * @brief A new value has been confirmed.
+   *
+   * @param id the id of the value.
+   * @param value the value.
+   */
+  virtual void onMenuValue(uint8_t id, int16_t value) = 0;
+};
+
+#endif
@@ -0,0 +1,90 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Menu Simplist'.
+// ---
+// 'Menu Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Menu Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Menu Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef MENU_NAVIGATOR_HPP
+#define MENU_NAVIGATOR_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "MenuListener.hpp"
+#include "MenuSimplistTypes.hpp"
+
+/** @brief Browse a menu tree with four keys, the tree being a constant table.
+ *
+ * The only state is a cursor (the current item, and the value being edited),
+ * there is no allocation, and adding items to the table does not change the
+ * size of the navigator.
+ *
+ * * 'up' and 'down' go to the previous and the next sibling (wrapping around),
+ * or change the value being edited ;
+ * * 'select' goes down into a submenu, triggers an action, starts editing a
+ * value or confirms the edited value ;
+ * * 'back' cancels the edited value, or goes up to the parent, or closes the
+ * menu from the top level.
+ */
+class MenuNavigator {
+private:
+  const MenuItem *items;
+  MenuListener *listener = nullptr;
+  uint8_t current = 0;
+  bool active = false;
+  bool editing = false;
+  int16_t value = 0;
+
+  void moveAmongSiblings(int8_t direction);
+
+public:
+  /**
+   * @brief Setup the navigator.
+   *
+   * @param items the tree, the root being the first item.
+   */
+  MenuNavigator(const MenuItem *items) : items(items) {}
+  virtual ~MenuNavigator();
+
+  MenuNavigator *withListener(MenuListener *listener) {
+    this->listener = listener;
+    return this;
+  }
+
+  /**
+   * @brief Open the menu on the first child of the root.
+   */
+  void open();
+  void up();
+  void down();
+  void select();
+  void back();
+
+  /**
+   * @brief Write what is to be displayed : the label of the current item, or
+   * the value being edited.
+   *
+   * @param buffer at least 5 characters, 4 and the terminator.
+   */
+  void format(char *buffer);
+
+  bool isActive() { return active; }
+  bool isEditing() { return editing; }
+  const MenuItem *getCurrent() { return &items[current]; }
+  int16_t getValue() { return value; }
+};
+
+#endif
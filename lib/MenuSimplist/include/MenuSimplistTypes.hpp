@@ -0,0 +1,91 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Menu Simplist'.
+// ---
+// 'Menu Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Menu Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Menu Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef MENU_SIMPLIST_TYPES_HPP
+#define MENU_SIMPLIST_TYPES_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+/**
+ * @brief What selecting an item does.
+ */
+enum MenuItemType {
+  /**
+   * @brief Go down to the children of the item.
+   */
+  MENU_ITEM_SUBMENU,
+  /**
+   * @brief Call the listener at once.
+   */
+  MENU_ITEM_ACTION,
+  /**
+   * @brief Change a value between bounds, given to the listener when
+   * confirmed.
+   */
+  MENU_ITEM_VALUE
+};
+
+//**@brief The parent of the root.
+const uint8_t MENU_NO_PARENT = 0xff;
+
+/**
+ * @brief An item of a menu tree.
+ *
+ * The whole tree is a single table, to be defined `constexpr` so that it
+ * stays in flash : the root is the first item, the children of an item are
+ * contiguous, and each item knows its parent, so that each move is a lookup
+ * in the table.
+ */
+struct MenuItem {
+  /**
+   * @brief The text to display, 4 characters.
+   */
+  const char *label;
+  MenuItemType type;
+  /**
+   * @brief The action or the value, for the listener.
+   */
+  uint8_t id;
+  uint8_t parent;
+  /**
+   * @brief For a submenu, the index of the first child.
+   */
+  uint8_t firstChild;
+  /**
+   * @brief For a submenu, the number of children.
+   */
+  uint8_t childCount;
+  /**
+   * @brief For a value, the lowest value.
+   */
+  int16_t minValue;
+  /**
+   * @brief For a value, the highest value.
+   */
+  int16_t maxValue;
+  /**
+   * @brief For a value, when not null, the texts to display for each value
+   * from `minValue`, 4 characters each.
+   */
+  const char *const *choices;
+};
+
+#endif
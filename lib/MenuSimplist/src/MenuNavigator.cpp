@@ -0,0 +1,137 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Menu Simplist'.
+// ---
+// 'Menu Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Menu Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Menu Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "MenuNavigator.hpp"
+
+MenuNavigator::~MenuNavigator() {}
+// write code here...
+
+void MenuNavigator::open() {
+  current = items[0].firstChild;
+  active = true;
+  editing = false;
+}
+
+void MenuNavigator::moveAmongSiblings(int8_t direction) {
+  const MenuItem *parent = &items[items[current].parent];
+  uint8_t position = current - parent->firstChild;
+  current = parent->firstChild +
+            (position + parent->childCount + direction) % parent->childCount;
+}
+
+void MenuNavigator::up() {
+  if (!active) {
+    return;
+  }
+  if (editing) {
+    const MenuItem *item = &items[current];
+    value = (value > item->minValue) ? value - 1 : item->maxValue;
+  } else {
+    moveAmongSiblings(-1);
+  }
+}
+
+void MenuNavigator::down() {
+  if (!active) {
+    return;
+  }
+  if (editing) {
+    const MenuItem *item = &items[current];
+    value = (value < item->maxValue) ? value + 1 : item->minValue;
+  } else {
+    moveAmongSiblings(1);
+  }
+}
+
+void MenuNavigator::select() {
+  if (!active) {
+    return;
+  }
+  const MenuItem *item = &items[current];
+  switch (item->type) {
+  case MENU_ITEM_SUBMENU:
+    if (0 < item->childCount) {
+      current = item->firstChild;
+    }
+    break;
+  case MENU_ITEM_ACTION:
+    if (nullptr != listener) {
+      listener->onMenuAction(item->id);
+    }
+    break;
+  case MENU_ITEM_VALUE:
+    if (editing) {
+      editing = false;
+      if (nullptr != listener) {
+        listener->onMenuValue(item->id, value);
+      }
+    } else {
+      editing = true;
+      value = (nullptr != listener) ? listener->getMenuValue(item->id)
+                                    : item->minValue;
+      if (value < item->minValue || value > item->maxValue) {
+        value = item->minValue;
+      }
+    }
+    break;
+  }
+}
+
+void MenuNavigator::back() {
+  if (!active) {
+    return;
+  }
+  if (editing) {
+    editing = false;
+  } else if (0 == items[current].parent) {
+    active = false;
+  } else {
+    current = items[current].parent;
+  }
+}
+
+void MenuNavigator::format(char *buffer) {
+  const MenuItem *item = &items[current];
+  const char *text = item->label;
+  char number[5];
+  if (editing) {
+    if (nullptr != item->choices) {
+      text = item->choices[value - item->minValue];
+    } else {
+      // right aligned, at most 4 characters
+      int16_t absolute = (0 > value) ? -value : value;
+      for (int8_t i = 3; i >= 0; i--) {
+        number[i] = (3 == i || 0 < absolute) ? '0' + absolute % 10 : ' ';
+        absolute /= 10;
+      }
+      if (0 > value) {
+        number[0] = '-';
+      }
+      number[4] = 0;
+      text = number;
+    }
+  }
+  bool endOfText = false;
+  for (uint8_t i = 0; i < 4; i++) {
+    if (0 == text[i]) {
+      endOfText = true;
+    }
+    buffer[i] = endOfText ? ' ' : text[i];
+  }
+  buffer[4] = 0;
+}
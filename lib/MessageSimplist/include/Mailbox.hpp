@@ -0,0 +1,97 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Message Simplist'.
+// ---
+// 'Message Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Message Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Message Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef MAILBOX_HPP
+#define MAILBOX_HPP
+
+// standard includes
+#include <atomic>
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "MessageSimplistTypes.hpp"
+
+/** @brief A bounded queue of messages, with many senders and one receiver.
+ *
+ * Posting and receiving are lock free : each cell has a sequence number
+ * telling whether it is free for the sender at a given position, or filled for
+ * the receiver. A sender never waits, the message is dropped (and counted)
+ * when the mailbox is full.
+ *
+ * The depth and the time spent in the mailbox are measured, the timestamps
+ * coming from the clock given at creation (on the device,
+ * `esp_timer_get_time`).
+ */
+class Mailbox {
+private:
+  struct Cell {
+    std::atomic<uint32_t> sequence;
+    Message message;
+    int64_t postedAt;
+  };
+  Cell cells[MAILBOX_CAPACITY];
+  std::atomic<uint32_t> head{0};
+  std::atomic<uint32_t> tail{0};
+  int64_t (*clock)();
+
+  std::atomic<uint32_t> posted{0};
+  std::atomic<uint32_t> dropped{0};
+  std::atomic<uint32_t> maxDepth{0};
+  uint32_t received = 0;
+  int64_t maxLatency = 0;
+  int64_t totalLatency = 0;
+
+public:
+  /**
+   * @brief Setup the mailbox.
+   *
+   * @param clock the source of timestamps, in microseconds.
+   */
+  Mailbox(int64_t (*clock)());
+  virtual ~Mailbox();
+
+  /**
+   * @brief Post a message, from any task (or interrupt).
+   *
+   * @param message the message, copied.
+   * @return true when posted, false when the mailbox was full.
+   */
+  bool post(const Message *message);
+
+  /**
+   * @brief Take the oldest message, from the receiving task only.
+   *
+   * @param message where to copy the message.
+   * @return true when there was a message.
+   */
+  bool receive(Message *message);
+
+  /**
+   * @brief Get the number of messages waiting.
+   */
+  uint32_t getDepth() { return head.load() - tail.load(); }
+
+  /**
+   * @brief Get the statistics, from the receiving task.
+   *
+   * @param statistics where to copy the statistics.
+   */
+  void getStatistics(MailboxStatistics *statistics);
+};
+
+#endif
@@ -0,0 +1,29 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Message Simplist'.
+// ---
+// 'Message Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Message Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Message Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef MESSAGE_SIMPLIST_HPP
+#define MESSAGE_SIMPLIST_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "Mailbox.hpp"
+#include "MessageSimplistTypes.hpp"
+
+#endif
@@ -0,0 +1,66 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Message Simplist'.
+// ---
+// 'Message Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Message Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Message Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef MESSAGE_SIMPLIST_TYPES_HPP
+#define MESSAGE_SIMPLIST_TYPES_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+//**@brief Number of messages a mailbox can hold, a power of 2.
+const uint32_t MAILBOX_CAPACITY = 16;
+
+/**
+ * @brief A message, its meaning being defined by the receiver.
+ */
+struct Message {
+  uint16_t type;
+  uint16_t code;
+  union {
+    int32_t value;
+    char text[4];
+  };
+};
+
+/**
+ * @brief What happened to a mailbox since its creation.
+ */
+struct MailboxStatistics {
+  uint32_t posted;
+  /**
+   * @brief Messages lost because the mailbox was full.
+   */
+  uint32_t dropped;
+  uint32_t received;
+  /**
+   * @brief Highest number of messages waiting at once.
+   */
+  uint32_t maxDepth;
+  /**
+   * @brief Longest time from posting to receiving, in microseconds.
+   */
+  int64_t maxLatency;
+  /**
+   * @brief Sum of the times from posting to receiving, in microseconds.
+   */
+  int64_t totalLatency;
+};
+
+#endif
@@ -0,0 +1,98 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Message Simplist'.
+// ---
+// 'Message Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Message Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Message Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "Mailbox.hpp"
+
+Mailbox::~Mailbox() {}
+// write code here...
+
+static_assert(0 == (MAILBOX_CAPACITY & (MAILBOX_CAPACITY - 1)),
+              "MAILBOX_CAPACITY must be a power of 2");
+
+Mailbox::Mailbox(int64_t (*clock)()) : clock(clock) {
+  for (uint32_t i = 0; i < MAILBOX_CAPACITY; i++) {
+    cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+bool Mailbox::post(const Message *message) {
+  uint32_t position = head.load(std::memory_order_relaxed);
+  Cell *cell;
+  while (true) {
+    cell = &cells[position & (MAILBOX_CAPACITY - 1)];
+    uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+    int32_t difference = (int32_t)(sequence - position);
+    if (0 == difference) {
+      // free for this position, claim it
+      if (head.compare_exchange_weak(position, position + 1,
+                                     std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (0 > difference) {
+      // still filled from the previous round : full
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      // claimed by another sender meanwhile
+      position = head.load(std::memory_order_relaxed);
+    }
+  }
+  cell->message = *message;
+  cell->postedAt = clock();
+  cell->sequence.store(position + 1, std::memory_order_release);
+
+  posted.fetch_add(1, std::memory_order_relaxed);
+  // may be already received, and more, by now
+  int32_t depth = (int32_t)(position + 1 - tail.load(std::memory_order_relaxed));
+  uint32_t previous = maxDepth.load(std::memory_order_relaxed);
+  while (0 < depth && (uint32_t)depth > previous &&
+         !maxDepth.compare_exchange_weak(previous, depth,
+                                         std::memory_order_relaxed)) {
+  }
+  return true;
+}
+
+bool Mailbox::receive(Message *message) {
+  uint32_t position = tail.load(std::memory_order_relaxed);
+  Cell *cell = &cells[position & (MAILBOX_CAPACITY - 1)];
+  uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+  if ((int32_t)(sequence - (position + 1)) < 0) {
+    return false; // empty, or still being written
+  }
+  *message = cell->message;
+  int64_t latency = clock() - cell->postedAt;
+  // free for the next round
+  cell->sequence.store(position + MAILBOX_CAPACITY, std::memory_order_release);
+  tail.store(position + 1, std::memory_order_relaxed);
+
+  ++received;
+  totalLatency += latency;
+  if (latency > maxLatency) {
+    maxLatency = latency;
+  }
+  return true;
+}
+
+void Mailbox::getStatistics(MailboxStatistics *statistics) {
+  statistics->posted = posted.load();
+  statistics->dropped = dropped.load();
+  statistics->received = received;
+  statistics->maxDepth = maxDepth.load();
+  statistics->maxLatency = maxLatency;
+  statistics->totalLatency = totalLatency;
+}
@@ -0,0 +1,85 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Message Simplist for ESP32'.
+// ---
+// 'Message Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Message Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Message Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef MAILBOX_ESP32_HPP
+#define MAILBOX_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// project includes
+#include "Mailbox.hpp"
+
+/** @brief The mailbox of a task, that sleeps until a message is posted.
+ *
+ * The messages go through the lock free mailbox, the semaphore is only the
+ * wake up call of the receiving task.
+ */
+class MailboxEsp32 {
+private:
+  Mailbox mailbox = Mailbox(esp_timer_get_time);
+  SemaphoreHandle_t wakeUp;
+
+public:
+  MailboxEsp32() { wakeUp = xSemaphoreCreateBinary(); }
+  virtual ~MailboxEsp32();
+
+  /**
+   * @brief Post a message and wake the receiving task up.
+   *
+   * @param message the message, copied.
+   * @return true when posted, false when the mailbox was full.
+   */
+  bool post(const Message *message) {
+    if (!mailbox.post(message)) {
+      return false;
+    }
+    xSemaphoreGive(wakeUp);
+    return true;
+  }
+
+  /**
+   * @brief Take the oldest message, waiting for one if needed.
+   *
+   * @param message where to copy the message.
+   * @param timeout how long to wait at most, 0 to not wait.
+   * @return true when there was a message.
+   */
+  bool receive(Message *message, TickType_t timeout) {
+    if (mailbox.receive(message)) {
+      return true;
+    }
+    // a wake up call may be left from messages already received
+    while (0 < timeout && pdTRUE == xSemaphoreTake(wakeUp, timeout)) {
+      if (mailbox.receive(message)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  uint32_t getDepth() { return mailbox.getDepth(); }
+  void getStatistics(MailboxStatistics *statistics) {
+    mailbox.getStatistics(statistics);
+  }
+};
+
+#endif
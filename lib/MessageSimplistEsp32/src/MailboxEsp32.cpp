@@ -0,0 +1,6 @@
+
+// header include
+#include "MailboxEsp32.hpp"
+
+MailboxEsp32::~MailboxEsp32() {}
+// write code here...
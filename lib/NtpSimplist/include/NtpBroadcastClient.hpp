@@ -0,0 +1,199 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef NTP_BROADCAST_CLIENT_HPP
+#define NTP_BROADCAST_CLIENT_HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "InternetSimplistTypes.hpp"
+#include "NtpPacket.hpp"
+#include "NtpSimplistTypes.hpp"
+
+// clang-format off
+/**
+ * @brief Model of the lifecycle of a broadcast client.
+ *
+ * ```mermaid
+  flowchart TD
+    WAITING_FIRST_BEACON -->|valid beacon, adopt its sender| CALIBRATING
+    CALIBRATING -->|valid unicast reply from the sender| TRACKING
+    CALIBRATING -->|no reply, restart| WAITING_FIRST_BEACON
+    TRACKING -->|beacons from the sender| TRACKING
+ * ```
+ */
+enum NtpBroadcastClientState {
+  // clang-format on
+  /**
+   * @brief Listening, the server is not known yet.
+   */
+  WAITING_FIRST_BEACON,
+  /**
+   * @brief The server is known, a unicast exchange is required to measure the
+   * network delay.
+   */
+  CALIBRATING,
+  /**
+   * @brief Calibrated, each beacon of the server gives the clock offset.
+   */
+  TRACKING
+};
+
+/** @brief Passive NTP client : listen to the beacons of a broadcast (or
+ * multicast) server, and correct the local clock without sending anything.
+ *
+ * The delay between the server and the client is measured once with a unicast
+ * exchange (calibration), then each beacon gives the offset as : `server
+ * transmit timestamp + one way delay - local reception time`.
+ *
+ * This class does no input/output, the caller sends and receives the packets,
+ * and provides the local time of reception. Typical sequence :
+ * ```cpp
+ * if (client.acceptBeacon(packet, size, &sender, now)) {
+ *   apply(client.getOffset());
+ * } else if (client.isCalibrationRequired()) {
+ *   size = client.prepareCalibrationRequest(packet, now);
+ *   send(client.getServer(), packet, size);
+ * }
+ * // when receiving the reply
+ * if (client.acceptCalibrationReply(packet, size, &sender, now)) {
+ *   apply(client.getOffset());
+ * }
+ * ```
+ */
+class NtpBroadcastClient {
+private:
+  NtpBroadcastClientState state = WAITING_FIRST_BEACON;
+  /**
+   * @brief The adopted server, valid when not waiting for the first beacon.
+   */
+  UdpPeer server;
+  /**
+   * @brief Transmit timestamp of the pending calibration request, to be echoed
+   * by the server.
+   */
+  NtpTimestamp calibrationOrigin;
+  /**
+   * @brief Transmit timestamp of the last accepted beacon, to reject
+   * duplicated and replayed beacons.
+   */
+  NtpTimestamp lastBeaconTransmit;
+  int64_t oneWayDelayMicros = 0;
+  int64_t offsetMicros = 0;
+  /**
+   * @brief Beyond this offset, the clock should be stepped instead of slewed.
+   */
+  int64_t stepThresholdMicros;
+  uint32_t acceptedBeaconCount = 0;
+  uint32_t rejectedBeaconCount = 0;
+
+  static bool isSamePeer(const UdpPeer *p1, const UdpPeer *p2);
+  static bool isUsableServerPacket(const NtpPacketDescription *packet);
+
+public:
+  //**@brief Default step threshold : 128 ms, as the reference implementation.
+  static const int64_t DEFAULT_STEP_THRESHOLD_MICROS = 128000;
+
+  NtpBroadcastClient(int64_t stepThreshold = DEFAULT_STEP_THRESHOLD_MICROS)
+      : stepThresholdMicros(stepThreshold) {}
+  virtual ~NtpBroadcastClient();
+
+  NtpBroadcastClientState getState() { return state; }
+
+  /**
+   * @brief Tells whether the caller should send a calibration request to the
+   * server.
+   */
+  bool isCalibrationRequired() { return CALIBRATING == state; }
+
+  /**
+   * @brief Get the adopted server, meaningful once a beacon has been accepted.
+   */
+  const UdpPeer *getServer() { return &server; }
+
+  /**
+   * @brief Get the offset to add to the local clock, measured by the last
+   * accepted packet.
+   */
+  int64_t getOffset() { return offsetMicros; }
+
+  /**
+   * @brief Get the one way delay measured during the calibration.
+   */
+  int64_t getOneWayDelay() { return oneWayDelayMicros; }
+
+  /**
+   * @brief Tells whether the last offset is too large to be slewed.
+   */
+  bool isStepRequired() {
+    return offsetMicros > stepThresholdMicros ||
+           offsetMicros < -stepThresholdMicros;
+  }
+
+  uint32_t getAcceptedBeaconCount() { return acceptedBeaconCount; }
+  uint32_t getRejectedBeaconCount() { return rejectedBeaconCount; }
+
+  /**
+   * @brief Handle a packet received while listening.
+   *
+   * While waiting for the first beacon, the sender of a valid beacon is
+   * adopted and the calibration becomes required. While tracking, only the
+   * beacons of the adopted server are accepted.
+   *
+   * @param packet the raw packet.
+   * @param length the size of the packet.
+   * @param sender the sender of the packet.
+   * @param receivedAt the local time of reception.
+   * @return true when the beacon gave a new offset.
+   */
+  bool acceptBeacon(const uint8_t *packet, size_t length,
+                    const UdpPeer *sender, int64_t receivedAt);
+
+  /**
+   * @brief Prepare the unicast request to send to the adopted server.
+   *
+   * @param packet a buffer of at least `NTP_PACKET_SIZE` bytes.
+   * @param now the local time, should be as close as possible to the actual
+   * sending.
+   * @return size_t the size of the request.
+   */
+  size_t prepareCalibrationRequest(uint8_t *packet, int64_t now);
+
+  /**
+   * @brief Handle the reply to the calibration request.
+   *
+   * @param packet the raw packet.
+   * @param length the size of the packet.
+   * @param sender the sender of the packet.
+   * @param receivedAt the local time of reception.
+   * @return true when the client is calibrated, the offset is updated.
+   */
+  bool acceptCalibrationReply(const uint8_t *packet, size_t length,
+                              const UdpPeer *sender, int64_t receivedAt);
+
+  /**
+   * @brief Forget the server and the calibration, e.g. after losing the
+   * network configuration.
+   */
+  void restart();
+};
+
+#endif
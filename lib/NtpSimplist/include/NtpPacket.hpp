@@ -0,0 +1,114 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef NTP_PACKET_HPP
+#define NTP_PACKET_HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// esp32 includes
+
+// project includes
+#include "NtpSimplistTypes.hpp"
+
+/** @brief Codec of NTP packets, and conversions between NTP timestamps and unix
+ * time in microseconds.
+ *
+ * All the time values handled by this library are microseconds since the unix
+ * epoch, as given by `gettimeofday()`.
+ */
+class NtpPacket {
+private:
+  static uint32_t readUint32(const uint8_t *source);
+  static void writeUint32(uint8_t *destination, uint32_t value);
+
+public:
+  virtual ~NtpPacket();
+
+  /**
+   * @brief Convert unix time to a NTP timestamp.
+   *
+   * @param unixMicros microseconds since the unix epoch.
+   * @return NtpTimestamp the timestamp.
+   */
+  static NtpTimestamp toNtpTimestamp(int64_t unixMicros);
+
+  /**
+   * @brief Convert a NTP timestamp to unix time.
+   *
+   * Timestamps with the most significant bit cleared are considered to belong
+   * to the era 1 (starting in 2036).
+   *
+   * @param timestamp the timestamp.
+   * @return int64_t microseconds since the unix epoch.
+   */
+  static int64_t toUnixMicros(const NtpTimestamp *timestamp);
+
+  /**
+   * @brief Compare two timestamps.
+   *
+   * @return true when both timestamps are the same.
+   */
+  static bool isSameTimestamp(const NtpTimestamp *t1, const NtpTimestamp *t2) {
+    return t1->seconds == t2->seconds && t1->fraction == t2->fraction;
+  }
+
+  /**
+   * @brief Decode the header of a packet.
+   *
+   * @param source the raw packet.
+   * @param length the size of the raw packet.
+   * @param result where to store the decoded header.
+   * @return true when the packet is big enough to be a NTP packet.
+   */
+  static bool decode(const uint8_t *source, size_t length,
+                     NtpPacketDescription *result);
+
+  /**
+   * @brief Encode a packet header.
+   *
+   * @param source the header to encode.
+   * @param destination a buffer of at least `NTP_PACKET_SIZE` bytes.
+   * @return size_t the size of the encoded packet.
+   */
+  static size_t encode(const NtpPacketDescription *source,
+                       uint8_t *destination);
+
+  /**
+   * @brief Write a timestamp at the given position of a raw packet.
+   *
+   * @param destination where to write (e.g. `packet + 40` for the transmit
+   * timestamp).
+   * @param timestamp the timestamp to write.
+   */
+  static void writeTimestamp(uint8_t *destination,
+                             const NtpTimestamp *timestamp) {
+    writeUint32(destination, timestamp->seconds);
+    writeUint32(destination + 4, timestamp->fraction);
+  }
+};
+
+//**@brief Offset of the origin timestamp in a raw packet.
+const uint8_t NTP_OFFSET_ORIGIN_TIMESTAMP = 24;
+//**@brief Offset of the receive timestamp in a raw packet.
+const uint8_t NTP_OFFSET_RECEIVE_TIMESTAMP = 32;
+//**@brief Offset of the transmit timestamp in a raw packet.
+const uint8_t NTP_OFFSET_TRANSMIT_TIMESTAMP = 40;
+
+#endif
@@ -0,0 +1,101 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef NTP_RATE_LIMITER_HPP
+#define NTP_RATE_LIMITER_HPP
+
+// standard includes
+#include <cstdint>
+#include <cstring>
+
+// esp32 includes
+
+// project includes
+#include "InternetSimplistTypes.hpp"
+
+/**
+ * @brief Outcome of the rate limiter for a request.
+ */
+enum NtpRateVerdict {
+  //**@brief The request can be answered.
+  NTP_RATE_ALLOWED,
+  //**@brief The client sends too many requests, it should be kissed off.
+  NTP_RATE_CLIENT_LIMITED,
+  //**@brief The server is overloaded, the request must be dropped.
+  NTP_RATE_GLOBAL_LIMITED
+};
+
+/** @brief Rate limiter for a time server, with a global limit and a limit per
+ * client.
+ *
+ * Each limit is a generic cell rate algorithm (a.k.a. virtual scheduling) :
+ * only a 'theoretical arrival time' is stored, there is no allocation, and the
+ * clients are tracked in a small fixed table where the least recently limited
+ * entry is recycled.
+ */
+class NtpRateLimiter {
+private:
+  static const uint8_t CLIENT_SLOTS = 16;
+  typedef struct {
+    uint8_t address[SIZE_OF_IPV4];
+    bool used;
+    int64_t theoreticalArrival;
+  } ClientSlot;
+
+  ClientSlot clients[CLIENT_SLOTS];
+  int64_t globalTheoreticalArrival = 0;
+  int64_t globalInterval;
+  int64_t globalTolerance;
+  int64_t clientInterval;
+  int64_t clientTolerance;
+
+  /**
+   * @brief The generic cell rate algorithm.
+   *
+   * @return true when conforming, the theoretical arrival time is updated.
+   */
+  static bool conforms(int64_t *theoreticalArrival, int64_t now,
+                       int64_t interval, int64_t tolerance);
+  ClientSlot *findOrRecycle(const UdpPeer *client);
+
+public:
+  /**
+   * @brief Setup the limits.
+   *
+   * @param maxPerSecond the sustained number of replies per second, all
+   * clients included.
+   * @param globalBurst the number of replies that can be sent at once.
+   * @param clientMinInterval the sustained interval between two requests of a
+   * client, in microseconds.
+   * @param clientBurst the number of requests a client can send at once (e.g.
+   * the 'iburst' of the reference implementation).
+   */
+  NtpRateLimiter(uint32_t maxPerSecond = 100, uint32_t globalBurst = 20,
+                 int64_t clientMinInterval = 2000000,
+                 uint32_t clientBurst = 8);
+  virtual ~NtpRateLimiter();
+
+  /**
+   * @brief Decide what to do with a request.
+   *
+   * @param client the sender of the request.
+   * @param now the local time of reception, in microseconds.
+   * @return NtpRateVerdict the decision.
+   */
+  NtpRateVerdict check(const UdpPeer *client, int64_t now);
+};
+
+#endif
@@ -0,0 +1,32 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef NTP_SIMPLIST_HPP
+#define NTP_SIMPLIST_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "NtpSimplistTypes.hpp"
+#include "NtpPacket.hpp"
+#include "NtpBroadcastClient.hpp"
+#include "NtpRateLimiter.hpp"
+#include "SntpResponder.hpp"
+
+#endif
@@ -0,0 +1,97 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef NTP_SIMPLIST_TYPES_HPP
+#define NTP_SIMPLIST_TYPES_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+//**@brief The well-known port of (S)NTP.
+const uint16_t NTP_PORT = 123;
+
+//**@brief Size of a NTP packet without extension fields nor authenticator.
+const uint8_t NTP_PACKET_SIZE = 48;
+
+//**@brief Seconds between the NTP era 0 (1900) and the unix epoch (1970).
+const uint32_t NTP_UNIX_EPOCH_OFFSET = 2208988800UL;
+
+//**@brief Version written in the packets that are sent.
+const uint8_t NTP_VERSION = 4;
+
+//**@brief Maximum value of the stratum of a synchronized server.
+const uint8_t NTP_MAX_STRATUM = 15;
+
+/**
+ * @brief Association modes (RFC 5905, figure 10).
+ */
+enum NtpMode {
+  NTP_MODE_RESERVED = 0,
+  NTP_MODE_SYMMETRIC_ACTIVE = 1,
+  NTP_MODE_SYMMETRIC_PASSIVE = 2,
+  NTP_MODE_CLIENT = 3,
+  NTP_MODE_SERVER = 4,
+  NTP_MODE_BROADCAST = 5,
+  NTP_MODE_CONTROL = 6,
+  NTP_MODE_PRIVATE = 7
+};
+
+/**
+ * @brief Leap indicator (RFC 5905, figure 9).
+ */
+enum NtpLeapIndicator {
+  NTP_LEAP_NONE = 0,
+  NTP_LEAP_ADD_SECOND = 1,
+  NTP_LEAP_DELETE_SECOND = 2,
+  //**@brief The clock of the sender is not synchronized.
+  NTP_LEAP_ALARM = 3
+};
+
+/**
+ * @brief The 64 bits timestamp format : seconds since 1900 and fraction of
+ * second.
+ */
+typedef struct {
+  uint32_t seconds;
+  uint32_t fraction;
+} NtpTimestamp;
+
+/**
+ * @brief Decoded content of a NTP packet header.
+ */
+typedef struct {
+  NtpLeapIndicator leapIndicator;
+  uint8_t version;
+  NtpMode mode;
+  uint8_t stratum;
+  int8_t poll;
+  int8_t precision;
+  //**@brief Fixed point 16.16 value, in seconds.
+  uint32_t rootDelay;
+  //**@brief Fixed point 16.16 value, in seconds.
+  uint32_t rootDispersion;
+  uint8_t referenceId[4];
+  NtpTimestamp referenceTimestamp;
+  NtpTimestamp originTimestamp;
+  NtpTimestamp receiveTimestamp;
+  NtpTimestamp transmitTimestamp;
+} NtpPacketDescription;
+
+#endif
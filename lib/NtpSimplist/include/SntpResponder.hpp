@@ -0,0 +1,128 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef SNTP_RESPONDER_HPP
+#define SNTP_RESPONDER_HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// esp32 includes
+
+// project includes
+#include "InternetSimplistTypes.hpp"
+#include "NtpPacket.hpp"
+#include "NtpRateLimiter.hpp"
+#include "NtpSimplistTypes.hpp"
+
+/**
+ * @brief Description of the time reference of the responder, i.e. the last
+ * synchronization with the upstream server.
+ */
+typedef struct {
+  //**@brief Stratum of the upstream server, the responder will be one more.
+  uint8_t upstreamStratum;
+  //**@brief IPv4 address of the upstream server.
+  uint8_t referenceId[4];
+  //**@brief When the local clock was last synchronized, in microseconds.
+  int64_t referenceTime;
+  //**@brief log2 of the precision of the local clock, in seconds.
+  int8_t precision;
+  //**@brief Fixed point 16.16 value, in seconds.
+  uint32_t rootDelay;
+  //**@brief Fixed point 16.16 value, in seconds.
+  uint32_t rootDispersion;
+} SntpReference;
+
+/** @brief Stateless SNTP server logic (RFC 4330), with a zero-allocation packet
+ * path.
+ *
+ * The header of the replies is formatted once, when the reference changes ;
+ * answering a request is a copy of the template plus three timestamps. The
+ * caller receives the request and sends the reply.
+ */
+class SntpResponder {
+private:
+  /**
+   * @brief Preformatted reply, timestamps excluded.
+   */
+  uint8_t replyTemplate[NTP_PACKET_SIZE];
+  /**
+   * @brief Preformatted 'kiss-o'-death' reply telling a client to slow down.
+   */
+  uint8_t kissTemplate[NTP_PACKET_SIZE];
+  bool synchronized = false;
+  NtpRateLimiter *limiter;
+  uint32_t answeredCount = 0;
+  uint32_t kissedCount = 0;
+  uint32_t droppedCount = 0;
+
+  static size_t fill(uint8_t *reply, const uint8_t *model,
+                     const uint8_t *request, int64_t receivedAt,
+                     int64_t transmitAt);
+
+public:
+  /**
+   * @brief Setup the responder.
+   *
+   * @param rateLimiter the rate limiter to use, `nullptr` to answer every
+   * valid request.
+   */
+  SntpResponder(NtpRateLimiter *rateLimiter = nullptr)
+      : limiter(rateLimiter) {
+    memset(replyTemplate, 0, NTP_PACKET_SIZE);
+    memset(kissTemplate, 0, NTP_PACKET_SIZE);
+  }
+  virtual ~SntpResponder();
+
+  /**
+   * @brief Change the reference, the responder will answer requests.
+   *
+   * @param reference the new reference.
+   */
+  void updateReference(const SntpReference *reference);
+
+  /**
+   * @brief The local clock is not synchronized anymore, the responder will not
+   * answer requests.
+   */
+  void loseReference() { synchronized = false; }
+
+  bool isSynchronized() { return synchronized; }
+
+  /**
+   * @brief Build the reply to a request.
+   *
+   * @param request the raw request.
+   * @param length the size of the request.
+   * @param client the sender of the request.
+   * @param receivedAt the local time of reception.
+   * @param transmitAt the local time of sending, as close as possible to the
+   * actual sending.
+   * @param reply a buffer of at least `NTP_PACKET_SIZE` bytes.
+   * @return size_t the size of the reply, 0 when nothing must be sent.
+   */
+  size_t respond(const uint8_t *request, size_t length, const UdpPeer *client,
+                 int64_t receivedAt, int64_t transmitAt, uint8_t *reply);
+
+  uint32_t getAnsweredCount() { return answeredCount; }
+  uint32_t getKissedCount() { return kissedCount; }
+  uint32_t getDroppedCount() { return droppedCount; }
+};
+
+#endif
@@ -0,0 +1,109 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "NtpBroadcastClient.hpp"
+
+NtpBroadcastClient::~NtpBroadcastClient() {}
+// write code here...
+
+bool NtpBroadcastClient::isSamePeer(const UdpPeer *p1, const UdpPeer *p2) {
+  return p1->port == p2->port &&
+         0 == memcmp(p1->address.v4, p2->address.v4, SIZE_OF_IPV4);
+}
+
+bool NtpBroadcastClient::isUsableServerPacket(
+    const NtpPacketDescription *packet) {
+  return NTP_LEAP_ALARM != packet->leapIndicator && packet->version >= 3 &&
+         packet->stratum > 0 && packet->stratum <= NTP_MAX_STRATUM &&
+         0 != packet->transmitTimestamp.seconds;
+}
+
+bool NtpBroadcastClient::acceptBeacon(const uint8_t *packet, size_t length,
+                                      const UdpPeer *sender,
+                                      int64_t receivedAt) {
+  NtpPacketDescription beacon;
+  if (!NtpPacket::decode(packet, length, &beacon) ||
+      NTP_MODE_BROADCAST != beacon.mode || !isUsableServerPacket(&beacon)) {
+    ++rejectedBeaconCount;
+    return false;
+  }
+  switch (state) {
+  case WAITING_FIRST_BEACON:
+    server = *sender;
+    lastBeaconTransmit = beacon.transmitTimestamp;
+    state = CALIBRATING;
+    return false;
+  case CALIBRATING:
+    return false; // waiting for the unicast reply
+  case TRACKING:
+    break;
+  }
+  if (!isSamePeer(sender, &server) ||
+      NtpPacket::toUnixMicros(&beacon.transmitTimestamp) <=
+          NtpPacket::toUnixMicros(&lastBeaconTransmit)) {
+    ++rejectedBeaconCount;
+    return false;
+  }
+  lastBeaconTransmit = beacon.transmitTimestamp;
+  offsetMicros = NtpPacket::toUnixMicros(&beacon.transmitTimestamp) +
+                 oneWayDelayMicros - receivedAt;
+  ++acceptedBeaconCount;
+  return true;
+}
+
+size_t NtpBroadcastClient::prepareCalibrationRequest(uint8_t *packet,
+                                                     int64_t now) {
+  NtpPacketDescription request;
+  memset(&request, 0, sizeof(request));
+  request.leapIndicator = NTP_LEAP_NONE;
+  request.version = NTP_VERSION;
+  request.mode = NTP_MODE_CLIENT;
+  calibrationOrigin = NtpPacket::toNtpTimestamp(now);
+  request.transmitTimestamp = calibrationOrigin;
+  return NtpPacket::encode(&request, packet);
+}
+
+bool NtpBroadcastClient::acceptCalibrationReply(const uint8_t *packet,
+                                                size_t length,
+                                                const UdpPeer *sender,
+                                                int64_t receivedAt) {
+  NtpPacketDescription reply;
+  if (CALIBRATING != state || !isSamePeer(sender, &server) ||
+      !NtpPacket::decode(packet, length, &reply) ||
+      NTP_MODE_SERVER != reply.mode || !isUsableServerPacket(&reply) ||
+      !NtpPacket::isSameTimestamp(&reply.originTimestamp,
+                                  &calibrationOrigin)) {
+    return false;
+  }
+  // RFC 5905 on-wire protocol : t1 origin, t2 receive, t3 transmit, t4 arrival
+  int64_t t1 = NtpPacket::toUnixMicros(&reply.originTimestamp);
+  int64_t t2 = NtpPacket::toUnixMicros(&reply.receiveTimestamp);
+  int64_t t3 = NtpPacket::toUnixMicros(&reply.transmitTimestamp);
+  int64_t t4 = receivedAt;
+  int64_t delay = (t4 - t1) - (t3 - t2);
+  oneWayDelayMicros = delay > 0 ? delay / 2 : 0;
+  offsetMicros = ((t2 - t1) + (t3 - t4)) / 2;
+  state = TRACKING;
+  return true;
+}
+
+void NtpBroadcastClient::restart() {
+  state = WAITING_FIRST_BEACON;
+  oneWayDelayMicros = 0;
+  offsetMicros = 0;
+}
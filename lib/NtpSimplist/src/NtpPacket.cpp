@@ -0,0 +1,104 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "NtpPacket.hpp"
+
+NtpPacket::~NtpPacket() {}
+// write code here...
+
+static const int64_t MICROS_PER_SECOND = 1000000;
+static const uint64_t NTP_ERA_DURATION = 1ULL << 32;
+
+uint32_t NtpPacket::readUint32(const uint8_t *source) {
+  return ((uint32_t)source[0] << 24) | ((uint32_t)source[1] << 16) |
+         ((uint32_t)source[2] << 8) | (uint32_t)source[3];
+}
+
+void NtpPacket::writeUint32(uint8_t *destination, uint32_t value) {
+  destination[0] = (uint8_t)(value >> 24);
+  destination[1] = (uint8_t)(value >> 16);
+  destination[2] = (uint8_t)(value >> 8);
+  destination[3] = (uint8_t)value;
+}
+
+NtpTimestamp NtpPacket::toNtpTimestamp(int64_t unixMicros) {
+  int64_t seconds = unixMicros / MICROS_PER_SECOND;
+  int64_t micros = unixMicros % MICROS_PER_SECOND;
+  if (micros < 0) {
+    micros += MICROS_PER_SECOND;
+    --seconds;
+  }
+  NtpTimestamp result = {
+      .seconds = (uint32_t)(seconds + NTP_UNIX_EPOCH_OFFSET),
+      .fraction = (uint32_t)(((uint64_t)micros << 32) / MICROS_PER_SECOND)};
+  return result;
+}
+
+int64_t NtpPacket::toUnixMicros(const NtpTimestamp *timestamp) {
+  int64_t seconds = timestamp->seconds;
+  if (0 == (timestamp->seconds & 0x80000000UL)) {
+    seconds += NTP_ERA_DURATION; // era 1
+  }
+  seconds -= NTP_UNIX_EPOCH_OFFSET;
+  int64_t micros =
+      (int64_t)(((uint64_t)timestamp->fraction * MICROS_PER_SECOND) >> 32);
+  return seconds * MICROS_PER_SECOND + micros;
+}
+
+bool NtpPacket::decode(const uint8_t *source, size_t length,
+                       NtpPacketDescription *result) {
+  if (length < NTP_PACKET_SIZE) {
+    return false;
+  }
+  result->leapIndicator = (NtpLeapIndicator)(source[0] >> 6);
+  result->version = (source[0] >> 3) & 0x07;
+  result->mode = (NtpMode)(source[0] & 0x07);
+  result->stratum = source[1];
+  result->poll = (int8_t)source[2];
+  result->precision = (int8_t)source[3];
+  result->rootDelay = readUint32(source + 4);
+  result->rootDispersion = readUint32(source + 8);
+  memcpy(result->referenceId, source + 12, 4);
+  result->referenceTimestamp.seconds = readUint32(source + 16);
+  result->referenceTimestamp.fraction = readUint32(source + 20);
+  result->originTimestamp.seconds = readUint32(source + 24);
+  result->originTimestamp.fraction = readUint32(source + 28);
+  result->receiveTimestamp.seconds = readUint32(source + 32);
+  result->receiveTimestamp.fraction = readUint32(source + 36);
+  result->transmitTimestamp.seconds = readUint32(source + 40);
+  result->transmitTimestamp.fraction = readUint32(source + 44);
+  return true;
+}
+
+size_t NtpPacket::encode(const NtpPacketDescription *source,
+                         uint8_t *destination) {
+  destination[0] = (uint8_t)((source->leapIndicator << 6) |
+                             ((source->version & 0x07) << 3) |
+                             (source->mode & 0x07));
+  destination[1] = source->stratum;
+  destination[2] = (uint8_t)source->poll;
+  destination[3] = (uint8_t)source->precision;
+  writeUint32(destination + 4, source->rootDelay);
+  writeUint32(destination + 8, source->rootDispersion);
+  memcpy(destination + 12, source->referenceId, 4);
+  writeTimestamp(destination + 16, &source->referenceTimestamp);
+  writeTimestamp(destination + 24, &source->originTimestamp);
+  writeTimestamp(destination + 32, &source->receiveTimestamp);
+  writeTimestamp(destination + 40, &source->transmitTimestamp);
+  return NTP_PACKET_SIZE;
+}
@@ -0,0 +1,77 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "NtpRateLimiter.hpp"
+
+NtpRateLimiter::~NtpRateLimiter() {}
+// write code here...
+
+NtpRateLimiter::NtpRateLimiter(uint32_t maxPerSecond, uint32_t globalBurst,
+                               int64_t clientMinInterval,
+                               uint32_t clientBurst)
+    : globalInterval(1000000 / (maxPerSecond > 0 ? maxPerSecond : 1)),
+      clientInterval(clientMinInterval) {
+  globalTolerance = globalInterval * (globalBurst > 0 ? globalBurst - 1 : 0);
+  clientTolerance = clientInterval * (clientBurst > 0 ? clientBurst - 1 : 0);
+  memset(clients, 0, sizeof(clients));
+}
+
+bool NtpRateLimiter::conforms(int64_t *theoreticalArrival, int64_t now,
+                              int64_t interval, int64_t tolerance) {
+  if (*theoreticalArrival - now > tolerance) {
+    return false;
+  }
+  *theoreticalArrival =
+      (*theoreticalArrival > now ? *theoreticalArrival : now) + interval;
+  return true;
+}
+
+NtpRateLimiter::ClientSlot *
+NtpRateLimiter::findOrRecycle(const UdpPeer *client) {
+  ClientSlot *oldest = &clients[0];
+  for (uint8_t i = 0; i < CLIENT_SLOTS; i++) {
+    ClientSlot *slot = &clients[i];
+    if (slot->used &&
+        0 == memcmp(slot->address, client->address.v4, SIZE_OF_IPV4)) {
+      return slot;
+    }
+    if (!slot->used) {
+      oldest = slot;
+    } else if (oldest->used &&
+               slot->theoreticalArrival < oldest->theoreticalArrival) {
+      oldest = slot;
+    }
+  }
+  memcpy(oldest->address, client->address.v4, SIZE_OF_IPV4);
+  oldest->used = true;
+  oldest->theoreticalArrival = 0;
+  return oldest;
+}
+
+NtpRateVerdict NtpRateLimiter::check(const UdpPeer *client, int64_t now) {
+  ClientSlot *slot = findOrRecycle(client);
+  if (!conforms(&slot->theoreticalArrival, now, clientInterval,
+                clientTolerance)) {
+    return NTP_RATE_CLIENT_LIMITED;
+  }
+  if (!conforms(&globalTheoreticalArrival, now, globalInterval,
+                globalTolerance)) {
+    return NTP_RATE_GLOBAL_LIMITED;
+  }
+  return NTP_RATE_ALLOWED;
+}
@@ -0,0 +1,91 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "SntpResponder.hpp"
+
+SntpResponder::~SntpResponder() {}
+// write code here...
+
+static const uint8_t KISS_CODE_RATE[4] = {'R', 'A', 'T', 'E'};
+
+void SntpResponder::updateReference(const SntpReference *reference) {
+  NtpPacketDescription desc;
+  memset(&desc, 0, sizeof(desc));
+  desc.leapIndicator = NTP_LEAP_NONE;
+  desc.version = NTP_VERSION;
+  desc.mode = NTP_MODE_SERVER;
+  desc.stratum = reference->upstreamStratum < NTP_MAX_STRATUM
+                     ? reference->upstreamStratum + 1
+                     : NTP_MAX_STRATUM;
+  desc.poll = 6; // 64 s, the usual minimum
+  desc.precision = reference->precision;
+  desc.rootDelay = reference->rootDelay;
+  desc.rootDispersion = reference->rootDispersion;
+  memcpy(desc.referenceId, reference->referenceId, 4);
+  desc.referenceTimestamp =
+      NtpPacket::toNtpTimestamp(reference->referenceTime);
+  NtpPacket::encode(&desc, replyTemplate);
+
+  desc.leapIndicator = NTP_LEAP_ALARM;
+  desc.stratum = 0;
+  memcpy(desc.referenceId, KISS_CODE_RATE, 4);
+  NtpPacket::encode(&desc, kissTemplate);
+
+  synchronized = true;
+}
+
+size_t SntpResponder::fill(uint8_t *reply, const uint8_t *model,
+                           const uint8_t *request, int64_t receivedAt,
+                           int64_t transmitAt) {
+  memcpy(reply, model, NTP_PACKET_SIZE);
+  // version of the request is echoed (RFC 4330, section 5)
+  reply[0] = (reply[0] & 0xc7) | (request[0] & 0x38);
+  // origin timestamp is the raw transmit timestamp of the request
+  memcpy(reply + NTP_OFFSET_ORIGIN_TIMESTAMP,
+         request + NTP_OFFSET_TRANSMIT_TIMESTAMP, 8);
+  NtpTimestamp timestamp = NtpPacket::toNtpTimestamp(receivedAt);
+  NtpPacket::writeTimestamp(reply + NTP_OFFSET_RECEIVE_TIMESTAMP, &timestamp);
+  timestamp = NtpPacket::toNtpTimestamp(transmitAt);
+  NtpPacket::writeTimestamp(reply + NTP_OFFSET_TRANSMIT_TIMESTAMP, &timestamp);
+  return NTP_PACKET_SIZE;
+}
+
+size_t SntpResponder::respond(const uint8_t *request, size_t length,
+                              const UdpPeer *client, int64_t receivedAt,
+                              int64_t transmitAt, uint8_t *reply) {
+  uint8_t version = (request[0] >> 3) & 0x07;
+  if (!synchronized || length < NTP_PACKET_SIZE ||
+      NTP_MODE_CLIENT != (request[0] & 0x07) || version < 1 || version > 4) {
+    ++droppedCount;
+    return 0;
+  }
+  NtpRateVerdict verdict =
+      nullptr == limiter ? NTP_RATE_ALLOWED : limiter->check(client, receivedAt);
+  switch (verdict) {
+  case NTP_RATE_ALLOWED:
+    ++answeredCount;
+    return fill(reply, replyTemplate, request, receivedAt, transmitAt);
+  case NTP_RATE_CLIENT_LIMITED:
+    ++kissedCount;
+    return fill(reply, kissTemplate, request, receivedAt, transmitAt);
+  case NTP_RATE_GLOBAL_LIMITED:
+    break;
+  }
+  ++droppedCount;
+  return 0;
+}
@@ -0,0 +1,129 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Phase Sync Simplist'.
+// ---
+// 'Phase Sync Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Phase Sync Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Phase Sync Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef ANIMATION_TIMELINE_HPP
+#define ANIMATION_TIMELINE_HPP
+
+// standard includes
+#include <atomic>
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+/** @brief A cyclic animation (e.g. the blinking colon) as a function of the
+ * local monotonic time, instead of a free running counter.
+ *
+ * The cycle is made of `stepCount` steps of `stepDuration` microseconds, the
+ * first step starting at `origin`. Moving the origin realigns the animation,
+ * e.g. to follow another clock. The origin can be changed by a task while
+ * another one reads it.
+ */
+class AnimationTimeline {
+private:
+  std::atomic<int64_t> origin;
+  int64_t stepDuration;
+  uint8_t stepCount;
+
+  /**
+   * @brief Positive remainder of the division.
+   */
+  static int64_t modulo(int64_t value, int64_t divisor) {
+    int64_t result = value % divisor;
+    return result < 0 ? result + divisor : result;
+  }
+
+public:
+  /**
+   * @brief Setup the timeline.
+   *
+   * @param stepDurationMicros duration of each step.
+   * @param steps number of steps of the cycle.
+   * @param originMicros start of a cycle, in local time.
+   */
+  AnimationTimeline(int64_t stepDurationMicros, uint8_t steps,
+                    int64_t originMicros = 0)
+      : origin(originMicros), stepDuration(stepDurationMicros),
+        stepCount(steps) {}
+  virtual ~AnimationTimeline();
+
+  int64_t getOrigin() { return origin.load(); }
+  void setOrigin(int64_t value) { origin.store(value); }
+  int64_t getStepDuration() { return stepDuration; }
+  uint8_t getStepCount() { return stepCount; }
+  int64_t getCycleDuration() { return stepDuration * stepCount; }
+
+  /**
+   * @brief Get the time elapsed since the start of the current cycle.
+   *
+   * @param now the local time.
+   * @return int64_t the elapsed time, in [0, cycle duration).
+   */
+  int64_t getElapsedInCycle(int64_t now) {
+    return modulo(now - origin.load(), getCycleDuration());
+  }
+
+  /**
+   * @brief Get the step to display.
+   *
+   * @param now the local time.
+   * @return uint8_t the step, in [0, step count).
+   */
+  uint8_t getStepAt(int64_t now) {
+    return (uint8_t)(getElapsedInCycle(now) / stepDuration);
+  }
+
+  /**
+   * @brief Get the time to wait until the start of the next step.
+   *
+   * @param now the local time.
+   * @return int64_t the delay, in (0, step duration].
+   */
+  int64_t getDelayToNextStep(int64_t now) {
+    return stepDuration - modulo(now - origin.load(), stepDuration);
+  }
+
+  /**
+   * @brief Get the time to wait until the start of the next odd step, to
+   * refresh every other step.
+   *
+   * Drawing the odd steps keeps the last step of the cycle, so that a pattern
+   * over the last steps (e.g. a blinking colon) still alternates.
+   *
+   * @param now the local time.
+   * @return int64_t the delay, in (0, 2 * step duration].
+   */
+  int64_t getDelayToNextOddStep(int64_t now) {
+    int64_t delay = getDelayToNextStep(now);
+    return 0 == getStepAt(now) % 2 ? delay : delay + stepDuration;
+  }
+
+  /**
+   * @brief Signed difference between this timeline and a candidate origin,
+   * folded into half a cycle.
+   *
+   * @param candidate another origin, in local time.
+   * @return int64_t how much to move the origin to match the candidate.
+   */
+  int64_t getShiftTo(int64_t candidate) {
+    int64_t cycle = getCycleDuration();
+    int64_t shift = modulo(candidate - origin.load(), cycle);
+    return shift > cycle / 2 ? shift - cycle : shift;
+  }
+};
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Phase Sync Simplist'.
+// ---
+// 'Phase Sync Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Phase Sync Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Phase Sync Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef PHASE_BEACON_HPP
+#define PHASE_BEACON_HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "PhaseSyncSimplistTypes.hpp"
+
+/** @brief Codec of the phase beacons.
+ *
+ * Layout (big endian) : magic 'TCPS' (4), version (1), step count (1), step
+ * duration in ms (2), sequence (4), elapsed time in cycle in us (4).
+ */
+class PhaseBeacon {
+private:
+  static const uint8_t VERSION = 1;
+
+public:
+  virtual ~PhaseBeacon();
+
+  /**
+   * @brief Decode a beacon.
+   *
+   * @param source the raw packet.
+   * @param length the size of the packet.
+   * @param result where to store the decoded beacon.
+   * @return true when the packet is a beacon of a supported version.
+   */
+  static bool decode(const uint8_t *source, size_t length,
+                     PhaseBeaconDescription *result);
+
+  /**
+   * @brief Encode a beacon.
+   *
+   * @param source the beacon to encode.
+   * @param destination a buffer of at least `PHASE_BEACON_SIZE` bytes.
+   * @return size_t the size of the packet.
+   */
+  static size_t encode(const PhaseBeaconDescription *source,
+                       uint8_t *destination);
+};
+
+#endif
@@ -0,0 +1,150 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Phase Sync Simplist'.
+// ---
+// 'Phase Sync Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Phase Sync Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Phase Sync Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef PHASE_SYNC_AGENT_HPP
+#define PHASE_SYNC_AGENT_HPP
+
+// standard includes
+#include <cstddef>
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "AnimationTimeline.hpp"
+#include "PhaseBeacon.hpp"
+#include "PhaseSyncSimplistTypes.hpp"
+#include "UdpEndpoint.hpp"
+
+/** @brief Keep the animation timelines of several clocks of a LAN in phase.
+ *
+ * The leader broadcasts the position in its cycle ; each follower derives the
+ * origin of the cycle of the leader in its own local time, and moves its
+ * timeline there. Because a beacon can only be late, the followers keep the
+ * earliest origin among the last beacons (minimum delay filter).
+ *
+ * The agent does not wait by itself, the caller runs the loop :
+ * ```cpp
+ * agent.open();
+ * while (running) {
+ *   int size = endpoint.receiveFrom(buffer, sizeof(buffer), nullptr,
+ *                                   agent.getTimeoutMs(now()));
+ *   if (size > 0) {
+ *     agent.onBeacon(buffer, size, now());
+ *   }
+ *   agent.onTick(now());
+ * }
+ * ```
+ */
+class PhaseSyncAgent {
+private:
+  static const uint8_t FILTER_SIZE = 8;
+  UdpEndpoint *endpoint;
+  AnimationTimeline *timeline;
+  PhaseSyncRole role;
+  uint16_t port;
+  int64_t beaconInterval;
+  /**
+   * @brief Expected minimal time between the sending and the reception of a
+   * beacon.
+   */
+  int64_t transitCompensation;
+  uint8_t packet[PHASE_BEACON_SIZE];
+
+  // leader
+  int64_t nextBeaconAt = 0;
+  uint32_t sequence = 0;
+
+  // follower
+  /**
+   * @brief Origin of the leader cycle as last locked, the samples are relative
+   * to it.
+   */
+  int64_t anchor = 0;
+  bool hasAnchor = false;
+  int64_t samples[FILTER_SIZE];
+  uint8_t sampleCount = 0;
+  uint8_t nextSample = 0;
+  uint32_t acceptedCount = 0;
+  uint32_t rejectedCount = 0;
+
+  void sendBeacon(int64_t now);
+
+public:
+  /**
+   * @brief Setup the agent.
+   *
+   * @param endpoint the UDP endpoint to use, not opened yet.
+   * @param timeline the timeline to broadcast (leader) or to move (follower).
+   * @param role the role of this clock.
+   * @param port the UDP port of the beacons.
+   * @param beaconIntervalMicros the time between two beacons of the leader.
+   * @param transitCompensationMicros the minimal transit time of a beacon.
+   */
+  PhaseSyncAgent(UdpEndpoint *endpoint, AnimationTimeline *timeline,
+                 PhaseSyncRole role, uint16_t port = PHASE_SYNC_DEFAULT_PORT,
+                 int64_t beaconIntervalMicros = 1000000,
+                 int64_t transitCompensationMicros = 1000)
+      : endpoint(endpoint), timeline(timeline), role(role), port(port),
+        beaconInterval(beaconIntervalMicros),
+        transitCompensation(transitCompensationMicros) {}
+  virtual ~PhaseSyncAgent();
+
+  PhaseSyncRole getRole() { return role; }
+
+  /**
+   * @brief Open the endpoint according to the role.
+   *
+   * @return true when ready.
+   */
+  bool open();
+
+  /**
+   * @brief Close the endpoint, a follower will restart its filter.
+   */
+  void close();
+
+  /**
+   * @brief Get how long the caller can wait for beacons before calling
+   * `onTick`.
+   *
+   * @param now the local time.
+   * @return uint32_t the timeout in milliseconds.
+   */
+  uint32_t getTimeoutMs(int64_t now);
+
+  /**
+   * @brief Do the periodic work : the leader sends its beacon when due.
+   *
+   * @param now the local time.
+   */
+  void onTick(int64_t now);
+
+  /**
+   * @brief Handle a received packet, for a follower.
+   *
+   * @param packet the raw packet.
+   * @param length the size of the packet.
+   * @param receivedAt the local time of reception.
+   * @return true when the timeline has been locked again.
+   */
+  bool onBeacon(const uint8_t *packet, size_t length, int64_t receivedAt);
+
+  uint32_t getAcceptedCount() { return acceptedCount; }
+  uint32_t getRejectedCount() { return rejectedCount; }
+};
+
+#endif
@@ -0,0 +1,57 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Phase Sync Simplist'.
+// ---
+// 'Phase Sync Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Phase Sync Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Phase Sync Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef PHASE_SYNC_SIMPLIST_TYPES_HPP
+#define PHASE_SYNC_SIMPLIST_TYPES_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+//**@brief Size of a phase beacon.
+const uint8_t PHASE_BEACON_SIZE = 16;
+
+//**@brief Default UDP port of the phase beacons.
+const uint16_t PHASE_SYNC_DEFAULT_PORT = 4123;
+
+/**
+ * @brief Role of a clock regarding the phase synchronization.
+ */
+enum PhaseSyncRole {
+  //**@brief Free running, nothing sent nor received.
+  PHASE_SYNC_NONE,
+  //**@brief Broadcasts its phase reference.
+  PHASE_SYNC_LEADER,
+  //**@brief Locks its timeline to the beacons of the leader.
+  PHASE_SYNC_FOLLOWER
+};
+
+/**
+ * @brief Decoded content of a phase beacon.
+ */
+typedef struct {
+  uint8_t stepCount;
+  uint16_t stepDurationMs;
+  uint32_t sequence;
+  //**@brief Time elapsed since the start of the current cycle of the leader,
+  // when sending.
+  uint32_t elapsedInCycle;
+} PhaseBeaconDescription;
+
+#endif
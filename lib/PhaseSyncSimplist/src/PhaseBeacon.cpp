@@ -0,0 +1,63 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Phase Sync Simplist'.
+// ---
+// 'Phase Sync Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Phase Sync Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Phase Sync Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "PhaseBeacon.hpp"
+
+PhaseBeacon::~PhaseBeacon() {}
+// write code here...
+
+static const uint8_t MAGIC[4] = {'T', 'C', 'P', 'S'};
+
+bool PhaseBeacon::decode(const uint8_t *source, size_t length,
+                         PhaseBeaconDescription *result) {
+  if (length < PHASE_BEACON_SIZE || MAGIC[0] != source[0] ||
+      MAGIC[1] != source[1] || MAGIC[2] != source[2] ||
+      MAGIC[3] != source[3] || VERSION != source[4]) {
+    return false;
+  }
+  result->stepCount = source[5];
+  result->stepDurationMs = (uint16_t)((source[6] << 8) | source[7]);
+  result->sequence = ((uint32_t)source[8] << 24) |
+                     ((uint32_t)source[9] << 16) |
+                     ((uint32_t)source[10] << 8) | (uint32_t)source[11];
+  result->elapsedInCycle = ((uint32_t)source[12] << 24) |
+                           ((uint32_t)source[13] << 16) |
+                           ((uint32_t)source[14] << 8) | (uint32_t)source[15];
+  return true;
+}
+
+size_t PhaseBeacon::encode(const PhaseBeaconDescription *source,
+                           uint8_t *destination) {
+  destination[0] = MAGIC[0];
+  destination[1] = MAGIC[1];
+  destination[2] = MAGIC[2];
+  destination[3] = MAGIC[3];
+  destination[4] = VERSION;
+  destination[5] = source->stepCount;
+  destination[6] = (uint8_t)(source->stepDurationMs >> 8);
+  destination[7] = (uint8_t)source->stepDurationMs;
+  destination[8] = (uint8_t)(source->sequence >> 24);
+  destination[9] = (uint8_t)(source->sequence >> 16);
+  destination[10] = (uint8_t)(source->sequence >> 8);
+  destination[11] = (uint8_t)source->sequence;
+  destination[12] = (uint8_t)(source->elapsedInCycle >> 24);
+  destination[13] = (uint8_t)(source->elapsedInCycle >> 16);
+  destination[14] = (uint8_t)(source->elapsedInCycle >> 8);
+  destination[15] = (uint8_t)source->elapsedInCycle;
+  return PHASE_BEACON_SIZE;
+}
@@ -0,0 +1,117 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Phase Sync Simplist'.
+// ---
+// 'Phase Sync Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Phase Sync Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Phase Sync Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "PhaseSyncAgent.hpp"
+
+PhaseSyncAgent::~PhaseSyncAgent() {}
+// write code here...
+
+static const UdpPeer BROADCAST = {.address = {.v4 = {255, 255, 255, 255}},
+                                  .port = 0};
+
+bool PhaseSyncAgent::open() {
+  switch (role) {
+  case PHASE_SYNC_LEADER:
+    nextBeaconAt = 0;
+    return endpoint->open(0, true);
+  case PHASE_SYNC_FOLLOWER:
+    hasAnchor = false;
+    sampleCount = 0;
+    nextSample = 0;
+    return endpoint->open(port, true);
+  case PHASE_SYNC_NONE:
+    break;
+  }
+  return false;
+}
+
+void PhaseSyncAgent::close() { endpoint->close(); }
+
+uint32_t PhaseSyncAgent::getTimeoutMs(int64_t now) {
+  if (PHASE_SYNC_LEADER == role) {
+    return nextBeaconAt > now ? (uint32_t)((nextBeaconAt - now) / 1000) : 0;
+  }
+  return (uint32_t)(4 * beaconInterval / 1000);
+}
+
+void PhaseSyncAgent::sendBeacon(int64_t now) {
+  PhaseBeaconDescription beacon = {
+      .stepCount = timeline->getStepCount(),
+      .stepDurationMs = (uint16_t)(timeline->getStepDuration() / 1000),
+      .sequence = ++sequence,
+      .elapsedInCycle = (uint32_t)timeline->getElapsedInCycle(now)};
+  size_t size = PhaseBeacon::encode(&beacon, packet);
+  UdpPeer recipient = BROADCAST;
+  recipient.port = port;
+  endpoint->sendTo(&recipient, packet, size);
+}
+
+void PhaseSyncAgent::onTick(int64_t now) {
+  if (PHASE_SYNC_LEADER != role || now < nextBeaconAt) {
+    return;
+  }
+  sendBeacon(now);
+  nextBeaconAt = now + beaconInterval;
+}
+
+bool PhaseSyncAgent::onBeacon(const uint8_t *packet, size_t length,
+                              int64_t receivedAt) {
+  PhaseBeaconDescription beacon;
+  if (PHASE_SYNC_FOLLOWER != role ||
+      !PhaseBeacon::decode(packet, length, &beacon) ||
+      beacon.stepCount != timeline->getStepCount() ||
+      (int64_t)beacon.stepDurationMs * 1000 != timeline->getStepDuration()) {
+    ++rejectedCount;
+    return false;
+  }
+  int64_t candidate =
+      receivedAt - transitCompensation - (int64_t)beacon.elapsedInCycle;
+  if (!hasAnchor) {
+    anchor = candidate;
+    hasAnchor = true;
+  }
+  // fold the candidate around the anchor, as `getShiftTo` does
+  int64_t cycle = timeline->getCycleDuration();
+  int64_t sample = (candidate - anchor) % cycle;
+  if (sample < 0) {
+    sample += cycle;
+  }
+  if (sample > cycle / 2) {
+    sample -= cycle;
+  }
+  samples[nextSample] = sample;
+  nextSample = (nextSample + 1) % FILTER_SIZE;
+  if (sampleCount < FILTER_SIZE) {
+    ++sampleCount;
+  }
+
+  // minimum delay filter, then re-anchor so that samples stay small
+  int64_t earliest = samples[0];
+  for (uint8_t i = 1; i < sampleCount; i++) {
+    if (samples[i] < earliest) {
+      earliest = samples[i];
+    }
+  }
+  for (uint8_t i = 0; i < sampleCount; i++) {
+    samples[i] -= earliest;
+  }
+  anchor += earliest;
+  timeline->setOrigin(anchor);
+  ++acceptedCount;
+  return true;
+}
@@ -0,0 +1,29 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Phase Sync Simplist for ESP32'.
+// ---
+// 'Phase Sync Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Phase Sync Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Phase Sync Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef PHASE_SYNC_SIMPLIST_ESP32_HPP
+#define PHASE_SYNC_SIMPLIST_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "PhaseSyncSimplist.hpp"
+#include "PhaseSyncTaskEsp32.hpp"
+
+#endif
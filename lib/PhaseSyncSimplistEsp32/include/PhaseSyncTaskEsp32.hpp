@@ -0,0 +1,86 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Phase Sync Simplist for ESP32'.
+// ---
+// 'Phase Sync Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Phase Sync Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Phase Sync Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef PHASE_SYNC_TASK_ESP32_HPP
+#define PHASE_SYNC_TASK_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// project includes
+#include "HostConfigurationEventListener.hpp"
+#include "PhaseSyncSimplist.hpp"
+#include "StaticTaskEsp32.hpp"
+#include "UdpEndpointUsingSockets.hpp"
+
+/** @brief Run a phase sync agent while the host has a configuration.
+ *
+ * The local time is the one of `esp_timer_get_time()`, that is the time base
+ * of the animation timeline of the display : it is not affected by the
+ * corrections of the system time.
+ */
+class PhaseSyncTaskEsp32 : public StaticTaskEsp32,
+                           public HostConfigurationEventListener {
+private:
+  UdpEndpointUsingSockets endpoint;
+  PhaseSyncAgent agent;
+  uint8_t packet[PHASE_BEACON_SIZE * 2];
+  SemaphoreHandle_t hostConfigured;
+  volatile bool hasHostConfiguration = false;
+
+  /**
+   * @brief Run the agent until the host configuration is lost.
+   */
+  void sync();
+
+public:
+  /**
+   * @brief Setup the task.
+   *
+   * @param timeline the timeline to broadcast (leader) or to move (follower).
+   * @param role the role of this clock.
+   * @param port the UDP port of the beacons.
+   * @param beaconIntervalMs the time between two beacons of the leader.
+   * @param transitCompensationUs the minimal transit time of a beacon.
+   */
+  PhaseSyncTaskEsp32(AnimationTimeline *timeline, PhaseSyncRole role,
+                     uint16_t port, uint32_t beaconIntervalMs,
+                     uint32_t transitCompensationUs);
+  virtual ~PhaseSyncTaskEsp32();
+
+  void run(void *data);
+
+  /**
+   * @brief Event received when obtaining a host configuration.
+   *
+   * @param configuration the configuration (ip address, ...).
+   */
+  virtual void onGotConfiguration(HostConfigurationDescription *configuration);
+
+  /**
+   * @brief Previously received configuration is now invalid (destroyed).
+   *
+   */
+  virtual void onLostConfiguration();
+};
+
+#endif
@@ -0,0 +1,67 @@
+
+// header include
+#include "PhaseSyncTaskEsp32.hpp"
+
+static constexpr char *TAG = (char *)"PhaseSyncTaskEsp32";
+
+PhaseSyncTaskEsp32::~PhaseSyncTaskEsp32() {}
+// write code here...
+PhaseSyncTaskEsp32::PhaseSyncTaskEsp32(AnimationTimeline *timeline,
+                                       PhaseSyncRole role, uint16_t port,
+                                       uint32_t beaconIntervalMs,
+                                       uint32_t transitCompensationUs)
+    : StaticTaskEsp32("phase-sync"),
+      agent(&endpoint, timeline, role, port, (int64_t)beaconIntervalMs * 1000,
+            transitCompensationUs) {
+  hostConfigured = xSemaphoreCreateBinary();
+}
+
+void PhaseSyncTaskEsp32::onGotConfiguration(
+    HostConfigurationDescription *configuration) {
+  hasHostConfiguration = true;
+  if (!isStarted()) {
+    start();
+  }
+  xSemaphoreGive(hostConfigured);
+}
+
+void PhaseSyncTaskEsp32::onLostConfiguration() {
+  hasHostConfiguration = false;
+}
+
+void PhaseSyncTaskEsp32::sync() {
+  while (hasHostConfiguration) {
+    int received =
+        endpoint.receiveFrom(packet, sizeof(packet), nullptr,
+                             agent.getTimeoutMs(esp_timer_get_time()));
+    int64_t receivedAt = esp_timer_get_time();
+    countWakeUp();
+    if (received < 0) {
+      ESP_LOGE(TAG, "Error while receiving, giving up.");
+      return;
+    }
+    if (received > 0 && agent.onBeacon(packet, received, receivedAt)) {
+      ESP_LOGD(TAG, "Locked on the leader.");
+    }
+    agent.onTick(esp_timer_get_time());
+  }
+}
+
+void PhaseSyncTaskEsp32::run(void *data) {
+  while (true) {
+    xSemaphoreTake(hostConfigured, portMAX_DELAY);
+    if (!hasHostConfiguration) {
+      continue;
+    }
+    if (!agent.open()) {
+      ESP_LOGE(TAG, "Could not open the endpoint.");
+      continue;
+    }
+    ESP_LOGI(TAG, "Synchronizing the animation phase...");
+    sync();
+    agent.close();
+    ESP_LOGI(TAG, "DONE synchronizing (accepted : %lu, rejected : %lu).",
+             (unsigned long)agent.getAcceptedCount(),
+             (unsigned long)agent.getRejectedCount());
+  }
+}
@@ -0,0 +1,48 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Power Simplist'.
+// ---
+// 'Power Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Power Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Power Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef POWER_PROFILE_HPP
+#define POWER_PROFILE_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+/** @brief The way a subsystem saves energy while on battery, registered to a
+ * `PowerStateManager`.
+ *
+ * E.g. the display lowers its refresh rate and brightness, the wifi station
+ * parks its radio.
+ */
+class PowerProfile {
+public:
+  virtual ~PowerProfile();
+
+  /**
+   * @brief The supply switched to the battery, run degraded.
+   */
+  virtual void onDegraded() = 0;
+
+  /**
+   * @brief The mains power returned, restore the nominal behavior.
+   */
+  virtual void onNominal() = 0;
+};
+
+#endif
@@ -0,0 +1,49 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Power Simplist'.
+// ---
+// 'Power Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Power Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Power Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef POWER_SIMPLIST_TYPES_HPP
+#define POWER_SIMPLIST_TYPES_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+/**
+ * @brief Where the energy comes from.
+ */
+enum PowerSupplyState {
+  /**
+   * @brief Not known yet, or the probe could not tell.
+   */
+  POWER_SUPPLY_UNKNOWN,
+  /**
+   * @brief Powered by the mains adapter, everything runs nominally.
+   */
+  POWER_SUPPLY_MAINS,
+  /**
+   * @brief Riding through an outage on the battery, the subsystems run
+   * degraded.
+   */
+  POWER_SUPPLY_BATTERY
+};
+
+//**@brief Default number of identical readings before changing the state.
+const uint8_t POWER_SUPPLY_DEFAULT_CONFIRMATIONS = 3;
+
+#endif
@@ -0,0 +1,108 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Power Simplist'.
+// ---
+// 'Power Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Power Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Power Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef POWER_STATE_MANAGER_HPP
+#define POWER_STATE_MANAGER_HPP
+
+// standard includes
+#include <cstdint>
+#include <vector>
+
+// esp32 includes
+
+// project includes
+#include "PowerProfile.hpp"
+#include "PowerSimplistTypes.hpp"
+#include "PowerSupplyProbe.hpp"
+
+/** @brief Follow the state of the supply, and switch the registered profiles
+ * between nominal and degraded.
+ *
+ * A new state is accepted after a number of identical readings, so that a
+ * noisy probe does not make the subsystems flap. The profiles are degraded in
+ * the order of registration, and restored in the reverse order.
+ *
+ * ```cpp
+ * PowerStateManager *manager = (new PowerStateManager())
+ *                                  ->withProbe(probe)
+ *                                  ->withProfile(displayProfile)
+ *                                  ->withProfile(wifiProfile);
+ * // then periodically
+ * manager->update();
+ * ```
+ */
+class PowerStateManager {
+private:
+  PowerSupplyProbe *probe = nullptr;
+  std::vector<PowerProfile *> profiles;
+  uint8_t confirmations = POWER_SUPPLY_DEFAULT_CONFIRMATIONS;
+
+  PowerSupplyState state = POWER_SUPPLY_UNKNOWN;
+  PowerSupplyState candidate = POWER_SUPPLY_UNKNOWN;
+  uint8_t candidateCount = 0;
+  uint32_t transitionCount = 0;
+
+  void applyState(PowerSupplyState newState);
+
+public:
+  virtual ~PowerStateManager();
+
+  PowerStateManager *withProbe(PowerSupplyProbe *probe) {
+    this->probe = probe;
+    return this;
+  }
+
+  /**
+   * @brief Register a profile, degraded at once if already on battery.
+   *
+   * @param profile the profile.
+   * @return PowerStateManager* the manager.
+   */
+  PowerStateManager *withProfile(PowerProfile *profile);
+
+  /**
+   * @brief Setup the number of identical readings required to change the
+   * state.
+   *
+   * @param count the number of readings, at least 1.
+   * @return PowerStateManager* the manager.
+   */
+  PowerStateManager *withConfirmations(uint8_t count) {
+    confirmations = (0 < count) ? count : 1;
+    return this;
+  }
+
+  /**
+   * @brief Read the probe and switch the profiles when the state is confirmed.
+   *
+   * @return true when the state has changed.
+   */
+  bool update();
+
+  /**
+   * @brief Feed a reading, for probes that are not polled (e.g. an interrupt).
+   *
+   * @param reading the state read.
+   * @return true when the state has changed.
+   */
+  bool update(PowerSupplyState reading);
+
+  PowerSupplyState getState() { return state; }
+  bool isOnBattery() { return POWER_SUPPLY_BATTERY == state; }
+  uint32_t getTransitionCount() { return transitionCount; }
+};
+
+#endif
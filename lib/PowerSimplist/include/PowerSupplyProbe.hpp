@@ -0,0 +1,44 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Power Simplist'.
+// ---
+// 'Power Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Power Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Power Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef POWER_SUPPLY_PROBE_HPP
+#define POWER_SUPPLY_PROBE_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "PowerSimplistTypes.hpp"
+
+/** @brief Tells where the energy comes from, e.g. by reading a GPIO wired to
+ * the mains adapter, or the voltage of the supply rail.
+ */
+class PowerSupplyProbe {
+public:
+  virtual ~PowerSupplyProbe();
+
+  /**
+   * @brief Read the current state of the supply.
+   *
+   * @return PowerSupplyState the state, `POWER_SUPPLY_UNKNOWN` if the reading
+   * failed.
+   */
+  virtual PowerSupplyState read() = 0;
+};
+
+#endif
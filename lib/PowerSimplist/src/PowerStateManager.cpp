@@ -0,0 +1,73 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Power Simplist'.
+// ---
+// 'Power Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Power Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Power Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "PowerStateManager.hpp"
+
+PowerStateManager::~PowerStateManager() {}
+// write code here...
+
+PowerStateManager *PowerStateManager::withProfile(PowerProfile *profile) {
+  profiles.push_back(profile);
+  if (POWER_SUPPLY_BATTERY == state) {
+    profile->onDegraded();
+  }
+  return this;
+}
+
+bool PowerStateManager::update() {
+  if (nullptr == probe) {
+    return false;
+  }
+  return update(probe->read());
+}
+
+bool PowerStateManager::update(PowerSupplyState reading) {
+  if (POWER_SUPPLY_UNKNOWN == reading || state == reading) {
+    candidateCount = 0;
+    return false;
+  }
+  if (candidate != reading) {
+    candidate = reading;
+    candidateCount = 0;
+  }
+  ++candidateCount;
+  if (candidateCount < confirmations) {
+    return false;
+  }
+  candidateCount = 0;
+  applyState(reading);
+  return true;
+}
+
+void PowerStateManager::applyState(PowerSupplyState newState) {
+  PowerSupplyState previous = state;
+  state = newState;
+  ++transitionCount;
+  if (POWER_SUPPLY_BATTERY == newState) {
+    for (auto profile = profiles.begin(); profile != profiles.end();
+         ++profile) {
+      (*profile)->onDegraded();
+    }
+  } else if (POWER_SUPPLY_BATTERY == previous) {
+    for (auto profile = profiles.rbegin(); profile != profiles.rend();
+         ++profile) {
+      (*profile)->onNominal();
+    }
+  }
+  // else from unknown to mains : already nominal
+}
@@ -0,0 +1,91 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Power Simplist for ESP32'.
+// ---
+// 'Power Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Power Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Power Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef POWER_LOCK_ESP32_HPP
+#define POWER_LOCK_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+// sdk config
+#include "sdkconfig.h"
+
+// project includes
+
+/** @brief A named power management lock, with usage statistics.
+ *
+ * While held, the lock prevents the power management to lower the frequency
+ * or to enter light sleep, according to its type. When the power management
+ * is disabled, the lock does nothing but the statistics.
+ *
+ * The locks are meant to be created once and never deleted, they are listed
+ * by `PowerManagerEsp32::report()`.
+ */
+class PowerLockEsp32 {
+private:
+  static PowerLockEsp32 *first;
+  PowerLockEsp32 *next;
+  const char *name;
+  esp_pm_lock_handle_t handle = nullptr;
+  portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
+  uint32_t depth = 0;
+  uint32_t acquisitionCount = 0;
+  int64_t heldSince = 0;
+  int64_t heldTotal = 0;
+
+public:
+  /**
+   * @brief Create the lock.
+   *
+   * @param name the name of the lock, a static string.
+   * @param type `ESP_PM_CPU_FREQ_MAX`, `ESP_PM_APB_FREQ_MAX` or
+   * `ESP_PM_NO_LIGHT_SLEEP`.
+   */
+  PowerLockEsp32(const char *name, esp_pm_lock_type_t type);
+  virtual ~PowerLockEsp32();
+
+  /**
+   * @brief Take the lock, the calls can be nested.
+   */
+  void acquire();
+
+  /**
+   * @brief Give the lock back, once per call to `acquire()`.
+   */
+  void release();
+
+  const char *getName() { return name; }
+  bool isHeld() { return depth > 0; }
+  uint32_t getAcquisitionCount() { return acquisitionCount; }
+
+  /**
+   * @brief Get the cumulated time the lock has been held.
+   *
+   * @return int64_t the duration in microseconds.
+   */
+  int64_t getHeldMicros();
+
+  static PowerLockEsp32 *getFirst() { return first; }
+  PowerLockEsp32 *getNext() { return next; }
+};
+
+#endif
@@ -0,0 +1,62 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Power Simplist for ESP32'.
+// ---
+// 'Power Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Power Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Power Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef POWER_MANAGER_ESP32_HPP
+#define POWER_MANAGER_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+#include <cstdio>
+
+// esp32 includes
+#include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
+
+// sdk config
+#include "sdkconfig.h"
+
+// project includes
+#include "PowerLockEsp32.hpp"
+
+/** @brief Setup the dynamic frequency scaling and the automatic light sleep,
+ * and report how the power is used.
+ *
+ * Requires `CONFIG_PM_ENABLE`, and `CONFIG_FREERTOS_USE_TICKLESS_IDLE` for the
+ * light sleep. The time spent in each mode (frequency, light sleep) is
+ * reported when `CONFIG_PM_PROFILING` is enabled.
+ */
+class PowerManagerEsp32 {
+public:
+  /**
+   * @brief Apply the power management configuration.
+   *
+   * @param maxFrequencyMhz the frequency when a task requires it.
+   * @param minFrequencyMhz the frequency when idle.
+   * @param lightSleep true to enter light sleep when idle.
+   * @return true when applied.
+   */
+  static bool configure(int maxFrequencyMhz, int minFrequencyMhz,
+                        bool lightSleep);
+
+  /**
+   * @brief Log the statistics of the power locks, and the time spent in each
+   * mode when available.
+   */
+  static void report();
+};
+
+#endif
@@ -0,0 +1,70 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Power Simplist for ESP32'.
+// ---
+// 'Power Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Power Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Power Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef POWER_SUPPLY_PROBE_USING_ADC_ESP32_HPP
+#define POWER_SUPPLY_PROBE_USING_ADC_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "esp_adc/adc_cali.h"
+#include "esp_adc/adc_cali_scheme.h"
+#include "esp_adc/adc_oneshot.h"
+#include "esp_log.h"
+
+// project includes
+#include "PowerSupplyProbe.hpp"
+
+/** @brief Read the state of the supply from the voltage of a rail, through a
+ * divider : above the threshold, the mains adapter is powering the clock.
+ *
+ * The threshold has an hysteresis, so that a reading around the threshold
+ * keeps the last state.
+ */
+class PowerSupplyProbeUsingAdcEsp32 : public PowerSupplyProbe {
+private:
+  adc_oneshot_unit_handle_t unit = nullptr;
+  adc_cali_handle_t calibration = nullptr;
+  adc_channel_t channel;
+  int thresholdMillivolts;
+  int hysteresisMillivolts;
+  PowerSupplyState last = POWER_SUPPLY_UNKNOWN;
+  int lastMillivolts = 0;
+
+public:
+  /**
+   * @brief Setup the channel of the ADC1 (the ADC2 is used by the wifi).
+   *
+   * @param channel the channel of ADC1.
+   * @param thresholdMillivolts the voltage, at the pin, separating mains from
+   * battery.
+   * @param hysteresisMillivolts half the width of the band around the
+   * threshold where the state does not change.
+   */
+  PowerSupplyProbeUsingAdcEsp32(adc_channel_t channel, int thresholdMillivolts,
+                                int hysteresisMillivolts);
+  virtual ~PowerSupplyProbeUsingAdcEsp32();
+
+  virtual PowerSupplyState read();
+
+  /**
+   * @brief Get the voltage of the last successful reading.
+   */
+  int getLastMillivolts() { return lastMillivolts; }
+};
+
+#endif
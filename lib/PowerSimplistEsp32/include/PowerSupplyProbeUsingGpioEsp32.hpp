@@ -0,0 +1,52 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Power Simplist for ESP32'.
+// ---
+// 'Power Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Power Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Power Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef POWER_SUPPLY_PROBE_USING_GPIO_ESP32_HPP
+#define POWER_SUPPLY_PROBE_USING_GPIO_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "driver/gpio.h"
+#include "esp_log.h"
+
+// project includes
+#include "PowerSupplyProbe.hpp"
+
+/** @brief Read the state of the supply from a digital input, e.g. the 'power
+ * good' output of the battery management system, or a divider on the mains
+ * adapter rail.
+ */
+class PowerSupplyProbeUsingGpioEsp32 : public PowerSupplyProbe {
+private:
+  gpio_num_t pin;
+  int mainsLevel;
+
+public:
+  /**
+   * @brief Setup the input, without pull resistors.
+   *
+   * @param pin the input.
+   * @param mainsLevel the level read when on mains power.
+   */
+  PowerSupplyProbeUsingGpioEsp32(gpio_num_t pin, int mainsLevel);
+  virtual ~PowerSupplyProbeUsingGpioEsp32();
+
+  virtual PowerSupplyState read();
+};
+
+#endif
@@ -0,0 +1,56 @@
+
+// header include
+#include "PowerLockEsp32.hpp"
+
+static constexpr char *TAG = (char *)"PowerLockEsp32";
+
+PowerLockEsp32 *PowerLockEsp32::first = nullptr;
+
+PowerLockEsp32::~PowerLockEsp32() {}
+// write code here...
+
+PowerLockEsp32::PowerLockEsp32(const char *name, esp_pm_lock_type_t type)
+    : name(name) {
+#ifdef CONFIG_PM_ENABLE
+  esp_err_t err = esp_pm_lock_create(type, 0, name, &handle);
+  if (ESP_OK != err) {
+    ESP_LOGE(TAG, "Could not create lock '%s' (%s).", name,
+             esp_err_to_name(err));
+    handle = nullptr;
+  }
+#endif
+  // locks are created at startup, before the tasks use them.
+  next = first;
+  first = this;
+}
+
+void PowerLockEsp32::acquire() {
+  if (nullptr != handle) {
+    esp_pm_lock_acquire(handle);
+  }
+  portENTER_CRITICAL(&spinlock);
+  if (0 == depth++) {
+    ++acquisitionCount;
+    heldSince = esp_timer_get_time();
+  }
+  portEXIT_CRITICAL(&spinlock);
+}
+
+void PowerLockEsp32::release() {
+  portENTER_CRITICAL(&spinlock);
+  if (depth > 0 && 0 == --depth) {
+    heldTotal += esp_timer_get_time() - heldSince;
+  }
+  portEXIT_CRITICAL(&spinlock);
+  if (nullptr != handle) {
+    esp_pm_lock_release(handle);
+  }
+}
+
+int64_t PowerLockEsp32::getHeldMicros() {
+  portENTER_CRITICAL(&spinlock);
+  int64_t result =
+      heldTotal + (depth > 0 ? esp_timer_get_time() - heldSince : 0);
+  portEXIT_CRITICAL(&spinlock);
+  return result;
+}
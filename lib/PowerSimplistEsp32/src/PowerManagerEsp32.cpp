@@ -0,0 +1,45 @@
+
+// header include
+#include "PowerManagerEsp32.hpp"
+
+static constexpr char *TAG = (char *)"PowerManagerEsp32";
+
+// write code here...
+
+bool PowerManagerEsp32::configure(int maxFrequencyMhz, int minFrequencyMhz,
+                                  bool lightSleep) {
+#ifdef CONFIG_PM_ENABLE
+  esp_pm_config_t config = {.max_freq_mhz = maxFrequencyMhz,
+                            .min_freq_mhz = minFrequencyMhz,
+                            .light_sleep_enable = lightSleep};
+  esp_err_t err = esp_pm_configure(&config);
+  if (ESP_OK != err) {
+    ESP_LOGE(TAG, "Could not configure the power management (%s).",
+             esp_err_to_name(err));
+    return false;
+  }
+  ESP_LOGI(TAG, "Frequency from %d to %d MHz, light sleep %s.",
+           minFrequencyMhz, maxFrequencyMhz, lightSleep ? "on" : "off");
+  return true;
+#else
+  ESP_LOGW(TAG, "Power management is disabled (CONFIG_PM_ENABLE).");
+  return false;
+#endif
+}
+
+void PowerManagerEsp32::report() {
+  int64_t uptime = esp_timer_get_time();
+  ESP_LOGI(TAG, "Power locks after %lld s :", uptime / 1000000);
+  for (PowerLockEsp32 *lock = PowerLockEsp32::getFirst(); nullptr != lock;
+       lock = lock->getNext()) {
+    int64_t held = lock->getHeldMicros();
+    ESP_LOGI(TAG, "  %-12s acquired %6lu times, held %8lld ms (%lld.%02lld%%)",
+             lock->getName(), (unsigned long)lock->getAcquisitionCount(),
+             held / 1000, held * 100 / uptime,
+             held * 10000 / uptime % 100);
+  }
+#ifdef CONFIG_PM_ENABLE
+  // with CONFIG_PM_PROFILING, also the time spent at each frequency and asleep
+  esp_pm_dump_locks(stdout);
+#endif
+}
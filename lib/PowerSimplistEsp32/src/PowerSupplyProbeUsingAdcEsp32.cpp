@@ -0,0 +1,58 @@
+
+// header include
+#include "PowerSupplyProbeUsingAdcEsp32.hpp"
+
+static constexpr char *TAG = (char *)"PowerSupplyProbeUsingAdcEsp32";
+
+PowerSupplyProbeUsingAdcEsp32::~PowerSupplyProbeUsingAdcEsp32() {}
+// write code here...
+
+PowerSupplyProbeUsingAdcEsp32::PowerSupplyProbeUsingAdcEsp32(
+    adc_channel_t channel, int thresholdMillivolts, int hysteresisMillivolts)
+    : channel(channel), thresholdMillivolts(thresholdMillivolts),
+      hysteresisMillivolts(hysteresisMillivolts) {
+  adc_oneshot_unit_init_cfg_t unitConfig = {.unit_id = ADC_UNIT_1,
+                                            .ulp_mode = ADC_ULP_MODE_DISABLE};
+  esp_err_t err = adc_oneshot_new_unit(&unitConfig, &unit);
+  if (ESP_OK != err) {
+    ESP_LOGE(TAG, "Could not setup the ADC (%s).", esp_err_to_name(err));
+    unit = nullptr;
+    return;
+  }
+  adc_oneshot_chan_cfg_t channelConfig = {.atten = ADC_ATTEN_DB_11,
+                                          .bitwidth = ADC_BITWIDTH_DEFAULT};
+  ESP_ERROR_CHECK(adc_oneshot_config_channel(unit, channel, &channelConfig));
+
+  adc_cali_line_fitting_config_t calibrationConfig = {
+      .unit_id = ADC_UNIT_1,
+      .atten = ADC_ATTEN_DB_11,
+      .bitwidth = ADC_BITWIDTH_DEFAULT};
+  if (ESP_OK !=
+      adc_cali_create_scheme_line_fitting(&calibrationConfig, &calibration)) {
+    ESP_LOGW(TAG, "No calibration, the readings will be approximated.");
+    calibration = nullptr;
+  }
+}
+
+PowerSupplyState PowerSupplyProbeUsingAdcEsp32::read() {
+  if (nullptr == unit) {
+    return POWER_SUPPLY_UNKNOWN;
+  }
+  int raw = 0;
+  if (ESP_OK != adc_oneshot_read(unit, channel, &raw)) {
+    return POWER_SUPPLY_UNKNOWN;
+  }
+  int millivolts = 0;
+  if (nullptr == calibration ||
+      ESP_OK != adc_cali_raw_to_voltage(calibration, raw, &millivolts)) {
+    millivolts = raw * 3100 / 4095; // full scale at 11 dB
+  }
+  lastMillivolts = millivolts;
+
+  if (millivolts >= thresholdMillivolts + hysteresisMillivolts) {
+    last = POWER_SUPPLY_MAINS;
+  } else if (millivolts <= thresholdMillivolts - hysteresisMillivolts) {
+    last = POWER_SUPPLY_BATTERY;
+  }
+  return last;
+}
@@ -0,0 +1,27 @@
+
+// header include
+#include "PowerSupplyProbeUsingGpioEsp32.hpp"
+
+static constexpr char *TAG = (char *)"PowerSupplyProbeUsingGpioEsp32";
+
+PowerSupplyProbeUsingGpioEsp32::~PowerSupplyProbeUsingGpioEsp32() {}
+// write code here...
+
+PowerSupplyProbeUsingGpioEsp32::PowerSupplyProbeUsingGpioEsp32(
+    gpio_num_t pin, int mainsLevel)
+    : pin(pin), mainsLevel(mainsLevel ? 1 : 0) {
+  gpio_config_t config = {.pin_bit_mask = 1ULL << pin,
+                          .mode = GPIO_MODE_INPUT,
+                          .pull_up_en = GPIO_PULLUP_DISABLE,
+                          .pull_down_en = GPIO_PULLDOWN_DISABLE,
+                          .intr_type = GPIO_INTR_DISABLE};
+  esp_err_t err = gpio_config(&config);
+  if (ESP_OK != err) {
+    ESP_LOGE(TAG, "Could not setup GPIO %d (%s).", pin, esp_err_to_name(err));
+  }
+}
+
+PowerSupplyState PowerSupplyProbeUsingGpioEsp32::read() {
+  return (mainsLevel == gpio_get_level(pin)) ? POWER_SUPPLY_MAINS
+                                             : POWER_SUPPLY_BATTERY;
+}
@@ -0,0 +1,95 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist'.
+// ---
+// 'Scheduler Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef JITTER_MONITOR_HPP
+#define JITTER_MONITOR_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "SchedulerSimplistTypes.hpp"
+
+/** @brief Follow the lateness of the wake ups of a periodic or scheduled
+ * loop.
+ *
+ * The loop tells when it expected to wake up and when it actually did, e.g.
+ * the deadline of its timer and the time read just after waking up. An early
+ * wake up counts as no lateness.
+ */
+class JitterProbe {
+private:
+  JitterStatistics statistics;
+
+public:
+  JitterProbe() {}
+  virtual ~JitterProbe();
+
+  void setup(const char *name, uint32_t deadlineUs);
+
+  /**
+   * @brief Record a wake up.
+   *
+   * @param expectedUs the expected time of the wake up.
+   * @param actualUs the actual time of the wake up.
+   */
+  void record(int64_t expectedUs, int64_t actualUs);
+
+  /**
+   * @brief Copy the statistics since the previous call, then start again.
+   *
+   * A wake up recorded meanwhile by another task may be lost, it is harmless
+   * for a monitor.
+   */
+  void takeStatistics(JitterStatistics *target);
+
+  const char *getName() { return statistics.name; }
+};
+
+/** @brief A set of jitter probes, to find the loops that are late the most.
+ */
+class JitterMonitor {
+private:
+  JitterProbe probes[JITTER_MAX_PROBES];
+  uint8_t probeCount = 0;
+
+public:
+  virtual ~JitterMonitor();
+
+  /**
+   * @brief Get a probe for a loop.
+   *
+   * @param name the name of the loop.
+   * @param deadlineUs the lateness above which a wake up is a deadline miss.
+   * @return JitterProbe* the probe, or nullptr when there are too many probes.
+   */
+  JitterProbe *createProbe(const char *name, uint32_t deadlineUs);
+
+  /**
+   * @brief Take the statistics of every probe, the worst offenders first :
+   * most deadline misses, then highest lateness.
+   *
+   * @param target the statistics, must hold JITTER_MAX_PROBES items.
+   * @return uint8_t the number of statistics written.
+   */
+  uint8_t takeStatistics(JitterStatistics *target);
+
+  uint8_t getProbeCount() { return probeCount; }
+};
+
+#endif
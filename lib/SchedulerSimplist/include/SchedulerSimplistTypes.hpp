@@ -0,0 +1,94 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist'.
+// ---
+// 'Scheduler Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef SCHEDULER_SIMPLIST_TYPES_HPP
+#define SCHEDULER_SIMPLIST_TYPES_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+//**@brief Number of levels of the timer wheel.
+const uint8_t TIMER_WHEEL_LEVELS = 4;
+
+//**@brief Each level has 2^TIMER_WHEEL_SLOT_BITS slots.
+const uint8_t TIMER_WHEEL_SLOT_BITS = 6;
+
+//**@brief Number of slots of each level.
+const uint16_t TIMER_WHEEL_SLOTS = 1 << TIMER_WHEEL_SLOT_BITS;
+
+//**@brief Deadline of a timer wheel without jobs.
+const uint64_t TIMER_WHEEL_NEVER = UINT64_MAX;
+
+//**@brief Maximum number of loops followed by a jitter monitor.
+const uint8_t JITTER_MAX_PROBES = 12;
+
+//**@brief Number of buckets of the jitter histograms.
+const uint8_t JITTER_BUCKETS = 7;
+
+//**@brief Upper bounds (excluded) of the buckets of the jitter histograms, the
+// last bucket has no upper bound.
+const uint32_t JITTER_BUCKET_BOUNDS_US[JITTER_BUCKETS - 1] = {
+    100, 500, 1000, 5000, 10000, 50000};
+
+/** @brief The lateness of the wake ups of a loop, over a period.
+ */
+struct JitterStatistics {
+  const char *name;
+  /** @brief Lateness above which a wake up is a deadline miss. */
+  uint32_t deadlineUs;
+  uint32_t count;
+  uint32_t misses;
+  uint32_t maxUs;
+  uint64_t sumUs;
+  uint32_t histogram[JITTER_BUCKETS];
+};
+
+//**@brief Maximum number of tasks followed by a task usage tracker.
+const uint8_t TASK_USAGE_MAX_TASKS = 24;
+
+/** @brief The counters of a task, read by the monitor at a given time.
+ */
+struct TaskSample {
+  /** @brief Unique identifier of the task, e.g. its handle. */
+  uintptr_t id;
+  const char *name;
+  /** @brief Running time since the start, in the unit of the run time clock,
+   * wrapping around. */
+  uint32_t runTime;
+  /** @brief Lowest amount of unused stack since the start. */
+  uint32_t stackFree;
+  /** @brief Number of wake ups since the start, wrapping around. */
+  uint32_t wakeUps;
+};
+
+/** @brief The usage of a task between two samples.
+ */
+struct TaskUsage {
+  uintptr_t id;
+  const char *name;
+  /** @brief Share of the cpu time, in thousandths of all the cores. */
+  uint32_t cpuPermille;
+  /** @brief Lowest amount of unused stack since the start. */
+  uint32_t stackFree;
+  /** @brief Number of wake ups since the previous sample. */
+  uint32_t wakeUps;
+};
+
+#endif
@@ -0,0 +1,68 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist'.
+// ---
+// 'Scheduler Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef TASK_USAGE_TRACKER_HPP
+#define TASK_USAGE_TRACKER_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "SchedulerSimplistTypes.hpp"
+
+/** @brief Turn the cumulated counters of the tasks into the usage between two
+ * samplings.
+ *
+ * The counters are allowed to wrap around, as long as they do not wrap twice
+ * between two samplings. The first sampling of a task is compared to zero,
+ * i.e. to its start. At most TASK_USAGE_MAX_TASKS tasks are followed, the
+ * extra tasks are ignored.
+ */
+class TaskUsageTracker {
+private:
+  TaskSample previous[TASK_USAGE_MAX_TASKS];
+  uint8_t previousCount = 0;
+  uint32_t previousTotal = 0;
+  uint8_t cores;
+
+  const TaskSample *findPrevious(uintptr_t id);
+
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param cores the number of cores sharing the run time clock.
+   */
+  TaskUsageTracker(uint8_t cores = 1) : cores(0 < cores ? cores : 1) {}
+  virtual ~TaskUsageTracker();
+
+  /**
+   * @brief Compute the usage of each task since the previous sampling.
+   *
+   * @param samples the counters of the tasks.
+   * @param count the number of samples.
+   * @param totalRunTime the run time clock, wrapping around.
+   * @param usages the usage of each sampled task, in the same order, must hold
+   * `count` items.
+   * @return uint8_t the number of usages written.
+   */
+  uint8_t update(const TaskSample *samples, uint8_t count,
+                 uint32_t totalRunTime, TaskUsage *usages);
+};
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist'.
+// ---
+// 'Scheduler Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef TIMER_JOB_HPP
+#define TIMER_JOB_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "SchedulerSimplistTypes.hpp"
+
+/** @brief A periodic or one shot job, to be run by a `TimerWheel`.
+ *
+ * The job holds its own links into the wheel, so that scheduling and
+ * cancelling do not allocate. A job can be scheduled in one wheel at a time.
+ */
+class TimerJob {
+  friend class TimerWheel;
+
+private:
+  TimerJob *previous = nullptr;
+  TimerJob *next = nullptr;
+  /**
+   * @brief The list containing the job, null when not scheduled.
+   */
+  TimerJob **list = nullptr;
+  uint64_t deadline = 0;
+  uint64_t period = 0;
+  uint8_t level = 0;
+
+public:
+  virtual ~TimerJob();
+
+  /**
+   * @brief Do the work of the job. The job can be scheduled again or cancelled
+   * from there.
+   *
+   * @param now the current tick.
+   */
+  virtual void onTimer(uint64_t now) = 0;
+
+  bool isScheduled() { return nullptr != list; }
+  uint64_t getDeadline() { return deadline; }
+  uint64_t getPeriod() { return period; }
+};
+
+#endif
@@ -0,0 +1,111 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist'.
+// ---
+// 'Scheduler Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "SchedulerSimplistTypes.hpp"
+#include "TimerJob.hpp"
+
+/** @brief Run many periodic and one shot jobs from a single task, using a
+ * hierarchical timer wheel.
+ *
+ * The time is counted in ticks, whose duration is chosen by the caller. Each
+ * level has 64 slots ; a slot of the level `n` spans 64^n ticks. Scheduling
+ * and cancelling are O(1), a job is moved to a lower level at most once per
+ * level. Deadlines beyond the range of the wheel (64^4 ticks, e.g. 46 hours
+ * with 10 ms ticks) are parked in the highest level until they get closer.
+ *
+ * The wheel does not wait by itself, the caller sleeps until
+ * `getNextDeadline()` then calls `advance()`. It is not thread safe.
+ */
+class TimerWheel {
+private:
+  TimerJob *slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+  uint64_t current = 0;
+  uint32_t lowestLevelCount = 0;
+  uint32_t jobCount = 0;
+  uint32_t runCount = 0;
+
+  static uint16_t slotAt(uint64_t tick, uint8_t level) {
+    return (tick >> (level * TIMER_WHEEL_SLOT_BITS)) & (TIMER_WHEEL_SLOTS - 1);
+  }
+  static void link(TimerJob *job, TimerJob **list);
+  static void unlink(TimerJob *job);
+  void insert(TimerJob *job);
+  void remove(TimerJob *job);
+  /**
+   * @brief Move the jobs of a slot to the lower levels.
+   */
+  void cascade(uint8_t level, uint16_t slot);
+  /**
+   * @brief Run the jobs of the current tick.
+   *
+   * @param now the tick to reach, to schedule the periodic jobs after it.
+   */
+  void runCurrent(uint64_t now);
+
+public:
+  TimerWheel();
+  virtual ~TimerWheel();
+
+  /**
+   * @brief Schedule a job, replacing its previous schedule if any.
+   *
+   * @param job the job.
+   * @param delay the number of ticks before the first run, 0 to run at the
+   * next tick.
+   * @param period the number of ticks between two runs, 0 for a one shot job.
+   */
+  void schedule(TimerJob *job, uint64_t delay, uint64_t period = 0);
+
+  /**
+   * @brief Unschedule a job, if scheduled.
+   *
+   * @param job the job.
+   */
+  void cancel(TimerJob *job);
+
+  /**
+   * @brief Run all the jobs due until the given tick.
+   *
+   * A periodic job keeps its phase : the missed runs are skipped, not run in
+   * a burst.
+   *
+   * @param now the current tick, the wheel does not go back.
+   * @return uint32_t the number of runs.
+   */
+  uint32_t advance(uint64_t now);
+
+  /**
+   * @brief Get the first tick having a job to run.
+   *
+   * @return uint64_t the tick, or `TIMER_WHEEL_NEVER`.
+   */
+  uint64_t getNextDeadline();
+
+  uint64_t getCurrentTick() { return current; }
+  uint32_t getJobCount() { return jobCount; }
+  uint32_t getRunCount() { return runCount; }
+};
+
+#endif
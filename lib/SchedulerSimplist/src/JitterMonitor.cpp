@@ -0,0 +1,93 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist'.
+// ---
+// 'Scheduler Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "JitterMonitor.hpp"
+
+JitterProbe::~JitterProbe() {}
+JitterMonitor::~JitterMonitor() {}
+// write code here...
+
+static void clear(JitterStatistics *statistics) {
+  statistics->count = 0;
+  statistics->misses = 0;
+  statistics->maxUs = 0;
+  statistics->sumUs = 0;
+  for (uint8_t i = 0; i < JITTER_BUCKETS; i++) {
+    statistics->histogram[i] = 0;
+  }
+}
+
+static bool isWorse(const JitterStatistics *a, const JitterStatistics *b) {
+  return a->misses > b->misses ||
+         (a->misses == b->misses && a->maxUs > b->maxUs);
+}
+
+void JitterProbe::setup(const char *name, uint32_t deadlineUs) {
+  statistics.name = name;
+  statistics.deadlineUs = deadlineUs;
+  clear(&statistics);
+}
+
+void JitterProbe::record(int64_t expectedUs, int64_t actualUs) {
+  uint32_t lateness =
+      actualUs > expectedUs ? (uint32_t)(actualUs - expectedUs) : 0;
+  uint8_t bucket = 0;
+  while (bucket < JITTER_BUCKETS - 1 &&
+         lateness >= JITTER_BUCKET_BOUNDS_US[bucket]) {
+    ++bucket;
+  }
+  ++statistics.histogram[bucket];
+  ++statistics.count;
+  statistics.sumUs += lateness;
+  if (lateness > statistics.maxUs) {
+    statistics.maxUs = lateness;
+  }
+  if (lateness > statistics.deadlineUs) {
+    ++statistics.misses;
+  }
+}
+
+void JitterProbe::takeStatistics(JitterStatistics *target) {
+  *target = statistics;
+  clear(&statistics);
+}
+
+JitterProbe *JitterMonitor::createProbe(const char *name,
+                                        uint32_t deadlineUs) {
+  if (probeCount >= JITTER_MAX_PROBES) {
+    return nullptr;
+  }
+  JitterProbe *probe = &probes[probeCount++];
+  probe->setup(name, deadlineUs);
+  return probe;
+}
+
+uint8_t JitterMonitor::takeStatistics(JitterStatistics *target) {
+  for (uint8_t i = 0; i < probeCount; i++) {
+    // insertion sort, the worst first
+    JitterStatistics taken;
+    probes[i].takeStatistics(&taken);
+    uint8_t j = i;
+    while (j > 0 && isWorse(&taken, &target[j - 1])) {
+      target[j] = target[j - 1];
+      --j;
+    }
+    target[j] = taken;
+  }
+  return probeCount;
+}
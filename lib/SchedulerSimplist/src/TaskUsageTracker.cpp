@@ -0,0 +1,60 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist'.
+// ---
+// 'Scheduler Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "TaskUsageTracker.hpp"
+
+TaskUsageTracker::~TaskUsageTracker() {}
+// write code here...
+
+const TaskSample *TaskUsageTracker::findPrevious(uintptr_t id) {
+  for (uint8_t i = 0; i < previousCount; i++) {
+    if (id == previous[i].id) {
+      return &previous[i];
+    }
+  }
+  return nullptr;
+}
+
+uint8_t TaskUsageTracker::update(const TaskSample *samples, uint8_t count,
+                                 uint32_t totalRunTime, TaskUsage *usages) {
+  if (count > TASK_USAGE_MAX_TASKS) {
+    count = TASK_USAGE_MAX_TASKS;
+  }
+  uint64_t elapsed = uint64_t(totalRunTime - previousTotal) * cores;
+  for (uint8_t i = 0; i < count; i++) {
+    const TaskSample &sample = samples[i];
+    const TaskSample *before = findPrevious(sample.id);
+    uint32_t runTime =
+        sample.runTime - (nullptr != before ? before->runTime : 0);
+    usages[i].id = sample.id;
+    usages[i].name = sample.name;
+    usages[i].cpuPermille =
+        0 < elapsed ? uint32_t(uint64_t(runTime) * 1000 / elapsed) : 0;
+    usages[i].stackFree = sample.stackFree;
+    usages[i].wakeUps =
+        sample.wakeUps - (nullptr != before ? before->wakeUps : 0);
+  }
+
+  // the tasks that are gone are forgotten
+  for (uint8_t i = 0; i < count; i++) {
+    previous[i] = samples[i];
+  }
+  previousCount = count;
+  previousTotal = totalRunTime;
+  return count;
+}
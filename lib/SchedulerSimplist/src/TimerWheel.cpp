@@ -0,0 +1,187 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist'.
+// ---
+// 'Scheduler Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "TimerWheel.hpp"
+
+TimerWheel::~TimerWheel() {}
+// write code here...
+
+TimerWheel::TimerWheel() {
+  for (uint8_t level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+    for (uint16_t slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+      slots[level][slot] = nullptr;
+    }
+  }
+}
+
+void TimerWheel::link(TimerJob *job, TimerJob **list) {
+  job->list = list;
+  job->previous = nullptr;
+  job->next = *list;
+  if (nullptr != *list) {
+    (*list)->previous = job;
+  }
+  *list = job;
+}
+
+void TimerWheel::unlink(TimerJob *job) {
+  if (nullptr != job->previous) {
+    job->previous->next = job->next;
+  } else {
+    *(job->list) = job->next;
+  }
+  if (nullptr != job->next) {
+    job->next->previous = job->previous;
+  }
+  job->previous = nullptr;
+  job->next = nullptr;
+  job->list = nullptr;
+}
+
+void TimerWheel::insert(TimerJob *job) {
+  // only a cascade can insert a job due at the current tick
+  uint64_t due = job->deadline > current ? job->deadline : current;
+  uint64_t delta = due - current;
+  uint8_t level = 0;
+  while (level < TIMER_WHEEL_LEVELS - 1 &&
+         delta >> ((level + 1) * TIMER_WHEEL_SLOT_BITS) > 0) {
+    ++level;
+  }
+  uint64_t range = (uint64_t)1 << (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOT_BITS);
+  if (delta >= range) {
+    // park it in the highest level, until it gets closer
+    due = current + range - 1;
+  }
+  job->level = level;
+  link(job, &slots[level][slotAt(due, level)]);
+  if (0 == level) {
+    ++lowestLevelCount;
+  }
+  ++jobCount;
+}
+
+void TimerWheel::remove(TimerJob *job) {
+  unlink(job);
+  if (0 == job->level) {
+    --lowestLevelCount;
+  }
+  --jobCount;
+}
+
+void TimerWheel::cascade(uint8_t level, uint16_t slot) {
+  TimerJob *job = slots[level][slot];
+  slots[level][slot] = nullptr;
+  while (nullptr != job) {
+    TimerJob *next = job->next;
+    job->list = nullptr;
+    --jobCount;
+    insert(job);
+    job = next;
+  }
+}
+
+void TimerWheel::runCurrent(uint64_t now) {
+  // detach the jobs, the callbacks may change the schedule.
+  TimerJob *due = nullptr;
+  TimerJob **slot = &slots[0][slotAt(current, 0)];
+  while (nullptr != *slot) {
+    TimerJob *job = *slot;
+    remove(job);
+    link(job, &due);
+  }
+  while (nullptr != due) {
+    TimerJob *job = due;
+    unlink(job);
+    if (job->deadline > current) {
+      insert(job); // not expected, but not due either
+      continue;
+    }
+    if (job->period > 0) {
+      // the next run after now, a late job does not run in burst.
+      uint64_t late = now - job->deadline;
+      job->deadline += (late / job->period + 1) * job->period;
+      insert(job);
+    }
+    ++runCount;
+    job->onTimer(current);
+  }
+}
+
+void TimerWheel::schedule(TimerJob *job, uint64_t delay, uint64_t period) {
+  cancel(job);
+  job->deadline = current + (delay > 0 ? delay : 1);
+  job->period = period;
+  insert(job);
+}
+
+void TimerWheel::cancel(TimerJob *job) {
+  if (job->isScheduled()) {
+    if (job->list >= &slots[0][0] &&
+        job->list < &slots[0][0] + TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS) {
+      remove(job);
+    } else {
+      unlink(job); // detached, waiting to be run
+    }
+  }
+}
+
+uint32_t TimerWheel::advance(uint64_t now) {
+  uint32_t runsBefore = runCount;
+  while (current < now) {
+    if (0 == lowestLevelCount) {
+      // nothing to do before the next cascade
+      uint64_t last = current | (TIMER_WHEEL_SLOTS - 1);
+      if (last >= now) {
+        current = now;
+        break;
+      }
+      current = last;
+    }
+    ++current;
+    // cascade from the highest level, to the lowest
+    uint8_t level = 0;
+    while (level < TIMER_WHEEL_LEVELS - 1 && 0 == slotAt(current, level)) {
+      ++level;
+    }
+    for (; level > 0; level--) {
+      cascade(level, slotAt(current, level));
+    }
+    runCurrent(now);
+  }
+  return runCount - runsBefore;
+}
+
+uint64_t TimerWheel::getNextDeadline() {
+  uint64_t result = TIMER_WHEEL_NEVER;
+  for (uint8_t level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+    uint16_t start = slotAt(current, level);
+    // the first non empty slot after the current one has the earliest jobs.
+    for (uint16_t i = 1; i <= TIMER_WHEEL_SLOTS; i++) {
+      TimerJob *job = slots[level][(start + i) & (TIMER_WHEEL_SLOTS - 1)];
+      if (nullptr == job) {
+        continue;
+      }
+      for (; nullptr != job; job = job->next) {
+        uint64_t due = job->deadline > current ? job->deadline : current + 1;
+        result = due < result ? due : result;
+      }
+      break;
+    }
+  }
+  return result;
+}
@@ -0,0 +1,64 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist for ESP32'.
+// ---
+// 'Scheduler Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef JITTER_MONITOR_ESP32_HPP
+#define JITTER_MONITOR_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "esp_log.h"
+
+// project includes
+#include "SchedulerSimplist.hpp"
+
+/** @brief A job logging the jitter of the loops, the worst offenders first.
+ *
+ * The probes are to be created during the setup, before the loops use them.
+ *
+ * ```cpp
+ * JitterMonitorEsp32 *monitor = new JitterMonitorEsp32();
+ * myTask->withJitterProbe(monitor->createProbe("my-task", 5000));
+ * service->schedule(monitor, 60000, 60000); // every minute
+ * ```
+ */
+class JitterMonitorEsp32 : public TimerJob {
+private:
+  JitterMonitor monitor;
+  JitterStatistics statistics[JITTER_MAX_PROBES];
+
+public:
+  virtual ~JitterMonitorEsp32();
+
+  /**
+   * @brief Get a probe for a loop.
+   *
+   * @param name the name of the loop.
+   * @param deadlineUs the lateness above which a wake up is a deadline miss.
+   * @return JitterProbe* the probe, or nullptr when there are too many probes.
+   */
+  JitterProbe *createProbe(const char *name, uint32_t deadlineUs);
+
+  /**
+   * @brief Log the jitter of each loop since the previous report.
+   */
+  void report();
+
+  void onTimer(uint64_t now) { report(); }
+};
+
+#endif
@@ -0,0 +1,32 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist for ESP32'.
+// ---
+// 'Scheduler Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef SCHEDULER_SIMPLIST_ESP32_HPP
+#define SCHEDULER_SIMPLIST_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "SchedulerSimplist.hpp"
+#include "StaticTaskEsp32.hpp"
+#include "JitterMonitorEsp32.hpp"
+#include "TaskMonitorEsp32.hpp"
+#include "TimerServiceEsp32.hpp"
+
+#endif
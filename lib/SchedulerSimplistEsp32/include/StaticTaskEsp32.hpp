@@ -0,0 +1,120 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist for ESP32'.
+// ---
+// 'Scheduler Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef STATIC_TASK_ESP32_HPP
+#define STATIC_TASK_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// project includes
+
+//**@brief Default stack size, in bytes.
+const uint32_t STATIC_TASK_DEFAULT_STACK_SIZE = 8192;
+//**@brief Default priority.
+const UBaseType_t STATIC_TASK_DEFAULT_PRIORITY = 5;
+//**@brief Core value for a task without affinity.
+const int STATIC_TASK_ANY_CORE = -1;
+
+/** @brief A task, whose stack and control block can be reserved at compile
+ * time.
+ *
+ * When a stack is given before the start, the task is created with
+ * `xTaskCreateStatic` and uses no heap at all ; otherwise the stack comes
+ * from the heap, as usual. A task runs only once, it must not be started
+ * again.
+ */
+class StaticTaskEsp32 {
+private:
+  const char *name;
+  uint32_t stackSize;
+  UBaseType_t priority;
+  int core = STATIC_TASK_ANY_CORE;
+  StackType_t *stack = nullptr;
+  StaticTask_t control;
+  TaskHandle_t handle = nullptr;
+  void *data = nullptr;
+  volatile uint32_t wakeUps = 0;
+
+  static void runTask(void *task);
+
+protected:
+  /**
+   * @brief To be called by `run()` each time the task wakes up, for the task
+   * monitor.
+   */
+  void countWakeUp() { wakeUps = wakeUps + 1; }
+
+public:
+  StaticTaskEsp32(const char *name = "task",
+                  uint32_t stackSize = STATIC_TASK_DEFAULT_STACK_SIZE,
+                  UBaseType_t priority = STATIC_TASK_DEFAULT_PRIORITY)
+      : name(name), stackSize(stackSize), priority(priority) {}
+  virtual ~StaticTaskEsp32();
+
+  /**
+   * @brief Use the given stack instead of a stack from the heap.
+   *
+   * @param stack the stack, to be kept for the whole life of the task.
+   * @param size the size of the stack, in bytes.
+   */
+  void setStack(StackType_t *stack, uint32_t size) {
+    this->stack = stack;
+    this->stackSize = size;
+  }
+  void setName(const char *name) { this->name = name; }
+  void setPriority(UBaseType_t priority) { this->priority = priority; }
+  /**
+   * @brief Size of the stack taken from the heap, ignored when a stack is
+   * given.
+   */
+  void setStackSize(uint32_t size) {
+    if (nullptr == stack) {
+      this->stackSize = size;
+    }
+  }
+  /**
+   * @brief Pin the task to a core.
+   *
+   * @param core the core, STATIC_TASK_ANY_CORE (or a core that does not
+   * exist) to let the task run on any core.
+   */
+  void setCore(int core) { this->core = core; }
+
+  /**
+   * @brief Create the task, that calls `run()`.
+   *
+   * @param data given to `run()`.
+   */
+  void start(void *data = nullptr);
+
+  virtual void run(void *data) = 0;
+
+  bool isStarted() { return nullptr != handle; }
+  TaskHandle_t getHandle() { return handle; }
+  const char *getName() { return name; }
+  uint32_t getStackSize() { return stackSize; }
+  int getCore() { return core; }
+  bool isStatic() { return nullptr != stack; }
+  uint32_t getWakeUps() { return wakeUps; }
+};
+
+#endif
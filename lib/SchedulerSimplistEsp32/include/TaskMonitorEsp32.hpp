@@ -0,0 +1,98 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist for ESP32'.
+// ---
+// 'Scheduler Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef TASK_MONITOR_ESP32_HPP
+#define TASK_MONITOR_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// project includes
+#include "SchedulerSimplist.hpp"
+#include "StaticTaskEsp32.hpp"
+
+//**@brief Maximum number of tasks whose wake ups are counted.
+const uint8_t TASK_MONITOR_MAX_WATCHED = 12;
+
+//**@brief Default unused stack, in bytes, below which a warning is logged.
+const uint32_t TASK_MONITOR_DEFAULT_STACK_WARNING = 512;
+
+/** @brief A job reporting the cpu share, the unused stack and the wake ups of
+ * the tasks, to size the stacks and find the wasted cycles.
+ *
+ * The cpu share and the system tasks (e.g. wifi, event loop, idle) require
+ * `CONFIG_FREERTOS_USE_TRACE_FACILITY` and
+ * `CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS` ; otherwise only the watched
+ * tasks are reported, without cpu share. The wake ups are known only for the
+ * watched tasks.
+ *
+ * ```cpp
+ * TaskMonitorEsp32 *monitor = new TaskMonitorEsp32();
+ * monitor->withTask(myTask)->withTask(myOtherTask);
+ * service->schedule(monitor, 60000, 60000); // every minute
+ * ```
+ */
+class TaskMonitorEsp32 : public TimerJob {
+private:
+  StaticTaskEsp32 *watched[TASK_MONITOR_MAX_WATCHED];
+  uint8_t watchedCount = 0;
+  uint32_t stackWarning;
+  TaskUsageTracker tracker;
+  TaskSample samples[TASK_USAGE_MAX_TASKS];
+  TaskUsage usages[TASK_USAGE_MAX_TASKS];
+  uint8_t usageCount = 0;
+  int64_t lastSampling;
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+  TaskStatus_t status[TASK_USAGE_MAX_TASKS];
+#endif
+
+  uint32_t wakeUpsOf(TaskHandle_t handle);
+  uint8_t sample(uint32_t *totalRunTime);
+
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param stackWarning the unused stack, in bytes, below which a warning is
+   * logged.
+   */
+  TaskMonitorEsp32(uint32_t stackWarning = TASK_MONITOR_DEFAULT_STACK_WARNING);
+  virtual ~TaskMonitorEsp32();
+
+  /**
+   * @brief Count the wake ups of the given task.
+   */
+  TaskMonitorEsp32 *withTask(StaticTaskEsp32 *task);
+
+  /**
+   * @brief Sample the tasks and log their usage since the previous run.
+   */
+  void onTimer(uint64_t now);
+
+  uint8_t getUsageCount() { return usageCount; }
+  /**
+   * @brief The usage of each task between the two last runs.
+   */
+  const TaskUsage *getUsages() { return usages; }
+};
+
+#endif
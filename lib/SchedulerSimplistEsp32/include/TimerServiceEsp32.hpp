@@ -0,0 +1,100 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist for ESP32'.
+// ---
+// 'Scheduler Simplist for ESP32' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist for ESP32' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist for ESP32'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef TIMER_SERVICE_ESP32_HPP
+#define TIMER_SERVICE_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// project includes
+#include "SchedulerSimplist.hpp"
+#include "StaticTaskEsp32.hpp"
+
+/** @brief A single task running the periodic and one shot jobs of the
+ * firmware, instead of a task per job.
+ *
+ * The task sleeps until the next deadline of its timer wheel, the jobs are run
+ * from the task and must be short. The methods can be called from any task,
+ * including from the jobs.
+ *
+ * ```cpp
+ * TimerServiceEsp32 *service = new TimerServiceEsp32();
+ * service->start();
+ * service->schedule(myJob, 0, 100); // every 100 ms
+ * ```
+ */
+class TimerServiceEsp32 : public StaticTaskEsp32 {
+private:
+  TimerWheel wheel;
+  uint32_t tickMicros;
+  SemaphoreHandle_t lock;
+  SemaphoreHandle_t wakeUp;
+  JitterProbe *jitterProbe = nullptr;
+
+  uint64_t toTicks(uint32_t milliseconds) {
+    return ((uint64_t)milliseconds * 1000 + tickMicros - 1) / tickMicros;
+  }
+
+public:
+  /**
+   * @brief Setup the service.
+   *
+   * @param tickMicros the resolution of the service.
+   */
+  TimerServiceEsp32(uint32_t tickMicros = 10000);
+  virtual ~TimerServiceEsp32();
+
+  void run(void *data);
+
+  /**
+   * @brief Record the lateness of the wake ups at the deadlines of the jobs.
+   */
+  TimerServiceEsp32 *withJitterProbe(JitterProbe *probe) {
+    jitterProbe = probe;
+    return this;
+  }
+
+  /**
+   * @brief Schedule a job, replacing its previous schedule if any.
+   *
+   * @param job the job.
+   * @param delayMs the delay before the first run, 0 to run as soon as
+   * possible.
+   * @param periodMs the time between two runs, 0 for a one shot job.
+   */
+  void schedule(TimerJob *job, uint32_t delayMs, uint32_t periodMs = 0);
+
+  /**
+   * @brief Unschedule a job, if scheduled.
+   *
+   * @param job the job.
+   */
+  void cancel(TimerJob *job);
+
+  /**
+   * @brief Get the number of runs since the start, for statistics.
+   */
+  uint32_t getRunCount() { return wheel.getRunCount(); }
+};
+
+#endif
@@ -0,0 +1,39 @@
+
+// header include
+#include "JitterMonitorEsp32.hpp"
+
+static constexpr char *TAG = (char *)"JitterMonitorEsp32";
+
+JitterMonitorEsp32::~JitterMonitorEsp32() {}
+// write code here...
+
+JitterProbe *JitterMonitorEsp32::createProbe(const char *name,
+                                             uint32_t deadlineUs) {
+  JitterProbe *probe = monitor.createProbe(name, deadlineUs);
+  if (nullptr == probe) {
+    ESP_LOGW(TAG, "Too many probes, '%s' is not monitored.", name);
+  }
+  return probe;
+}
+
+void JitterMonitorEsp32::report() {
+  uint8_t count = monitor.takeStatistics(statistics);
+  ESP_LOGI(TAG, "Lateness of %d loops, worst first (histogram : <100us, "
+                "<500us, <1ms, <5ms, <10ms, <50ms, more) :",
+           count);
+  for (uint8_t i = 0; i < count; i++) {
+    const JitterStatistics &s = statistics[i];
+    const uint32_t *h = s.histogram;
+    esp_log_level_t level = 0 < s.misses ? ESP_LOG_WARN : ESP_LOG_INFO;
+    ESP_LOG_LEVEL(level, TAG,
+                  "  %-16s %lu wake ups, mean %lu us, max %lu us, %lu missed "
+                  "(> %lu us) [%lu %lu %lu %lu %lu %lu %lu]",
+                  s.name, (unsigned long)s.count,
+                  (unsigned long)(0 < s.count ? s.sumUs / s.count : 0),
+                  (unsigned long)s.maxUs, (unsigned long)s.misses,
+                  (unsigned long)s.deadlineUs, (unsigned long)h[0],
+                  (unsigned long)h[1], (unsigned long)h[2],
+                  (unsigned long)h[3], (unsigned long)h[4],
+                  (unsigned long)h[5], (unsigned long)h[6]);
+  }
+}
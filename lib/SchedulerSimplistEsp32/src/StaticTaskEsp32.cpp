@@ -0,0 +1,35 @@
+
+// header include
+#include "StaticTaskEsp32.hpp"
+
+static constexpr char *TAG = (char *)"StaticTaskEsp32";
+
+StaticTaskEsp32::~StaticTaskEsp32() {}
+// write code here...
+
+void StaticTaskEsp32::runTask(void *task) {
+  StaticTaskEsp32 *self = (StaticTaskEsp32 *)task;
+  self->run(self->data);
+  ESP_LOGW(TAG, "Task '%s' ended.", self->name);
+  vTaskDelete(nullptr);
+}
+
+void StaticTaskEsp32::start(void *data) {
+  if (isStarted()) {
+    ESP_LOGW(TAG, "Task '%s' already started.", name);
+    return;
+  }
+  this->data = data;
+  BaseType_t coreId =
+      0 <= core && core < portNUM_PROCESSORS ? core : tskNO_AFFINITY;
+  if (nullptr != stack) {
+    handle = xTaskCreateStaticPinnedToCore(runTask, name, stackSize, this,
+                                           priority, stack, &control, coreId);
+  } else if (pdPASS != xTaskCreatePinnedToCore(runTask, name, stackSize, this,
+                                               priority, &handle, coreId)) {
+    handle = nullptr;
+  }
+  if (nullptr == handle) {
+    ESP_LOGE(TAG, "Could not create the task '%s'.", name);
+  }
+}
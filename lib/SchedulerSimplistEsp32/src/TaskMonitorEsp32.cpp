@@ -0,0 +1,99 @@
+
+// header include
+#include "TaskMonitorEsp32.hpp"
+
+static constexpr char *TAG = (char *)"TaskMonitorEsp32";
+
+TaskMonitorEsp32::~TaskMonitorEsp32() {}
+// write code here...
+
+TaskMonitorEsp32::TaskMonitorEsp32(uint32_t stackWarning)
+    : stackWarning(stackWarning), tracker(portNUM_PROCESSORS),
+      lastSampling(esp_timer_get_time()) {}
+
+TaskMonitorEsp32 *TaskMonitorEsp32::withTask(StaticTaskEsp32 *task) {
+  if (nullptr == task) {
+    return this;
+  }
+  if (watchedCount >= TASK_MONITOR_MAX_WATCHED) {
+    ESP_LOGW(TAG, "Too many tasks, '%s' is not watched.", task->getName());
+    return this;
+  }
+  watched[watchedCount++] = task;
+  return this;
+}
+
+uint32_t TaskMonitorEsp32::wakeUpsOf(TaskHandle_t handle) {
+  for (uint8_t i = 0; i < watchedCount; i++) {
+    if (handle == watched[i]->getHandle()) {
+      return watched[i]->getWakeUps();
+    }
+  }
+  return 0;
+}
+
+uint8_t TaskMonitorEsp32::sample(uint32_t *totalRunTime) {
+  *totalRunTime = 0;
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+  configRUN_TIME_COUNTER_TYPE total = 0;
+  UBaseType_t count =
+      uxTaskGetSystemState(status, TASK_USAGE_MAX_TASKS, &total);
+  if (0 < count) {
+    for (UBaseType_t i = 0; i < count; i++) {
+      samples[i].id = (uintptr_t)status[i].xHandle;
+      samples[i].name = status[i].pcTaskName;
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+      samples[i].runTime = (uint32_t)status[i].ulRunTimeCounter;
+#else
+      samples[i].runTime = 0;
+#endif
+      samples[i].stackFree = status[i].usStackHighWaterMark;
+      samples[i].wakeUps = wakeUpsOf(status[i].xHandle);
+    }
+    *totalRunTime = (uint32_t)total;
+    return count;
+  }
+  ESP_LOGW(TAG, "More than %d tasks, only the watched tasks are reported.",
+           TASK_USAGE_MAX_TASKS);
+#endif
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < watchedCount; i++) {
+    StaticTaskEsp32 *task = watched[i];
+    if (!task->isStarted()) {
+      continue;
+    }
+    samples[count].id = (uintptr_t)task->getHandle();
+    samples[count].name = task->getName();
+    samples[count].runTime = 0;
+    samples[count].stackFree = uxTaskGetStackHighWaterMark(task->getHandle());
+    samples[count].wakeUps = task->getWakeUps();
+    ++count;
+  }
+  return count;
+}
+
+void TaskMonitorEsp32::onTimer(uint64_t now) {
+  uint32_t totalRunTime;
+  uint8_t count = sample(&totalRunTime);
+  usageCount = tracker.update(samples, count, totalRunTime, usages);
+
+  int64_t sampledAt = esp_timer_get_time();
+  uint32_t elapsedMs = (uint32_t)((sampledAt - lastSampling) / 1000);
+  lastSampling = sampledAt;
+
+  ESP_LOGI(TAG, "%d tasks over %lu ms :", usageCount, (unsigned long)elapsedMs);
+  for (uint8_t i = 0; i < usageCount; i++) {
+    const TaskUsage &usage = usages[i];
+    ESP_LOGI(TAG, "  %-16s cpu %3lu.%lu%%, stack %5lu, wake ups %lu (%lu/s)",
+             usage.name, (unsigned long)(usage.cpuPermille / 10),
+             (unsigned long)(usage.cpuPermille % 10),
+             (unsigned long)usage.stackFree, (unsigned long)usage.wakeUps,
+             (unsigned long)(0 < elapsedMs
+                                 ? (uint64_t)usage.wakeUps * 1000 / elapsedMs
+                                 : 0));
+    if (usage.stackFree < stackWarning) {
+      ESP_LOGW(TAG, "  %s has only %lu bytes of unused stack.", usage.name,
+               (unsigned long)usage.stackFree);
+    }
+  }
+}
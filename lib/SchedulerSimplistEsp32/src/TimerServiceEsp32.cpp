@@ -0,0 +1,55 @@
+
+// header include
+#include "TimerServiceEsp32.hpp"
+
+TimerServiceEsp32::~TimerServiceEsp32() {}
+// write code here...
+
+TimerServiceEsp32::TimerServiceEsp32(uint32_t tickMicros)
+    : StaticTaskEsp32("timer-service"), tickMicros(tickMicros) {
+  // the jobs may use the service from the task holding the lock
+  lock = xSemaphoreCreateRecursiveMutex();
+  wakeUp = xSemaphoreCreateBinary();
+}
+
+void TimerServiceEsp32::run(void *data) {
+  while (true) {
+    countWakeUp();
+    xSemaphoreTakeRecursive(lock, portMAX_DELAY);
+    uint64_t now = esp_timer_get_time() / tickMicros;
+    wheel.advance(now);
+    uint64_t next = wheel.getNextDeadline();
+    xSemaphoreGiveRecursive(lock);
+
+    TickType_t sleep = portMAX_DELAY;
+    if (TIMER_WHEEL_NEVER != next) {
+      uint64_t sleepMs = ((next - now) * tickMicros + 999) / 1000;
+      sleep = sleepMs >= portMAX_DELAY / portTICK_PERIOD_MS
+                  ? portMAX_DELAY - 1
+                  : pdMS_TO_TICKS(sleepMs);
+    }
+    if (pdTRUE != xSemaphoreTake(wakeUp, sleep) && nullptr != jitterProbe &&
+        TIMER_WHEEL_NEVER != next) {
+      // woken up by the deadline of a job
+      jitterProbe->record((int64_t)(next * tickMicros), esp_timer_get_time());
+    }
+  }
+}
+
+void TimerServiceEsp32::schedule(TimerJob *job, uint32_t delayMs,
+                                 uint32_t periodMs) {
+  xSemaphoreTakeRecursive(lock, portMAX_DELAY);
+  // the wheel may be late on the current time
+  wheel.schedule(job,
+                 esp_timer_get_time() / tickMicros - wheel.getCurrentTick() +
+                     toTicks(delayMs),
+                 toTicks(periodMs));
+  xSemaphoreGiveRecursive(lock);
+  xSemaphoreGive(wakeUp);
+}
+
+void TimerServiceEsp32::cancel(TimerJob *job) {
+  xSemaphoreTakeRecursive(lock, portMAX_DELAY);
+  wheel.cancel(job);
+  xSemaphoreGiveRecursive(lock);
+}
@@ -0,0 +1,103 @@
+#ifndef NETWORK_TIME_KEEPER_BROADCAST_ESP32_HPP
+#define NETWORK_TIME_KEEPER_BROADCAST_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+#include <sys/time.h>
+#include <time.h>
+
+// esp32 includes
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// project includes
+#include "HostConfigurationEventListener.hpp"
+#include "NtpSimplist.hpp"
+#include "PowerLockEsp32.hpp"
+#include "StaticTaskEsp32.hpp"
+#include "UdpEndpointUsingSockets.hpp"
+
+/** @brief Synchronize time by listening to the beacons of a broadcast or
+ * multicast NTP server.
+ *
+ * Once per host configuration, the delay to the server is calibrated with a
+ * unicast exchange ; afterwards nothing is sent, so that a whole fleet of
+ * clocks does not load the time server.
+ *
+ * The listening is done by a dedicated task, started by the first host
+ * configuration.
+ */
+class NetworkTimeKeeperBroadcastEsp32 : public StaticTaskEsp32,
+                                        public HostConfigurationEventListener {
+private:
+  /** @brief Time to wait for the reply to a calibration request. */
+  static const uint32_t CALIBRATION_TIMEOUT_MS = 2000;
+  /** @brief Calibration attempts before waiting for another server. */
+  static const uint8_t MAX_CALIBRATION_ATTEMPTS = 5;
+  /** @brief Time to wait for beacons before checking the host configuration.
+   */
+  static const uint32_t LISTENING_TIMEOUT_MS = 10000;
+
+  /**
+   * @brief Dotted address of the multicast group to join, or `nullptr` to
+   * listen to broadcasts only.
+   */
+  const char *multicastGroup;
+  UdpEndpointUsingSockets endpoint;
+  NtpBroadcastClient client;
+  uint8_t packet[NTP_PACKET_SIZE];
+  /**
+   * @brief Given by `onGotConfiguration` to wake up the task.
+   */
+  SemaphoreHandle_t hostConfigured;
+  volatile bool hasHostConfiguration = false;
+  /**
+   * @brief Held during the calibration exchange.
+   */
+  PowerLockEsp32 exchangeLock =
+      PowerLockEsp32("sntp-calib", ESP_PM_NO_LIGHT_SLEEP);
+  bool exchanging = false;
+  void setExchanging(bool value);
+
+  static int64_t now();
+  /**
+   * @brief Step or slew the system clock according to the last offset.
+   */
+  void applyCorrection();
+  /**
+   * @brief Send the calibration request to the adopted server.
+   */
+  void sendCalibrationRequest();
+  /**
+   * @brief Listen and correct the clock until the host configuration is lost.
+   */
+  void listen();
+
+public:
+  NetworkTimeKeeperBroadcastEsp32(const char *multicastGroup = nullptr);
+  virtual ~NetworkTimeKeeperBroadcastEsp32();
+
+  void run(void *data);
+
+  /**
+   * @brief Event received when obtaining a host configuration.
+   *
+   * @param configuration the configuration (ip address, ...).
+   */
+  virtual void onGotConfiguration(HostConfigurationDescription *configuration);
+
+  /**
+   * @brief Previously received configuration is now invalid (destroyed).
+   *
+   */
+  virtual void onLostConfiguration();
+
+  /**
+   * @brief Access to the client, e.g. to read its statistics.
+   */
+  NtpBroadcastClient *getClient() { return &client; }
+};
+
+#endif
@@ -3,6 +3,7 @@
 
 // standard includes
 #include <cstdint>
+#include <cstring>
 #include <time.h>
 #include <sys/time.h>
 
@@ -16,6 +17,7 @@
 
 // project includes
 #include "HostConfigurationEventListener.hpp"
+#include "PowerLockEsp32.hpp"
 
 /** @brief Synchronize time using SNTP.
  * 
@@ -24,6 +26,25 @@
 class NetworkTimeKeeperEsp32 : public HostConfigurationEventListener {
 private:
   esp_sntp_config_t config;
+  /**
+   * @brief The SNTP client is initialized once, then restarted at each new
+   * host configuration (e.g. connect on demand).
+   */
+  bool initialized = false;
+  /**
+   * @brief Between a host configuration and its loss.
+   */
+  bool connected = false;
+  /**
+   * @brief Held while waiting for the first synchronization.
+   */
+  PowerLockEsp32 exchangeLock =
+      PowerLockEsp32("sntp", ESP_PM_NO_LIGHT_SLEEP);
+
+  /**
+   * @brief Callback of the SNTP client, called at each synchronization.
+   */
+  static void onTimeSynchronized(struct timeval *tv);
 
 public:
   NetworkTimeKeeperEsp32(char* defaultSntpTimeServer);
@@ -42,6 +63,36 @@ public:
    *
    */
   virtual void onLostConfiguration();
+
+  /**
+   * @brief Send a synchronization request now, when there is a host
+   * configuration.
+   *
+   * @return true when a request has been sent.
+   */
+  bool resynchronize();
+
+  /**
+   * @brief Tells whether the system time has been set at least once.
+   */
+  bool isSynchronized();
+
+  /**
+   * @brief Get the time of the last synchronization.
+   *
+   * @return int64_t microseconds since the unix epoch, 0 if never.
+   */
+  int64_t getLastSynchronization();
+
+  /**
+   * @brief Get the IPv4 address of the first reachable server, to be used as
+   * reference identifier when serving time.
+   *
+   * @param referenceId where to store the address, left untouched if there is
+   * none.
+   * @return true when an address has been found.
+   */
+  bool getReferenceId(uint8_t *referenceId);
 };
 
 #endif
\ No newline at end of file
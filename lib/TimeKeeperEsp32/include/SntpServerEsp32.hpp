@@ -0,0 +1,91 @@
+#ifndef SNTP_SERVER_ESP32_HPP
+#define SNTP_SERVER_ESP32_HPP
+
+// standard includes
+#include <cstdint>
+#include <sys/time.h>
+
+// esp32 includes
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// project includes
+#include "HostConfigurationEventListener.hpp"
+#include "NetworkTimeKeeperEsp32.hpp"
+#include "NtpSimplist.hpp"
+#include "StaticTaskEsp32.hpp"
+#include "UdpEndpointUsingSockets.hpp"
+
+/** @brief Serve the time to the LAN, as a SNTP server one stratum below the
+ * upstream server.
+ *
+ * Requests are answered only once the time keeper has synchronized the system
+ * time. The packet path does not allocate : the buffers are members, and the
+ * replies are preformatted by the responder.
+ */
+class SntpServerEsp32 : public StaticTaskEsp32,
+                        public HostConfigurationEventListener {
+private:
+  /** @brief Time to wait for requests before refreshing the reference. */
+  static const uint32_t RECEIVE_TIMEOUT_MS = 1000;
+  /** @brief Clock frequency tolerance (15 ppm), to grow the dispersion. */
+  static const int64_t TOLERANCE_PPM = 15;
+
+  NetworkTimeKeeperEsp32 *timeKeeper;
+  uint8_t upstreamStratum;
+  NtpRateLimiter limiter;
+  SntpResponder responder;
+  UdpEndpointUsingSockets endpoint;
+  uint8_t request[NTP_PACKET_SIZE];
+  uint8_t reply[NTP_PACKET_SIZE];
+  SntpReference reference;
+  SemaphoreHandle_t hostConfigured;
+  volatile bool hasHostConfiguration = false;
+
+  static int64_t now();
+  /**
+   * @brief Update the reference of the responder from the time keeper.
+   */
+  void refreshReference();
+  /**
+   * @brief Answer requests until the host configuration is lost.
+   */
+  void serve();
+
+public:
+  /**
+   * @brief Setup the server.
+   *
+   * @param timeKeeper the time keeper that synchronizes the system time.
+   * @param upstreamStratum the stratum of the upstream server.
+   * @param maxPerSecond the maximum number of replies per second.
+   * @param clientMinIntervalMs the sustained interval between two requests of
+   * a client.
+   */
+  SntpServerEsp32(NetworkTimeKeeperEsp32 *timeKeeper, uint8_t upstreamStratum,
+                  uint32_t maxPerSecond, uint32_t clientMinIntervalMs);
+  virtual ~SntpServerEsp32();
+
+  void run(void *data);
+
+  /**
+   * @brief Event received when obtaining a host configuration.
+   *
+   * @param configuration the configuration (ip address, ...).
+   */
+  virtual void onGotConfiguration(HostConfigurationDescription *configuration);
+
+  /**
+   * @brief Previously received configuration is now invalid (destroyed).
+   *
+   */
+  virtual void onLostConfiguration();
+
+  /**
+   * @brief Access to the responder, e.g. to read its statistics.
+   */
+  SntpResponder *getResponder() { return &responder; }
+};
+
+#endif
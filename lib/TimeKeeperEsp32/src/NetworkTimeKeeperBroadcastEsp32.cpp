@@ -0,0 +1,154 @@
+
+// header include
+#include "NetworkTimeKeeperBroadcastEsp32.hpp"
+
+static constexpr char *TAG = (char *)"NetworkTimeKeeperBroadcastEsp32";
+
+NetworkTimeKeeperBroadcastEsp32::~NetworkTimeKeeperBroadcastEsp32() {}
+// write code here...
+NetworkTimeKeeperBroadcastEsp32::NetworkTimeKeeperBroadcastEsp32(
+    const char *multicastGroup)
+    : StaticTaskEsp32("ntp-broadcast"), multicastGroup(multicastGroup) {
+  hostConfigured = xSemaphoreCreateBinary();
+}
+
+int64_t NetworkTimeKeeperBroadcastEsp32::now() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+void NetworkTimeKeeperBroadcastEsp32::onGotConfiguration(
+    HostConfigurationDescription *configuration) {
+  hasHostConfiguration = true;
+  if (!isStarted()) {
+    start();
+  }
+  xSemaphoreGive(hostConfigured);
+}
+
+void NetworkTimeKeeperBroadcastEsp32::onLostConfiguration() {
+  hasHostConfiguration = false;
+}
+
+void NetworkTimeKeeperBroadcastEsp32::applyCorrection() {
+  int64_t offset = client.getOffset();
+  if (client.isStepRequired()) {
+    int64_t corrected = now() + offset;
+    struct timeval tv = {.tv_sec = (time_t)(corrected / 1000000),
+                         .tv_usec = (suseconds_t)(corrected % 1000000)};
+    settimeofday(&tv, NULL);
+    ESP_LOGI(TAG, "Stepped clock by %lld us", offset);
+  } else {
+    struct timeval delta = {.tv_sec = (time_t)(offset / 1000000),
+                            .tv_usec = (suseconds_t)(offset % 1000000)};
+    adjtime(&delta, NULL);
+    ESP_LOGD(TAG, "Slewing clock by %lld us", offset);
+  }
+}
+
+void NetworkTimeKeeperBroadcastEsp32::setExchanging(bool value) {
+  if (value == exchanging) {
+    return;
+  }
+  exchanging = value;
+  if (exchanging) {
+    exchangeLock.acquire();
+  } else {
+    exchangeLock.release();
+  }
+}
+
+void NetworkTimeKeeperBroadcastEsp32::sendCalibrationRequest() {
+  size_t size = client.prepareCalibrationRequest(packet, now());
+  endpoint.sendTo(client.getServer(), packet, size);
+}
+
+void NetworkTimeKeeperBroadcastEsp32::listen() {
+  UdpPeer sender;
+  uint8_t calibrationAttempts = 0;
+  // on the monotonic clock, the system clock being stepped by the corrections
+  int64_t calibrationDeadline = 0;
+  client.restart();
+  while (hasHostConfiguration) {
+    bool calibrating =
+        client.isCalibrationRequired() && calibrationAttempts > 0;
+    setExchanging(calibrating);
+    uint32_t timeoutMs = LISTENING_TIMEOUT_MS;
+    if (calibrating) {
+      int64_t remaining = calibrationDeadline - esp_timer_get_time();
+      timeoutMs = remaining > 1000 ? (uint32_t)(remaining / 1000) : 1;
+    }
+    int received =
+        endpoint.receiveFrom(packet, sizeof(packet), &sender, timeoutMs);
+    int64_t receivedAt = now();
+    countWakeUp();
+    if (received < 0) {
+      ESP_LOGE(TAG, "Error while listening, giving up.");
+      break;
+    }
+    if (received > 0) {
+      if (client.acceptCalibrationReply(packet, received, &sender,
+                                        receivedAt)) {
+        ESP_LOGI(TAG, "Calibrated, one way delay : %lld us",
+                 client.getOneWayDelay());
+        calibrationAttempts = 0;
+        applyCorrection();
+        continue;
+      }
+      if (client.acceptBeacon(packet, received, &sender, receivedAt)) {
+        applyCorrection();
+        continue;
+      }
+      if (client.isCalibrationRequired() && 0 == calibrationAttempts) {
+        ESP_LOGI(TAG, "Got a beacon from %d.%d.%d.%d, calibrating...",
+                 sender.address.v4[0], sender.address.v4[1],
+                 sender.address.v4[2], sender.address.v4[3]);
+        ++calibrationAttempts;
+        sendCalibrationRequest();
+        calibrationDeadline =
+            esp_timer_get_time() + CALIBRATION_TIMEOUT_MS * 1000;
+        continue;
+      }
+    }
+    // retry when the reply is late, even if beacons keep coming
+    if (client.isCalibrationRequired() && calibrationAttempts > 0 &&
+        esp_timer_get_time() >= calibrationDeadline) {
+      if (calibrationAttempts >= MAX_CALIBRATION_ATTEMPTS) {
+        ESP_LOGW(TAG, "Could not calibrate, waiting for another beacon.");
+        calibrationAttempts = 0;
+        client.restart();
+      } else {
+        ++calibrationAttempts;
+        sendCalibrationRequest();
+        calibrationDeadline =
+            esp_timer_get_time() + CALIBRATION_TIMEOUT_MS * 1000;
+      }
+    }
+  }
+  setExchanging(false);
+}
+
+void NetworkTimeKeeperBroadcastEsp32::run(void *data) {
+  while (true) {
+    xSemaphoreTake(hostConfigured, portMAX_DELAY);
+    if (!hasHostConfiguration) {
+      continue;
+    }
+    if (!endpoint.open(NTP_PORT, true)) {
+      ESP_LOGE(TAG, "Could not listen to port %d", NTP_PORT);
+      continue;
+    }
+    if (nullptr != multicastGroup && 0 != multicastGroup[0]) {
+      IpAddress group;
+      if (!endpoint.resolve(multicastGroup, &group) ||
+          !endpoint.joinMulticastGroup(&group)) {
+        ESP_LOGW(TAG, "Could not join multicast group %s", multicastGroup);
+      }
+    }
+    ESP_LOGI(TAG, "Listening to NTP beacons...");
+    listen();
+    endpoint.close();
+    ESP_LOGI(TAG, "DONE listening to NTP beacons.");
+  }
+}
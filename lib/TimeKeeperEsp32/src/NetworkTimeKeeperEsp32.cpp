@@ -6,6 +6,11 @@ static constexpr char *TAG = (char *)"NetworkTimeKeeperEsp32";
 
 #define INET6_ADDRSTRLEN 48
 
+/**
+ * @brief Updated by the SNTP client callback, there is only one SNTP client.
+ */
+static volatile int64_t lastSynchronization = 0;
+
 NetworkTimeKeeperEsp32::~NetworkTimeKeeperEsp32() {}
 // write code here...
 NetworkTimeKeeperEsp32::NetworkTimeKeeperEsp32(char *defaultSntpTimeServer) {
@@ -15,7 +20,7 @@ NetworkTimeKeeperEsp32::NetworkTimeKeeperEsp32(char *defaultSntpTimeServer) {
       .server_from_dhcp = true, // accept NTP offers from DHCP server
       .wait_for_sync = true,
       .start = false, // start SNTP service explicitly (after connecting)
-      .sync_cb = NULL,
+      .sync_cb = onTimeSynchronized,
       .renew_servers_after_new_IP =
           true, // let esp-netif update configured SNTP server(s) after
                 // receiving DHCP lease
@@ -36,8 +41,12 @@ bool doSomething(HostConfigurationDescription *configuration) {
 void NetworkTimeKeeperEsp32::onGotConfiguration(
     HostConfigurationDescription *configuration) {
   ESP_LOGI(TAG, "Starting SNTP");
-  esp_netif_sntp_init(&config); // won't succeed at retrieving DHCP time server
-  esp_netif_sntp_start();
+  if (!initialized) {
+    esp_netif_sntp_init(&config); // won't succeed at retrieving DHCP time server
+    initialized = true;
+  }
+  connected = true;
+  esp_netif_sntp_start(); // (re)start, so that a sync request is sent now
 
   ESP_LOGI(TAG, "List of configured NTP servers:");
 
@@ -53,7 +62,8 @@ void NetworkTimeKeeperEsp32::onGotConfiguration(
     }
   }
 
-  // wait for time to be set
+  // wait for time to be set, without sleeping in the middle of the exchange
+  exchangeLock.acquire();
   time_t now = 0;
   struct tm timeinfo = {0};
   int retry = 0;
@@ -64,19 +74,57 @@ void NetworkTimeKeeperEsp32::onGotConfiguration(
     ESP_LOGI(TAG, "Waiting for system time to be set... (%d/%d)", retry,
              retry_count);
   }
+  exchangeLock.release();
   if (retry >= retry_count) {
     ESP_LOGE(TAG, "COULD NOT sync time");
   } else {
     ESP_LOGE(TAG, "Could sync time");
   }
   char strftime_buf[64];
-  // Set timezone to Paris, France and print local time
-  setenv("TZ", "CET-1CEST-2,M3.5.0/02:00:00,M10.5.0/03:00:00", 1);
-  tzset();
+  // the timezone is set by the application
   time(&now);
   localtime_r(&now, &timeinfo);
   strftime(strftime_buf, sizeof(strftime_buf), "%c", &timeinfo);
   ESP_LOGI(TAG, "The current date/time with timezone is: %s", strftime_buf);
 }
 
-void NetworkTimeKeeperEsp32::onLostConfiguration() {}
\ No newline at end of file
+void NetworkTimeKeeperEsp32::onLostConfiguration() {
+  connected = false;
+  if (initialized) {
+    ESP_LOGI(TAG, "Stopping SNTP");
+    esp_sntp_stop(); // no point polling servers without a network
+  }
+}
+
+bool NetworkTimeKeeperEsp32::resynchronize() {
+  if (!connected) {
+    return false;
+  }
+  ESP_LOGI(TAG, "Resynchronizing now");
+  esp_netif_sntp_start(); // a restart sends a request at once
+  return true;
+}
+
+void NetworkTimeKeeperEsp32::onTimeSynchronized(struct timeval *tv) {
+  lastSynchronization = (int64_t)tv->tv_sec * 1000000 + tv->tv_usec;
+}
+
+bool NetworkTimeKeeperEsp32::isSynchronized() {
+  return 0 != lastSynchronization;
+}
+
+int64_t NetworkTimeKeeperEsp32::getLastSynchronization() {
+  return lastSynchronization;
+}
+
+bool NetworkTimeKeeperEsp32::getReferenceId(uint8_t *referenceId) {
+  for (uint8_t i = 0; i < SNTP_MAX_SERVERS; ++i) {
+    ip_addr_t const *ip = esp_sntp_getserver(i);
+    if (nullptr != ip && IP_IS_V4(ip) && 0 != esp_sntp_getreachability(i)) {
+      uint32_t address = ip4_addr_get_u32(ip_2_ip4(ip));
+      memcpy(referenceId, &address, 4); // already in network order
+      return true;
+    }
+  }
+  return false;
+}
\ No newline at end of file
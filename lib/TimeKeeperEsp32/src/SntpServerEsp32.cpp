@@ -0,0 +1,107 @@
+
+// header include
+#include "SntpServerEsp32.hpp"
+
+static constexpr char *TAG = (char *)"SntpServerEsp32";
+
+SntpServerEsp32::~SntpServerEsp32() {}
+// write code here...
+SntpServerEsp32::SntpServerEsp32(NetworkTimeKeeperEsp32 *timeKeeper,
+                                 uint8_t upstreamStratum,
+                                 uint32_t maxPerSecond,
+                                 uint32_t clientMinIntervalMs)
+    : StaticTaskEsp32("sntp-server"), timeKeeper(timeKeeper),
+      upstreamStratum(upstreamStratum),
+      limiter(maxPerSecond, maxPerSecond / 4 + 1,
+              (int64_t)clientMinIntervalMs * 1000),
+      responder(&limiter) {
+  hostConfigured = xSemaphoreCreateBinary();
+  memset(&reference, 0, sizeof(reference));
+}
+
+int64_t SntpServerEsp32::now() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+void SntpServerEsp32::onGotConfiguration(
+    HostConfigurationDescription *configuration) {
+  hasHostConfiguration = true;
+  if (!isStarted()) {
+    start();
+  }
+  xSemaphoreGive(hostConfigured);
+}
+
+void SntpServerEsp32::onLostConfiguration() {
+  hasHostConfiguration = false;
+  responder.loseReference();
+}
+
+void SntpServerEsp32::refreshReference() {
+  if (!timeKeeper->isSynchronized()) {
+    responder.loseReference();
+    return;
+  }
+  int64_t lastSynchronization = timeKeeper->getLastSynchronization();
+  int64_t elapsed = now() - lastSynchronization;
+  reference.upstreamStratum = upstreamStratum;
+  timeKeeper->getReferenceId(reference.referenceId);
+  reference.referenceTime = lastSynchronization;
+  reference.precision = -20; // ~1 us, resolution of gettimeofday()
+  reference.rootDelay = 0;
+  // 16.16 fixed point seconds, growing with the time since synchronization
+  reference.rootDispersion =
+      (uint32_t)(elapsed * TOLERANCE_PPM * 65536 / 1000000000000LL);
+  responder.updateReference(&reference);
+}
+
+void SntpServerEsp32::serve() {
+  UdpPeer client;
+  refreshReference();
+  int64_t lastRefresh = now();
+  while (hasHostConfiguration) {
+    int received = endpoint.receiveFrom(request, sizeof(request), &client,
+                                        RECEIVE_TIMEOUT_MS);
+    int64_t receivedAt = now();
+    countWakeUp();
+    if (received < 0) {
+      ESP_LOGE(TAG, "Error while serving, giving up.");
+      return;
+    }
+    if (receivedAt - lastRefresh >= RECEIVE_TIMEOUT_MS * 1000) {
+      refreshReference();
+      lastRefresh = receivedAt;
+    }
+    if (0 == received) {
+      continue;
+    }
+    size_t size = responder.respond(request, received, &client, receivedAt,
+                                    now(), reply);
+    if (size > 0) {
+      endpoint.sendTo(&client, reply, size);
+    }
+  }
+}
+
+void SntpServerEsp32::run(void *data) {
+  while (true) {
+    xSemaphoreTake(hostConfigured, portMAX_DELAY);
+    if (!hasHostConfiguration) {
+      continue;
+    }
+    if (!endpoint.open(NTP_PORT, false)) {
+      ESP_LOGE(TAG, "Could not listen to port %d", NTP_PORT);
+      continue;
+    }
+    ESP_LOGI(TAG, "Serving time...");
+    serve();
+    endpoint.close();
+    ESP_LOGI(TAG, "DONE serving time (answered : %lu, kissed : %lu, dropped "
+                  ": %lu).",
+             (unsigned long)responder.getAnsweredCount(),
+             (unsigned long)responder.getKissedCount(),
+             (unsigned long)responder.getDroppedCount());
+  }
+}
@@ -0,0 +1,95 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Time Keeper Simplist'.
+// ---
+// 'Time Keeper Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Time Keeper Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Time Keeper Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef MANUAL_TIME_SETTER_HPP
+#define MANUAL_TIME_SETTER_HPP
+
+// standard includes
+#include <cstdint>
+#include <time.h>
+
+// esp32 includes
+
+// project includes
+#include "TimeKeeperSimplistTypes.hpp"
+
+/** @brief Change the hour, then the minutes, of the local time by steps.
+ *
+ * The setting starts from the current local time, each field wraps around
+ * without changing the other one. When done, the new time is computed from the
+ * current date, the seconds being reset, so that it can be given at once to
+ * the system clock.
+ */
+class ManualTimeSetter {
+private:
+  bool active = false;
+  ManualTimeField field = MANUAL_TIME_HOUR;
+  uint8_t hour = 0;
+  uint8_t minutes = 0;
+
+public:
+  virtual ~ManualTimeSetter();
+
+  /**
+   * @brief Start changing the hour.
+   *
+   * @param local the current local time.
+   */
+  void begin(const struct tm *local);
+
+  /**
+   * @brief Change the current field.
+   *
+   * @param steps the steps, negative to go backward.
+   */
+  void step(int32_t steps);
+
+  /**
+   * @brief Go from the hour to the minutes.
+   *
+   * @return true when there was a next field, false when the minutes were
+   * being changed already (the setting is to be committed).
+   */
+  bool nextField();
+
+  /**
+   * @brief End the setting.
+   *
+   * @param now the current time, giving the date.
+   * @return time_t the new time, the date of `now` at the chosen hour and
+   * minutes.
+   */
+  time_t commit(time_t now);
+
+  /**
+   * @brief End the setting without changing anything.
+   */
+  void cancel() { active = false; }
+
+  /**
+   * @brief Write the time being set, as for the display.
+   *
+   * @param buffer at least 5 characters, 'HHMM' and the terminator.
+   */
+  void format(char *buffer);
+
+  bool isActive() { return active; }
+  ManualTimeField getField() { return field; }
+  uint8_t getHour() { return hour; }
+  uint8_t getMinutes() { return minutes; }
+};
+
+#endif
@@ -0,0 +1,51 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Time Keeper Simplist'.
+// ---
+// 'Time Keeper Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Time Keeper Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Time Keeper Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef TIME_KEEPER_SIMPLIST_TYPES_HPP
+#define TIME_KEEPER_SIMPLIST_TYPES_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+
+/**
+ * @brief Where the current time comes from.
+ */
+enum TimeSource {
+  /**
+   * @brief Not set since the power on, the time is garbage.
+   */
+  TIME_SOURCE_NONE,
+  /**
+   * @brief Set by hand with the control panel, until the network gives a better
+   * time.
+   */
+  TIME_SOURCE_MANUAL,
+  /**
+   * @brief Synchronized from the network.
+   */
+  TIME_SOURCE_NETWORK
+};
+
+/**
+ * @brief The field being changed by the manual setting.
+ */
+enum ManualTimeField { MANUAL_TIME_HOUR, MANUAL_TIME_MINUTES };
+
+#endif
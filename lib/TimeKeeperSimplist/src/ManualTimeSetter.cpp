@@ -0,0 +1,69 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Time Keeper Simplist'.
+// ---
+// 'Time Keeper Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Time Keeper Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Time Keeper Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "ManualTimeSetter.hpp"
+
+ManualTimeSetter::~ManualTimeSetter() {}
+// write code here...
+
+static uint8_t wrap(int32_t value, int32_t steps, int32_t modulo) {
+  int32_t result = (value + steps % modulo) % modulo;
+  return (uint8_t)(0 > result ? result + modulo : result);
+}
+
+void ManualTimeSetter::begin(const struct tm *local) {
+  active = true;
+  field = MANUAL_TIME_HOUR;
+  hour = local->tm_hour;
+  minutes = local->tm_min;
+}
+
+void ManualTimeSetter::step(int32_t steps) {
+  if (MANUAL_TIME_HOUR == field) {
+    hour = wrap(hour, steps, 24);
+  } else {
+    minutes = wrap(minutes, steps, 60);
+  }
+}
+
+bool ManualTimeSetter::nextField() {
+  if (MANUAL_TIME_HOUR == field) {
+    field = MANUAL_TIME_MINUTES;
+    return true;
+  }
+  return false;
+}
+
+time_t ManualTimeSetter::commit(time_t now) {
+  active = false;
+  struct tm local;
+  localtime_r(&now, &local);
+  local.tm_hour = hour;
+  local.tm_min = minutes;
+  local.tm_sec = 0;
+  local.tm_isdst = -1; // let mktime find out
+  return mktime(&local);
+}
+
+void ManualTimeSetter::format(char *buffer) {
+  buffer[0] = '0' + hour / 10;
+  buffer[1] = '0' + hour % 10;
+  buffer[2] = '0' + minutes / 10;
+  buffer[3] = '0' + minutes % 10;
+  buffer[4] = 0;
+}
@@ -0,0 +1,110 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Wifi Simplist'.
+// ---
+// 'Wifi Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Wifi Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Wifi Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef WIFI_ACCESS_POINT_SELECTOR_HPP
+#define WIFI_ACCESS_POINT_SELECTOR_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "WifiCredentials.hpp"
+#include "WifiCredentialsRegistry.hpp"
+#include "WifiSimplistTypes.hpp"
+
+/**
+ * @brief An access point of a known network, to try to connect to.
+ */
+struct WifiCandidate {
+  /** @brief The credentials of the network, from the registry. */
+  WifiCredentials *credentials;
+  /** @brief The access point, as scanned. */
+  WifiScannedAccessPoint accessPoint;
+  /** @brief The position of the network in the registry, 0 being the best. */
+  uint8_t rank;
+  /** @brief The signal, lowered by the rank, the greater the better. */
+  int16_t score;
+};
+
+/** @brief From the access points found by a single scan, select the ones of
+ * the known networks and order them, the best first, so that the absent
+ * networks are never tried.
+ *
+ * The score of an access point is its signal, lowered by a given amount per
+ * step in the ranking of its network : a network ranked after another one is
+ * tried first only when its signal is that much stronger. The access points
+ * with a too weak signal are dropped.
+ */
+class WifiAccessPointSelector {
+private:
+  WifiCandidate candidates[MAX_SCANNED_ACCESS_POINTS];
+  uint8_t count = 0;
+  uint8_t cursor = 0;
+  int8_t minimumRssi;
+  uint8_t rssiPerRank;
+
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param minimumRssi the signal, in dBm, below which an access point is
+   * dropped.
+   * @param rssiPerRank the signal, in dB, worth one step in the ranking.
+   */
+  WifiAccessPointSelector(int8_t minimumRssi = DEFAULT_MINIMUM_RSSI,
+                          uint8_t rssiPerRank = DEFAULT_RSSI_PER_RANK)
+      : minimumRssi(minimumRssi), rssiPerRank(rssiPerRank) {}
+  virtual ~WifiAccessPointSelector();
+
+  /**
+   * @brief Select the candidates, replacing the previous ones.
+   *
+   * @param registry the known networks, its enumeration is rewound.
+   * @param scanned the access points found by the scan.
+   * @param scannedCount the number of access points found.
+   * @param alreadyTried the network whose last access point has just been
+   * tried without success, that access point is dropped ; `nullptr` for none.
+   * @return uint8_t the number of candidates.
+   */
+  uint8_t select(WifiCredentialsRegistry *registry,
+                 const WifiScannedAccessPoint *scanned, uint8_t scannedCount,
+                 WifiCredentials *alreadyTried = nullptr);
+
+  /**
+   * @brief Drop the candidates, e.g. when the registry changes.
+   */
+  void clear() { count = cursor = 0; }
+
+  uint8_t getCount() { return count; }
+
+  /**
+   * @brief Enumeration interface -- ask whether there will be another
+   * candidate.
+   */
+  bool hasNext() { return cursor < count; }
+
+  /**
+   * @brief Enumeration interface -- get the next candidate.
+   *
+   * @return WifiCandidate* the next candidate, or `nullptr` if the
+   * enumeration is finished.
+   */
+  WifiCandidate *next() { return hasNext() ? &candidates[cursor++] : nullptr; }
+};
+
+#endif
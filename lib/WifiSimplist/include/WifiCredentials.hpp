@@ -52,6 +52,20 @@ private:
    * @brief The key to authenticate on the wifi network.
    */
   uint8_t key[MAX_LENGTH_OF_KEYPASS];
+  /**
+   * @brief The BSSID of the access point of the last connection.
+   */
+  uint8_t bssid[LENGTH_OF_BSSID] = {};
+  /**
+   * @brief The channel of the access point of the last connection,
+   * `UNKNOWN_CHANNEL` if there was none.
+   */
+  uint8_t channel = UNKNOWN_CHANNEL;
+  /**
+   * @brief The authentication mode of the access point of the last
+   * connection, as given by the platform.
+   */
+  uint8_t authMode = 0;
   static void copyAndNullTerminate(uint8_t *to, const uint8_t *from,
                                    uint8_t size) {
     memcpy(to, from, size);
@@ -131,6 +145,38 @@ public:
   void setKey(const uint8_t *newKey) {
     copyAndNullTerminate(key, newKey, MAX_LENGTH_OF_KEYPASS);
   }
+
+  /**
+   * @brief Tell whether the access point of the last connection is known, to
+   * connect again without scanning all the channels.
+   */
+  bool hasAccessPoint() { return UNKNOWN_CHANNEL != channel; }
+  uint8_t *getBssid() { return bssid; }
+  uint8_t getChannel() { return channel; }
+  uint8_t getAuthMode() { return authMode; }
+
+  /**
+   * @brief Remember the access point of the last connection.
+   *
+   * @param newBssid the BSSID, `LENGTH_OF_BSSID` bytes to copy from.
+   * @param newChannel the channel, `UNKNOWN_CHANNEL` to forget the access
+   * point.
+   * @param newAuthMode the authentication mode, as given by the platform.
+   */
+  void setAccessPoint(const uint8_t *newBssid, uint8_t newChannel,
+                      uint8_t newAuthMode) {
+    memcpy(bssid, newBssid, LENGTH_OF_BSSID);
+    channel = newChannel;
+    authMode = newAuthMode;
+  }
+
+  /**
+   * @brief Copy the access point of other credentials, if known.
+   *
+   * @param other the credentials to copy from.
+   * @return true when the access point has been changed.
+   */
+  bool copyAccessPointFrom(WifiCredentials *other);
 };
 
 #endif
\ No newline at end of file
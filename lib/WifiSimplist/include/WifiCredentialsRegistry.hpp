@@ -19,7 +19,6 @@
 
 // standard includes
 #include <cstdint>
-#include <vector>
 
 // esp32 includes
 
@@ -30,16 +29,27 @@
 /** @brief Maintains a list of wifi credentials, sorted by a preference rank.
  * The preference criterion is "latest known good (connected to) network". The
  * registry can only enumerate the entries following the ranking order.
+ *
+ * The entries are stored in the registry itself (at most
+ * `MAX_SIZE_OF_REGISTRY`), there is no allocation.
  */
 class WifiCredentialsRegistry {
 private:
   static const uint8_t DEFAULT_MAX_SIZE = 3;
   /**
-   * @brief the internal storage of the registry.
+   * @brief the internal storage of the registry, built in place.
    */
-  std::vector<WifiCredentials *> registry;
+  alignas(WifiCredentials) uint8_t
+      pool[MAX_SIZE_OF_REGISTRY][sizeof(WifiCredentials)];
+  bool used[MAX_SIZE_OF_REGISTRY] = {};
 
-  std::vector<WifiCredentials *>::iterator registryIterator;
+  /**
+   * @brief the entries, sorted by rank.
+   */
+  WifiCredentials *registry[MAX_SIZE_OF_REGISTRY];
+  uint8_t size = 0;
+
+  uint8_t registryIterator = 0;
   /**
    * @brief The registry will have a limited size, the default value will be
    * `DEFAULT_MAX_SIZE`.
@@ -78,11 +88,23 @@ private:
    * @brief Sort the entries by rank, and regenerate the enumeration.
    */
   void rearrange();
+  /**
+   * @brief Build a copy in a free place of the pool.
+   */
+  WifiCredentials *allocate(WifiCredentials *source);
+  /**
+   * @brief Destroy an entry and free its place in the pool.
+   */
+  void release(WifiCredentials *entry);
+  /**
+   * @brief Remove the entry at the given position, keeping the order.
+   */
+  void removeAt(uint8_t position);
 
 public:
   WifiCredentialsRegistry(
       uint8_t size = WifiCredentialsRegistry::DEFAULT_MAX_SIZE)
-      : maxSize(size) {}
+      : maxSize(size < MAX_SIZE_OF_REGISTRY ? size : MAX_SIZE_OF_REGISTRY) {}
   virtual ~WifiCredentialsRegistry();
   // query interface
   /**
@@ -90,7 +112,7 @@ public:
    *
    * @return uint8_t the size.
    */
-  uint8_t getSize() { return registry.size(); }
+  uint8_t getSize() { return size; }
 
   /**
    * @brief Get the capacity of this registry.
@@ -107,7 +129,7 @@ public:
    * another call.
    */
   WifiCredentialsRegistry *rewind() {
-    registryIterator = registry.begin();
+    registryIterator = 0;
     return this;
   }
   /**
@@ -115,7 +137,7 @@ public:
    *
    * @return true when call to `next()` will not return `null`
    */
-  bool hasNext() { return registryIterator != registry.end(); }
+  bool hasNext() { return registryIterator < size; }
   /**
    * @brief Enumeration interface -- get the next element.
    *
@@ -129,7 +151,8 @@ public:
    * @brief Registers new credentials, or an update of existing credentials
    * (same SSID). If the registry has more entries than the maximum size, the
    * entry with the lowest rank is removed. The rank of the new/updated entry
-   * will be 0 (first).
+   * will be 0 (first). An updated entry keeps its access point, unless the
+   * credentials have one.
    *
    * @param credentials the credentials to register, will be deep-cloned.
    * @return WifiCredentialsRegistry* this registry, to be able to chain with
@@ -146,7 +169,8 @@ public:
   WifiCredentialsRegistry *remove(WifiCredentials *const credentials);
   /**
    * @brief The given credentials, if found in the registry (same SSID) becomes
-   * the first to be given after a call to `rewind`.
+   * the first to be given after a call to `rewind`, and records the access
+   * point of the given credentials, if any.
    *
    * @param credentials the credential to reprioritize.
    * @return WifiCredentialsRegistry*
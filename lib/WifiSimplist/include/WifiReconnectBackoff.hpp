@@ -0,0 +1,135 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Wifi Simplist'.
+// ---
+// 'Wifi Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Wifi Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Wifi Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#ifndef WIFI_RECONNECT_BACKOFF_HPP
+#define WIFI_RECONNECT_BACKOFF_HPP
+
+// standard includes
+#include <cstdint>
+
+// esp32 includes
+
+// project includes
+#include "WifiSimplistTypes.hpp"
+
+/** @brief Policy of the attempts to reconnect after losing the link : the
+ * delay before each attempt doubles up to a cap, and is spread by a random
+ * jitter so that the clocks of a network do not retry all together.
+ *
+ * Each attempt tries the known access points ; every given number of
+ * attempts, WPS is tried when they all failed.
+ *
+ * The times are given by the caller, in microseconds, from any monotonic
+ * clock.
+ */
+class WifiReconnectBackoff {
+private:
+  uint32_t initialDelayMs;
+  uint32_t maxDelayMs;
+  uint8_t jitterPercent;
+  uint16_t wpsEvery;
+
+  bool recovering = false;
+  int64_t lostAt = 0;
+  uint16_t attempts = 0;
+  uint32_t totalAttempts = 0;
+  uint32_t recoveryCount = 0;
+  int64_t lastTimeToRecover = 0;
+
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param initialDelayMs the delay before the first attempt, in ms.
+   * @param maxDelayMs the cap of the delay, before the jitter, in ms.
+   * @param jitterPercent the spread of the delay around its nominal value.
+   * @param wpsEvery the attempts that also try WPS, e.g. 3 for every third
+   * attempt, `NEVER_TRY_WPS` to try only the known access points.
+   */
+  WifiReconnectBackoff(
+      uint32_t initialDelayMs = DEFAULT_RECONNECT_INITIAL_DELAY_MS,
+      uint32_t maxDelayMs = DEFAULT_RECONNECT_MAX_DELAY_MS,
+      uint8_t jitterPercent = DEFAULT_RECONNECT_JITTER_PERCENT,
+      uint16_t wpsEvery = NEVER_TRY_WPS)
+      : initialDelayMs(initialDelayMs), maxDelayMs(maxDelayMs),
+        jitterPercent(jitterPercent), wpsEvery(wpsEvery) {}
+  virtual ~WifiReconnectBackoff();
+
+  /**
+   * @brief Start a recovery, unless one is already going on.
+   *
+   * @param now the current time, in microseconds.
+   */
+  void onLinkLost(int64_t now);
+
+  /**
+   * @brief End the recovery going on, if any.
+   *
+   * @param now the current time, in microseconds.
+   * @return true when a recovery has ended.
+   */
+  bool onConnected(int64_t now);
+
+  /**
+   * @brief Give up the recovery going on, e.g. when the radio is not wanted
+   * anymore.
+   */
+  void stop() { recovering = false; }
+
+  /**
+   * @brief Count a new attempt and compute the delay before it.
+   *
+   * @param random any random value, to spread the delay.
+   * @return uint32_t the delay, in ms.
+   */
+  uint32_t nextDelayMs(uint32_t random);
+
+  /**
+   * @brief Tells whether the current attempt should try WPS once the known
+   * access points all failed.
+   */
+  bool isWpsAttempt() {
+    return NEVER_TRY_WPS != wpsEvery && 0 < attempts &&
+           0 == attempts % wpsEvery;
+  }
+
+  bool isRecovering() { return recovering; }
+
+  /**
+   * @brief Get the number of attempts of the current -or last- recovery.
+   */
+  uint16_t getAttempts() { return attempts; }
+
+  /**
+   * @brief Get the number of attempts of all the recoveries.
+   */
+  uint32_t getTotalAttempts() { return totalAttempts; }
+
+  /**
+   * @brief Get the number of successful recoveries.
+   */
+  uint32_t getRecoveryCount() { return recoveryCount; }
+
+  /**
+   * @brief Get the time from the loss of the link to the reconnection, for
+   * the last successful recovery.
+   *
+   * @return int64_t the duration in microseconds, 0 if never recovered.
+   */
+  int64_t getLastTimeToRecover() { return lastTimeToRecover; }
+};
+
+#endif
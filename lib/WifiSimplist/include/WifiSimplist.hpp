@@ -27,6 +27,8 @@
 #include "WifiCredentials.hpp"
 #include "WifiCredentialsRegistry.hpp"
 #include "WifiCredentialsRegistryDao.hpp"
+#include "WifiAccessPointSelector.hpp"
+#include "WifiReconnectBackoff.hpp"
 
 //write code here
 
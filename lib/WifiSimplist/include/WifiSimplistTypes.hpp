@@ -32,6 +32,36 @@ const uint8_t MAX_LENGTH_OF_SSID = 33;
 //**@brief Max length of wifi password/psk as C-String.
 const uint8_t MAX_LENGTH_OF_KEYPASS = 64;
 
+//**@brief Max number of entries of a registry, whatever its size.
+const uint8_t MAX_SIZE_OF_REGISTRY = 8;
+
+//**@brief Length of the BSSID (mac address) of an access point.
+const uint8_t LENGTH_OF_BSSID = 6;
+
+//**@brief Channel of an access point not seen yet.
+const uint8_t UNKNOWN_CHANNEL = 0;
+
+//**@brief Max number of access points kept from a scan.
+const uint8_t MAX_SCANNED_ACCESS_POINTS = 16;
+
+//**@brief Default signal below which an access point is not tried, in dBm.
+const int8_t DEFAULT_MINIMUM_RSSI = -90;
+
+//**@brief Default signal, in dB, worth one step in the ranking of networks.
+const uint8_t DEFAULT_RSSI_PER_RANK = 10;
+
+//**@brief Default delay before the first attempt to reconnect, in ms.
+const uint32_t DEFAULT_RECONNECT_INITIAL_DELAY_MS = 2000;
+
+//**@brief Default cap of the delay between two attempts to reconnect, in ms.
+const uint32_t DEFAULT_RECONNECT_MAX_DELAY_MS = 300000;
+
+//**@brief Default spread of the delay around its nominal value, in percent.
+const uint8_t DEFAULT_RECONNECT_JITTER_PERCENT = 25;
+
+//**@brief Period of the attempts to reconnect that also try WPS, for never.
+const uint16_t NEVER_TRY_WPS = 0;
+
 /**
  * @brief Type of the wifi key/password
  */
@@ -43,6 +73,22 @@ enum WifiKeyType {
   PRESHAREDKEY
 };
 
+/**
+ * @brief An access point found by a scan.
+ */
+struct WifiScannedAccessPoint {
+  /** @brief The network ssid, as a C-String. */
+  uint8_t ssid[MAX_LENGTH_OF_SSID];
+  /** @brief The mac address of the access point. */
+  uint8_t bssid[LENGTH_OF_BSSID];
+  /** @brief The primary channel. */
+  uint8_t channel;
+  /** @brief The strength of the signal, in dBm. */
+  int8_t rssi;
+  /** @brief The authentication mode, as given by the platform. */
+  uint8_t authMode;
+};
+
 #include "WifiStationTypes.hpp"
 
 #endif
\ No newline at end of file
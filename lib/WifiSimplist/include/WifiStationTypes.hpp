@@ -42,7 +42,10 @@
     TRYING_WPS --> |No success, can retry| TRYING_WPS
     TRYING_WPS --> |No success, no more retry| NOT_CONNECTED_AND_IDLE
     NOT_CONNECTED_AND_IDLE --> |Relauch connection process| TRYING_WPS
+    NOT_CONNECTED_AND_IDLE --> |Reconnect after a delay| TRYING_KNOWN_ACCESS_POINTS
     CONNECTED --> |Lost connection| NOT_CONNECTED_AND_IDLE
+    CONNECTED --> |Connect on demand, done with the network| PARKED
+    PARKED --> |Connect on demand, network required| TRYING_KNOWN_ACCESS_POINTS
  * ```
  */
 enum WifiStationLifecycleState {
@@ -83,7 +86,12 @@ enum WifiStationLifecycleState {
   /**
    * @brief Connected to an access point.
    */
-  CONNECTED
+  CONNECTED,
+  /**
+   * @brief The radio is deliberately off until the network is required again,
+   * the known access points are kept to reconnect quickly.
+   */
+  PARKED
 };
 
 /**
@@ -147,6 +155,13 @@ public:
    * @return true when the state has been changed.
    */
   virtual bool changeStateToConnected() = 0;
+
+  /**
+   * @brief Try to change the current state to the target state.
+   *
+   * @return true when the state has been changed.
+   */
+  virtual bool changeStateToParked() = 0;
 };
 
 #endif
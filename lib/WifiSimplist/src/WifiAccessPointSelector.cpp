@@ -0,0 +1,70 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Wifi Simplist'.
+// ---
+// 'Wifi Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Wifi Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Wifi Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "WifiAccessPointSelector.hpp"
+
+// standard includes
+#include <algorithm>
+#include <cstring>
+
+WifiAccessPointSelector::~WifiAccessPointSelector() {}
+// write code here...
+
+static bool compareByScore(const WifiCandidate &c1, const WifiCandidate &c2) {
+  if (c1.score != c2.score) {
+    return c1.score > c2.score;
+  }
+  return c1.rank < c2.rank;
+}
+
+uint8_t WifiAccessPointSelector::select(WifiCredentialsRegistry *registry,
+                                        const WifiScannedAccessPoint *scanned,
+                                        uint8_t scannedCount,
+                                        WifiCredentials *alreadyTried) {
+  clear();
+  for (uint8_t i = 0; i < scannedCount && count < MAX_SCANNED_ACCESS_POINTS;
+       i++) {
+    const WifiScannedAccessPoint &accessPoint = scanned[i];
+    if (accessPoint.rssi < minimumRssi) {
+      continue;
+    }
+    if (nullptr != alreadyTried && alreadyTried->hasAccessPoint() &&
+        0 == memcmp(alreadyTried->getBssid(), accessPoint.bssid,
+                    LENGTH_OF_BSSID) &&
+        0 == strncmp((const char *)alreadyTried->getSsid(),
+                     (const char *)accessPoint.ssid, MAX_LENGTH_OF_SSID)) {
+      continue; // just failed, no point waiting for it again
+    }
+    registry->rewind();
+    for (uint8_t rank = 0; registry->hasNext(); rank++) {
+      WifiCredentials *credentials = registry->next();
+      if (0 == strncmp((const char *)credentials->getSsid(),
+                       (const char *)accessPoint.ssid, MAX_LENGTH_OF_SSID)) {
+        WifiCandidate &candidate = candidates[count++];
+        candidate.credentials = credentials;
+        candidate.accessPoint = accessPoint;
+        candidate.rank = rank;
+        candidate.score = accessPoint.rssi - rank * rssiPerRank;
+        break;
+      }
+    }
+  }
+  registry->rewind();
+  std::stable_sort(candidates, candidates + count, compareByScore);
+  return count;
+}
@@ -36,7 +36,19 @@ WifiCredentials::WifiCredentials(uint8_t credentialSsid[MAX_LENGTH_OF_SSID],
 }
 
 WifiCredentials::WifiCredentials(WifiCredentials &wc)
-    : keyType(wc.keyType), rank(wc.rank) {
+    : keyType(wc.keyType), rank(wc.rank), channel(wc.channel),
+      authMode(wc.authMode) {
   copyAndNullTerminate(ssid, wc.ssid, MAX_LENGTH_OF_SSID);
   copyAndNullTerminate(key, wc.key, MAX_LENGTH_OF_KEYPASS);
+  memcpy(bssid, wc.bssid, LENGTH_OF_BSSID);
+}
+
+bool WifiCredentials::copyAccessPointFrom(WifiCredentials *other) {
+  if (!other->hasAccessPoint() ||
+      (channel == other->channel && authMode == other->authMode &&
+       0 == memcmp(bssid, other->bssid, LENGTH_OF_BSSID))) {
+    return false;
+  }
+  setAccessPoint(other->bssid, other->channel, other->authMode);
+  return true;
 }
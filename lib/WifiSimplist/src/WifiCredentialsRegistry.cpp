@@ -18,21 +18,48 @@
 // header include
 #include "WifiCredentialsRegistry.hpp"
 
+// standard includes
+#include <new>
+
 WifiCredentialsRegistry::~WifiCredentialsRegistry() {
-  std::vector<WifiCredentials *>::iterator it = registry.begin();
-  while (it != registry.end()) {
-    WifiCredentials *entry = *it;
-    registry.erase(it);
-    delete entry;
-    it = registry.begin();
+  while (size > 0) {
+    removeAt(size - 1);
   }
 }
 // write code here...
 
+WifiCredentials *WifiCredentialsRegistry::allocate(WifiCredentials *source) {
+  for (uint8_t i = 0; i < MAX_SIZE_OF_REGISTRY; i++) {
+    if (!used[i]) {
+      used[i] = true;
+      return new (pool[i]) WifiCredentials(*source);
+    }
+  }
+  return nullptr; // cannot happen, there is always a place for one more
+}
+
+void WifiCredentialsRegistry::release(WifiCredentials *entry) {
+  for (uint8_t i = 0; i < MAX_SIZE_OF_REGISTRY; i++) {
+    if ((uint8_t *)entry == pool[i]) {
+      entry->~WifiCredentials();
+      used[i] = false;
+      return;
+    }
+  }
+}
+
+void WifiCredentialsRegistry::removeAt(uint8_t position) {
+  WifiCredentials *entry = registry[position];
+  for (uint8_t i = position + 1; i < size; i++) {
+    registry[i - 1] = registry[i];
+  }
+  --size;
+  release(entry);
+}
+
 WifiCredentials *WifiCredentialsRegistry::find(WifiCredentials *query) {
-  for (std::vector<WifiCredentials *>::iterator it = registry.begin();
-       it != registry.end(); it++) {
-    WifiCredentials *candidate = *it;
+  for (uint8_t i = 0; i < size; i++) {
+    WifiCredentials *candidate = registry[i];
     if (candidate->isSameSsid(query)) {
       return candidate;
     }
@@ -41,9 +68,8 @@ WifiCredentials *WifiCredentialsRegistry::find(WifiCredentials *query) {
 }
 
 void WifiCredentialsRegistry::moveRankDownExcept(WifiCredentials *query) {
-  for (std::vector<WifiCredentials *>::iterator it = registry.begin();
-       it != registry.end(); it++) {
-    WifiCredentials *entry = *it;
+  for (uint8_t i = 0; i < size; i++) {
+    WifiCredentials *entry = registry[i];
     if (entry != query) {
       entry->rankDown();
     }
@@ -51,9 +77,8 @@ void WifiCredentialsRegistry::moveRankDownExcept(WifiCredentials *query) {
 }
 
 void WifiCredentialsRegistry::moveRankDownUntil(WifiCredentials *query) {
-  for (std::vector<WifiCredentials *>::iterator it = registry.begin();
-       it != registry.end(); it++) {
-    WifiCredentials *entry = *it;
+  for (uint8_t i = 0; i < size; i++) {
+    WifiCredentials *entry = registry[i];
     if (entry == query) {
       break;
     }
@@ -63,9 +88,8 @@ void WifiCredentialsRegistry::moveRankDownUntil(WifiCredentials *query) {
 
 void WifiCredentialsRegistry::moveRankUpAfter(WifiCredentials *query) {
   bool found = false;
-  for (std::vector<WifiCredentials *>::iterator it = registry.begin();
-       it != registry.end(); it++) {
-    WifiCredentials *entry = *it;
+  for (uint8_t i = 0; i < size; i++) {
+    WifiCredentials *entry = registry[i];
     if (entry == query) {
       found = true;
       continue;
@@ -77,11 +101,9 @@ void WifiCredentialsRegistry::moveRankUpAfter(WifiCredentials *query) {
 }
 
 void WifiCredentialsRegistry::rearrange() {
-  std::sort(registry.begin(), registry.end(), WifiCredentials::compareByRank);
-  while (registry.size() > maxSize) {
-    WifiCredentials *last = registry.back();
-    registry.pop_back();
-    delete (last);
+  std::sort(registry, registry + size, WifiCredentials::compareByRank);
+  while (size > maxSize) {
+    removeAt(size - 1);
   }
   rewind();
 }
@@ -89,7 +111,7 @@ void WifiCredentialsRegistry::rearrange() {
 WifiCredentials *WifiCredentialsRegistry::next() {
   WifiCredentials *result = nullptr;
   if (hasNext()) {
-    result = *registryIterator;
+    result = registry[registryIterator];
     registryIterator++;
   }
   return result;
@@ -99,14 +121,18 @@ WifiCredentialsRegistry *
 WifiCredentialsRegistry::put(WifiCredentials *const credentials) {
   WifiCredentials *entry = find(credentials);
   if (nullptr == entry) {
-    // insert
-    entry = new WifiCredentials(*credentials);
-    registry.push_back(entry);
+    // insert, there is always a place for one more than the max size
+    if (size == MAX_SIZE_OF_REGISTRY) {
+      removeAt(size - 1);
+    }
+    entry = allocate(credentials);
+    registry[size++] = entry;
 
   } else {
     // update
     entry->setKeyType(credentials->getKeyType());
     entry->setKey(credentials->getKey());
+    entry->copyAccessPointFrom(credentials);
   }
   entry->rankFirst();
   moveRankDownExcept(entry);
@@ -116,17 +142,13 @@ WifiCredentialsRegistry::put(WifiCredentials *const credentials) {
 
 WifiCredentialsRegistry *
 WifiCredentialsRegistry::remove(WifiCredentials *const credentials) {
-  WifiCredentials *entry;
-  std::vector<WifiCredentials *>::iterator it = registry.begin();
-  while (it != registry.end()) {
-    entry = *it;
+  for (uint8_t i = 0; i < size; i++) {
+    WifiCredentials *entry = registry[i];
     if (entry->isSameSsid(credentials)) {
       moveRankUpAfter(entry);
-      registry.erase(it);
-      delete (entry);
+      removeAt(i);
       return rewind();
     }
-    it++;
   }
   return this;
 }
@@ -135,6 +157,7 @@ WifiCredentialsRegistry *
 WifiCredentialsRegistry::setPreferred(WifiCredentials *const credentials) {
   WifiCredentials *entry = find(credentials);
   if (nullptr != entry) {
+    entry->copyAccessPointFrom(credentials);
     moveRankDownUntil(entry);
     entry->rankFirst();
     rearrange();
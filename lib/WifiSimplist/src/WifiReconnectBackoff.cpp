@@ -0,0 +1,54 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Wifi Simplist'.
+// ---
+// 'Wifi Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Wifi Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Wifi Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+
+// header include
+#include "WifiReconnectBackoff.hpp"
+
+WifiReconnectBackoff::~WifiReconnectBackoff() {}
+// write code here...
+
+void WifiReconnectBackoff::onLinkLost(int64_t now) {
+  if (recovering) {
+    return;
+  }
+  recovering = true;
+  lostAt = now;
+  attempts = 0;
+}
+
+bool WifiReconnectBackoff::onConnected(int64_t now) {
+  if (!recovering) {
+    return false;
+  }
+  recovering = false;
+  lastTimeToRecover = now - lostAt;
+  ++recoveryCount;
+  return true;
+}
+
+uint32_t WifiReconnectBackoff::nextDelayMs(uint32_t random) {
+  uint32_t delay = initialDelayMs < maxDelayMs ? initialDelayMs : maxDelayMs;
+  for (uint16_t i = 0; i < attempts && delay < maxDelayMs; i++) {
+    delay = delay > maxDelayMs / 2 ? maxDelayMs : delay * 2;
+  }
+  uint32_t spread = (uint32_t)((uint64_t)delay * jitterPercent / 100);
+  if (UINT16_MAX > attempts) {
+    ++attempts;
+  }
+  ++totalAttempts;
+  return 0 == spread ? delay : delay - spread + random % (2 * spread + 1);
+}
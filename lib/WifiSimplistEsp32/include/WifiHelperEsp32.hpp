@@ -50,6 +50,27 @@ public:
                      HostConfigurationEventListener *listener2 = nullptr,
                      HostConfigurationEventListener *listener3 = nullptr,
                      HostConfigurationEventListener *listener4 = nullptr);
+
+  /**
+   * @brief Helper to run a Wifi Station created by the caller, e.g. in a
+   * static storage.
+   *
+   * @param station the station, not setup yet.
+   * @param dao the dao of the wifi credentials.
+   * @param storageName Name of nvs storage to save wifi credentials
+   * @param listener1 mandatory HostConfigurationEventListener
+   * @param listener2 optionnal HostConfigurationEventListener
+   * @param listener3 optionnal HostConfigurationEventListener
+   * @param listener4 optionnal HostConfigurationEventListener
+   * @return WifiStationEsp32* the station, that has been started.
+   */
+  static WifiStationEsp32 *
+  setupAndRunStation(WifiStationEsp32 *station,
+                     WifiCredentialsRegistryDaoUsingNvs *dao, char *storageName,
+                     HostConfigurationEventListener *listener1,
+                     HostConfigurationEventListener *listener2 = nullptr,
+                     HostConfigurationEventListener *listener3 = nullptr,
+                     HostConfigurationEventListener *listener4 = nullptr);
 };
 
 #endif
\ No newline at end of file
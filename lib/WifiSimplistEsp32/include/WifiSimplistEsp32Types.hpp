@@ -21,11 +21,44 @@
 #include <cstdint>
 
 // esp32 includes
+#include "esp_event.h"
 #include "esp_wifi.h"
 #include "esp_wps.h"
 
 // project includes
 
+/**
+ * @brief Base of the private events of the station, posted to the default
+ * event loop so that every change of the state is done by the event loop.
+ */
+ESP_EVENT_DECLARE_BASE(WIFI_STATION_EVENT);
+
+/**
+ * @brief The private events of the station.
+ */
+enum WifiStationEventId {
+  /**
+   * @brief The delay before the next attempt to reconnect has elapsed.
+   */
+  WIFI_STATION_EVENT_RECONNECT,
+  /**
+   * @brief Asked to turn the radio on and reconnect.
+   */
+  WIFI_STATION_EVENT_WAKE_UP,
+  /**
+   * @brief Asked to turn the radio off until the next wake up.
+   */
+  WIFI_STATION_EVENT_PARK,
+  /**
+   * @brief Asked to turn the radio off and not to reconnect until resumed.
+   */
+  WIFI_STATION_EVENT_SUSPEND,
+  /**
+   * @brief Asked to allow the radio again, and to reconnect.
+   */
+  WIFI_STATION_EVENT_RESUME
+};
+
 /**
  * @brief Interface of a class that handle all the events related with a Wifi
  * station.
@@ -94,6 +127,16 @@ public:
    */
   virtual void handleWifiEventStationWpsEnrolleeTimeout(void *event_data) = 0;
 
+  /**
+   * @brief Event handler for WIFI_EVENT_SCAN_DONE.
+   *
+   * @param arg see Esp32 documentation.
+   * @param event_base see Esp32 documentation.
+   * @param event_id see Esp32 documentation.
+   * @param event_data the provided instance of WifiStationEsp32.
+   */
+  virtual void handleWifiEventScanDone(void *event_data) = 0;
+
   // ========[ IP events handlers ]========
   /**
    * @brief Event handler for IP_EVENT_STA_GOT_IP.
@@ -114,6 +157,42 @@ public:
    * @param event_data the provided instance of WifiStationEsp32.
    */
   virtual void handleIpEventLostIp(void *event_data) = 0;
+
+  // ========[ Station events handlers ]========
+  /**
+   * @brief Event handler for WIFI_STATION_EVENT_RECONNECT.
+   *
+   * @param event_data unused.
+   */
+  virtual void handleStationEventReconnect(void *event_data) = 0;
+
+  /**
+   * @brief Event handler for WIFI_STATION_EVENT_WAKE_UP.
+   *
+   * @param event_data unused.
+   */
+  virtual void handleStationEventWakeUp(void *event_data) = 0;
+
+  /**
+   * @brief Event handler for WIFI_STATION_EVENT_PARK.
+   *
+   * @param event_data unused.
+   */
+  virtual void handleStationEventPark(void *event_data) = 0;
+
+  /**
+   * @brief Event handler for WIFI_STATION_EVENT_SUSPEND.
+   *
+   * @param event_data unused.
+   */
+  virtual void handleStationEventSuspend(void *event_data) = 0;
+
+  /**
+   * @brief Event handler for WIFI_STATION_EVENT_RESUME.
+   *
+   * @param event_data unused.
+   */
+  virtual void handleStationEventResume(void *event_data) = 0;
 };
 
 #endif
\ No newline at end of file
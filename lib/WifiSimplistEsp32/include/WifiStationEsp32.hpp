@@ -24,11 +24,15 @@
 
 // esp32 includes
 #include "esp_log.h"
+#include "esp_random.h"
+#include "esp_timer.h"
 #include "esp_wifi.h"
 #include "esp_wps.h"
 
 // project includes
+#include "BootSimplist.hpp"
 #include "InternetSimplist.hpp"
+#include "PowerLockEsp32.hpp"
 #include "WifiSimplist.hpp"
 #include "WifiSimplistEsp32Types.hpp"
 
@@ -59,6 +63,34 @@ class WifiStationEsp32 : public WifiStationLifecycleManager,
                          public WifiStationEsp32EventHandler {
 private:
   static constexpr char *TAG = (char *)"WifiStationEsp32";
+  /**
+   * @brief Held while trying to connect ; once connected, the wifi driver
+   * manages the modem sleep by itself.
+   */
+  PowerLockEsp32 connectingLock =
+      PowerLockEsp32("wifi-connect", ESP_PM_NO_LIGHT_SLEEP);
+  bool connecting = false;
+  int64_t connectingSince = 0;
+  int64_t lastConnectDuration = 0;
+  void setConnecting(bool value);
+
+  /**
+   * @brief When true, the radio is parked once the listeners have been
+   * notified of the host configuration.
+   */
+  bool onDemand = false;
+  int64_t createdAt = esp_timer_get_time();
+  int64_t radioStartedAt = 0;
+  int64_t radioOnTotal = 0;
+  bool radioOn = false;
+  uint32_t wakeUpCount = 0;
+
+  /**
+   * @brief Where to mark the stages of the boot, if any.
+   */
+  BootProfiler *bootProfiler = nullptr;
+  void startRadio();
+  void stopRadio();
   /**
    * @brief The registry of credentials, to be loaded on startup, and saved when
    * something change it.
@@ -146,6 +178,106 @@ private:
           },
   };
 
+  /**
+   * @brief The known access point being tried on the channel and BSSID of its
+   * last connection, to try again by scanning all the channels if that fails.
+   */
+  WifiCredentials *targetedAccessPoint = nullptr;
+
+  /**
+   * @brief Steps of the selection of the best known access point.
+   */
+  enum SelectionStep {
+    /** @brief Nothing tried yet. */
+    SELECTION_NOT_STARTED,
+    /** @brief Trying the last access point of the best ranked network. */
+    SELECTION_TRYING_LAST,
+    /** @brief Waiting for the end of the scan. */
+    SELECTION_SCANNING,
+    /** @brief Trying the selected access points, the best first. */
+    SELECTION_READY,
+    /** @brief The scan failed, trying the known networks in turn. */
+    SELECTION_IN_RANK_ORDER
+  };
+
+  /**
+   * @brief When true, a single scan selects the known access points to try,
+   * instead of trying each known network in turn.
+   */
+  bool scanFirst = false;
+  SelectionStep selectionStep = SELECTION_NOT_STARTED;
+  WifiAccessPointSelector selector;
+  wifi_ap_record_t scanRecords[MAX_SCANNED_ACCESS_POINTS];
+  WifiScannedAccessPoint scanned[MAX_SCANNED_ACCESS_POINTS];
+
+  /**
+   * @brief When true, the link is recovered after a loss by attempts spaced
+   * by a growing delay, the radio being off in between.
+   */
+  bool autoReconnect = false;
+  WifiReconnectBackoff reconnectBackoff;
+  esp_timer_handle_t reconnectTimer = nullptr;
+  /**
+   * @brief Delay before posting the reconnection again, when the event loop
+   * is full.
+   */
+  static const uint64_t RECONNECT_RETRY_POST_US = 100000;
+  /**
+   * @brief Time to wait for a room in the event loop, when asked by another
+   * task.
+   */
+  static const TickType_t POST_TIMEOUT_TICKS = pdMS_TO_TICKS(100);
+  static void onReconnectTimer(void *arg);
+
+  /**
+   * @brief Notify the listeners, go back to idle and start the recovery when
+   * enabled.
+   */
+  void onLinkLost();
+
+  /**
+   * @brief Turn the radio off and start the timer of the next attempt to
+   * reconnect.
+   */
+  void scheduleReconnect();
+
+  /**
+   * @brief Turn the radio on for an attempt to reconnect, on the event loop.
+   */
+  void reconnectNow();
+
+  /**
+   * @brief Post a private event to the event loop, that changes the state.
+   *
+   * @return true when posted.
+   */
+  static bool postStationEvent(WifiStationEventId id);
+
+  /**
+   * @brief Turn the radio on and reconnect, on the event loop.
+   *
+   * @return true when a connection is being tried.
+   */
+  bool wakeUpNow();
+
+  /**
+   * @brief When true, the radio stays off, whatever asks for it, until
+   * resumed.
+   */
+  bool suspended = false;
+
+  /**
+   * @brief Give up any recovery or connection and turn the radio off, on the
+   * event loop.
+   */
+  void suspendNow();
+
+  /**
+   * @brief All the known access points failed : go on with WPS, or wait for
+   * the next attempt to reconnect.
+   */
+  void doneTryingKnownAccessPoints();
+
   /**
    * @brief Current configuration (if `isConnected` is `true`).
    */
@@ -159,6 +291,32 @@ private:
     ;
   }
 
+  /**
+   * @brief Connect straight to the access point of the last connection, or
+   * scan all the channels for the best access point of the SSID.
+   *
+   * @param cfg the configuration to update.
+   * @param bssid the access point, `nullptr` to scan.
+   * @param channel the channel of the access point.
+   * @param authMode the authentication mode of the access point.
+   */
+  static void setupAccessPoint(wifi_config_t &cfg, uint8_t *bssid,
+                               uint8_t channel = UNKNOWN_CHANNEL,
+                               uint8_t authMode = 0) {
+    if (nullptr != bssid) {
+      memcpy(cfg.sta.bssid, bssid, LENGTH_OF_BSSID);
+      cfg.sta.bssid_set = true;
+      cfg.sta.channel = channel;
+      cfg.sta.scan_method = WIFI_FAST_SCAN;
+      cfg.sta.threshold.authmode = (wifi_auth_mode_t)authMode;
+    } else {
+      cfg.sta.bssid_set = false;
+      cfg.sta.channel = 0;
+      cfg.sta.scan_method = WIFI_ALL_CHANNEL_SCAN;
+      cfg.sta.threshold.authmode = WIFI_AUTH_WPA2_PSK;
+    }
+  }
+
   /**
    * @brief Try to use the next known access point credentials to setup the wifi
    * configuration.
@@ -167,6 +325,33 @@ private:
    */
   bool tryNextKnownAccessPoints();
 
+  /**
+   * @brief Try the known networks in turn, in the order of the registry.
+   *
+   * @return true when there is a connection being tried.
+   */
+  bool tryNextKnownAccessPointInRankOrder();
+
+  /**
+   * @brief Try the last access point of the best ranked network, then scan
+   * once and try the selected access points, the best first.
+   *
+   * @return true when there is a connection or a scan being tried.
+   */
+  bool tryNextSelectedAccessPoint();
+
+  /**
+   * @brief Connect to a known network.
+   *
+   * @param wc the credentials of the network.
+   * @param bssid the access point, `nullptr` to scan all the channels.
+   * @param channel the channel of the access point.
+   * @param authMode the authentication mode of the access point.
+   */
+  void connectToKnownAccessPoint(WifiCredentials *wc, uint8_t *bssid,
+                                 uint8_t channel = UNKNOWN_CHANNEL,
+                                 uint8_t authMode = 0);
+
   /**
    * @brief For a WPS access point, try multiple times as long as it is within
    * the accepted number of retries.
@@ -269,6 +454,13 @@ private:
    */
   bool changeStateToReadyToInit();
 
+  /**
+   * @brief Try to change the current state to the target state.
+   *
+   * @return true when the state has been changed.
+   */
+  bool changeStateToParked();
+
 public:
   virtual ~WifiStationEsp32();
   WifiStationEsp32 *
@@ -288,6 +480,82 @@ public:
     changeStateToReadyToInit();
     return this;
   }
+  /**
+   * @brief Setup the connect on demand mode : once connected and the listeners
+   * notified (e.g. the time has been synchronized), the radio is turned off
+   * until `wakeUp()` is called.
+   *
+   * @param value true to enable the mode.
+   * @return WifiStationEsp32* the station.
+   */
+  WifiStationEsp32 *withOnDemand(bool value) {
+    onDemand = value;
+    return this;
+  }
+
+  /**
+   * @brief Setup the scan first mode : with several known networks, a single
+   * scan tells which ones are present, and their access points are tried
+   * from the strongest signal (lowered by the rank of the network), the
+   * absent networks are skipped. The last access point of the best ranked
+   * network is still tried first, without scanning.
+   *
+   * @param value true to enable the mode.
+   * @param minimumRssi the signal, in dBm, below which an access point is not
+   * tried.
+   * @return WifiStationEsp32* the station.
+   */
+  WifiStationEsp32 *withScanFirst(bool value,
+                                  int8_t minimumRssi = DEFAULT_MINIMUM_RSSI) {
+    scanFirst = value;
+    selector = WifiAccessPointSelector(minimumRssi);
+    return this;
+  }
+
+  /**
+   * @brief Setup the automatic reconnection : after losing the link, the
+   * known access points are tried again after a delay that doubles at each
+   * failed attempt, up to a cap, spread by a random jitter. The radio is off
+   * while waiting.
+   *
+   * @param value true to enable the mode.
+   * @param initialDelayMs the delay before the first attempt, in ms.
+   * @param maxDelayMs the cap of the delay, in ms.
+   * @param jitterPercent the spread of the delay around its nominal value.
+   * @param wpsEvery the attempts that also try WPS, `NEVER_TRY_WPS` for none.
+   * @return WifiStationEsp32* the station.
+   */
+  WifiStationEsp32 *withAutoReconnect(
+      bool value, uint32_t initialDelayMs = DEFAULT_RECONNECT_INITIAL_DELAY_MS,
+      uint32_t maxDelayMs = DEFAULT_RECONNECT_MAX_DELAY_MS,
+      uint8_t jitterPercent = DEFAULT_RECONNECT_JITTER_PERCENT,
+      uint16_t wpsEvery = NEVER_TRY_WPS) {
+    autoReconnect = value;
+    reconnectBackoff = WifiReconnectBackoff(initialDelayMs, maxDelayMs,
+                                            jitterPercent, wpsEvery);
+    return this;
+  }
+
+  /**
+   * @brief Mark the stages of the bring up of the wifi : registry loaded,
+   * wifi initialized, radio started, associated, got an ip address.
+   *
+   * @param profiler the boot profiler.
+   * @return WifiStationEsp32* the station.
+   */
+  WifiStationEsp32 *withBootProfiler(BootProfiler *profiler) {
+    bootProfiler = profiler;
+    return this;
+  }
+
+  /**
+   * @brief Mark a stage of the boot, if there is a boot profiler.
+   */
+  void markBootStage(const char *name) {
+    if (nullptr != bootProfiler) {
+      bootProfiler->mark(name);
+    }
+  }
 
   // ========[ API ]========
   /**
@@ -333,6 +601,108 @@ public:
            DONE_TRYING_KNOWN_ACCESS_POINTS == state || TRYING_WPS == state;
   }
 
+  /**
+   * @brief Tells whether the radio has been turned off on purpose.
+   */
+  bool isParked() { return PARKED == state; }
+
+  /**
+   * @brief Ask the event loop to turn the radio off until `wakeUp()`, when
+   * connected ; to be called from any task.
+   *
+   * @return true when asked while connected.
+   */
+  bool park();
+
+  /**
+   * @brief Ask the event loop to turn the radio on and reconnect, starting
+   * with the last access point that worked ; to be called from any task.
+   *
+   * @return true when asked while not connected.
+   */
+  bool wakeUp();
+
+  /**
+   * @brief Ask the event loop to turn the radio off and to give up any
+   * attempt to reconnect, `wakeUp()` doing nothing until `resume()` ; to be
+   * called from any task, e.g. on battery.
+   *
+   * @return true when asked.
+   */
+  bool suspend() { return postStationEvent(WIFI_STATION_EVENT_SUSPEND); }
+
+  /**
+   * @brief Ask the event loop to allow the radio again, and to reconnect.
+   *
+   * @return true when asked.
+   */
+  bool resume() { return postStationEvent(WIFI_STATION_EVENT_RESUME); }
+
+  /**
+   * @brief Get the duration of the last successful connection, from the start
+   * of the attempts to getting an ip address.
+   *
+   * @return int64_t the duration in microseconds, 0 if never connected.
+   */
+  int64_t getLastConnectMicros() { return lastConnectDuration; }
+
+  /**
+   * @brief Get the cumulated time the radio has been on.
+   *
+   * @return int64_t the duration in microseconds.
+   */
+  int64_t getRadioOnMicros() {
+    return radioOnTotal + (radioOn ? esp_timer_get_time() - radioStartedAt : 0);
+  }
+
+  /**
+   * @brief Get the ratio of time the radio has been on, since the creation.
+   *
+   * @return uint32_t the ratio, in per mille.
+   */
+  uint32_t getRadioDutyCyclePerMille() {
+    int64_t elapsed = esp_timer_get_time() - createdAt;
+    return elapsed > 0 ? (uint32_t)(getRadioOnMicros() * 1000 / elapsed) : 0;
+  }
+
+  /**
+   * @brief Get the number of calls to `wakeUp()` that turned the radio on.
+   */
+  uint32_t getWakeUpCount() { return wakeUpCount; }
+
+  /**
+   * @brief Tells whether the station is recovering from the loss of the link.
+   */
+  bool isReconnecting() { return reconnectBackoff.isRecovering(); }
+
+  /**
+   * @brief Get the number of attempts to reconnect of the current -or last-
+   * recovery.
+   */
+  uint16_t getReconnectAttempts() { return reconnectBackoff.getAttempts(); }
+
+  /**
+   * @brief Get the number of attempts to reconnect since the creation.
+   */
+  uint32_t getTotalReconnectAttempts() {
+    return reconnectBackoff.getTotalAttempts();
+  }
+
+  /**
+   * @brief Get the number of losses of the link that have been recovered.
+   */
+  uint32_t getRecoveryCount() { return reconnectBackoff.getRecoveryCount(); }
+
+  /**
+   * @brief Get the time from the loss of the link to the reconnection, for
+   * the last recovery.
+   *
+   * @return int64_t the duration in microseconds, 0 if never recovered.
+   */
+  int64_t getLastTimeToRecoverMicros() {
+    return reconnectBackoff.getLastTimeToRecover();
+  }
+
   /**
    * @brief Erase the credential registry, so that next reboot requires WPS
    * again.
@@ -400,6 +770,16 @@ public:
    */
   void handleWifiEventStationWpsEnrolleeTimeout(void *event_data);
 
+  /**
+   * @brief Event handler for WIFI_EVENT_SCAN_DONE.
+   *
+   * @param arg see Esp32 documentation.
+   * @param event_base see Esp32 documentation.
+   * @param event_id see Esp32 documentation.
+   * @param event_data the provided instance of WifiStationEsp32.
+   */
+  void handleWifiEventScanDone(void *event_data);
+
   // ========[ IP events handlers ]========
   /**
    * @brief Event handler for IP_EVENT_STA_GOT_IP.
@@ -420,8 +800,49 @@ public:
    * @param event_data the provided instance of WifiStationEsp32.
    */
   void handleIpEventLostIp(void *event_data) {
-    notifyLostHostConfiguration();
-    changeStateToNotConnectedAndIdle();
+    if (CONNECTED != state) {
+      return; // already notified when parking or disconnected
+    }
+    onLinkLost();
+  }
+
+  // ========[ Station events handlers ]========
+  /**
+   * @brief Event handler for WIFI_STATION_EVENT_RECONNECT.
+   *
+   * @param event_data unused.
+   */
+  void handleStationEventReconnect(void *event_data) { reconnectNow(); }
+
+  /**
+   * @brief Event handler for WIFI_STATION_EVENT_WAKE_UP.
+   *
+   * @param event_data unused.
+   */
+  void handleStationEventWakeUp(void *event_data) { wakeUpNow(); }
+
+  /**
+   * @brief Event handler for WIFI_STATION_EVENT_PARK.
+   *
+   * @param event_data unused.
+   */
+  void handleStationEventPark(void *event_data) { changeStateToParked(); }
+
+  /**
+   * @brief Event handler for WIFI_STATION_EVENT_SUSPEND.
+   *
+   * @param event_data unused.
+   */
+  void handleStationEventSuspend(void *event_data) { suspendNow(); }
+
+  /**
+   * @brief Event handler for WIFI_STATION_EVENT_RESUME.
+   *
+   * @param event_data unused.
+   */
+  void handleStationEventResume(void *event_data) {
+    suspended = false;
+    wakeUpNow();
   }
 };
 
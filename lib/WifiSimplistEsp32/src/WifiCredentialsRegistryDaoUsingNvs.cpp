@@ -12,6 +12,9 @@ static const char *FMT_KEY_COUNT = "count";
 static const char *FMT_KEY_SSID = "%d.ssid";
 static const char *FMT_KEY_KEYTYPE = "%d.ktype";
 static const char *FMT_KEY_KEYPASS = "%d.key";
+static const char *FMT_KEY_BSSID = "%d.bssid";
+static const char *FMT_KEY_CHANNEL = "%d.chan";
+static const char *FMT_KEY_AUTHMODE = "%d.auth";
 
 void WifiCredentialsRegistryDaoUsingNvs::logErrorGetItem(const char *tag,
                                                          esp_err_t err,
@@ -71,6 +74,9 @@ bool WifiCredentialsRegistryDaoUsingNvs::loadInto(
   char itemSsid[MAX_LENGTH_OF_SSID];
   char itemKey[MAX_LENGTH_OF_KEYPASS];
   WifiKeyType keyType;
+  uint8_t itemBssid[LENGTH_OF_BSSID];
+  uint8_t channel;
+  uint8_t authMode;
   WifiCredentialsRegistry temp(recipient->getCapacity());
   for (uint8_t item = count - 1; item < count; item--) {
     // read items in reverse order
@@ -104,6 +110,18 @@ bool WifiCredentialsRegistryDaoUsingNvs::loadInto(
       return false;
     }
     WifiCredentials wc((uint8_t *)itemSsid, (uint8_t *)itemKey, keyType);
+
+    // read the access point of the last connection, if any
+    channel = UNKNOWN_CHANNEL;
+    authMode = 0;
+    sprintf(keyname, FMT_KEY_BSSID, item);
+    if (ESP_OK == handle->get_blob(keyname, itemBssid, LENGTH_OF_BSSID)) {
+      sprintf(keyname, FMT_KEY_CHANNEL, item);
+      handle->get_item(keyname, channel);
+      sprintf(keyname, FMT_KEY_AUTHMODE, item);
+      handle->get_item(keyname, authMode);
+      wc.setAccessPoint(itemBssid, channel, authMode);
+    }
     temp.put(&wc);
   }
   // At this point, temp contains the registry in reverse order.
@@ -159,6 +177,27 @@ bool WifiCredentialsRegistryDaoUsingNvs::saveFrom(
       logErrorSetItem(TAG_SAVE, err, keyname);
       return false;
     }
+
+    // write the access point of the last connection, or forget the one of
+    // the previous item at this index
+    sprintf(keyname, FMT_KEY_BSSID, itemIndex);
+    if (item->hasAccessPoint()) {
+      err = handle->set_blob(keyname, item->getBssid(), LENGTH_OF_BSSID);
+      if (err == ESP_OK) {
+        sprintf(keyname, FMT_KEY_CHANNEL, itemIndex);
+        err = handle->set_item(keyname, item->getChannel());
+      }
+      if (err == ESP_OK) {
+        sprintf(keyname, FMT_KEY_AUTHMODE, itemIndex);
+        err = handle->set_item(keyname, item->getAuthMode());
+      }
+      if (err != ESP_OK) {
+        logErrorSetItem(TAG_SAVE, err, keyname);
+        return false;
+      }
+    } else {
+      handle->erase_item(keyname);
+    }
     err = handle->commit();
     if (err != ESP_OK) {
       logErrorCommit(TAG_SAVE, err, keyname);
@@ -7,6 +7,8 @@ WifiEventDispatcherEsp32::~WifiEventDispatcherEsp32() {}
 
 static constexpr char *TAG = (char *)"WifiEventDispatcherEsp32";
 
+ESP_EVENT_DEFINE_BASE(WIFI_STATION_EVENT);
+
 /**
  * @brief The listeners that will receive the events.
  */
@@ -43,6 +45,8 @@ static void dispatchEvents(void *arg, esp_event_base_t event_base,
                handleWifiEventStationWpsEnrolleeFailure)
       DISPATCH(WIFI_EVENT_STA_WPS_ER_TIMEOUT, "WIFI_EVENT_STA_WPS_ER_TIMEOUT",
                handleWifiEventStationWpsEnrolleeTimeout)
+      DISPATCH(WIFI_EVENT_SCAN_DONE, "WIFI_EVENT_SCAN_DONE",
+               handleWifiEventScanDone)
     }
   } else if (event_base == IP_EVENT) {
     switch (event_id) {
@@ -50,6 +54,19 @@ static void dispatchEvents(void *arg, esp_event_base_t event_base,
       DISPATCH(IP_EVENT_STA_LOST_IP, "IP_EVENT_STA_LOST_IP",
                handleIpEventLostIp)
     }
+  } else if (event_base == WIFI_STATION_EVENT) {
+    switch (event_id) {
+      DISPATCH(WIFI_STATION_EVENT_RECONNECT, "WIFI_STATION_EVENT_RECONNECT",
+               handleStationEventReconnect)
+      DISPATCH(WIFI_STATION_EVENT_WAKE_UP, "WIFI_STATION_EVENT_WAKE_UP",
+               handleStationEventWakeUp)
+      DISPATCH(WIFI_STATION_EVENT_PARK, "WIFI_STATION_EVENT_PARK",
+               handleStationEventPark)
+      DISPATCH(WIFI_STATION_EVENT_SUSPEND, "WIFI_STATION_EVENT_SUSPEND",
+               handleStationEventSuspend)
+      DISPATCH(WIFI_STATION_EVENT_RESUME, "WIFI_STATION_EVENT_RESUME",
+               handleStationEventResume)
+    }
   }
 }
 
@@ -63,6 +80,9 @@ void WifiEventDispatcherEsp32::installHandlers() {
   ESP_ERROR_CHECK(
       esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_STA_START,
                                  (esp_event_handler_t)&dispatchEvents, NULL));
+  ESP_ERROR_CHECK(
+      esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_STA_CONNECTED,
+                                 (esp_event_handler_t)&dispatchEvents, NULL));
   ESP_ERROR_CHECK(
       esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED,
                                  (esp_event_handler_t)&dispatchEvents, NULL));
@@ -75,12 +95,18 @@ void WifiEventDispatcherEsp32::installHandlers() {
   ESP_ERROR_CHECK(
       esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_STA_WPS_ER_TIMEOUT,
                                  (esp_event_handler_t)&dispatchEvents, NULL));
+  ESP_ERROR_CHECK(
+      esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_SCAN_DONE,
+                                 (esp_event_handler_t)&dispatchEvents, NULL));
   ESP_ERROR_CHECK(
       esp_event_handler_register(IP_EVENT, IP_EVENT_STA_GOT_IP,
                                  (esp_event_handler_t)&dispatchEvents, NULL));
   ESP_ERROR_CHECK(
       esp_event_handler_register(IP_EVENT, IP_EVENT_STA_LOST_IP,
                                  (esp_event_handler_t)&dispatchEvents, NULL));
+  ESP_ERROR_CHECK(
+      esp_event_handler_register(WIFI_STATION_EVENT, ESP_EVENT_ANY_ID,
+                                 (esp_event_handler_t)&dispatchEvents, NULL));
 }
 
 void WifiEventDispatcherEsp32::addListener(
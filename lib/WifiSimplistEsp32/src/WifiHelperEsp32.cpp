@@ -27,18 +27,28 @@ WifiHelperEsp32::setupAndRunStation(char *storageName,
                                     HostConfigurationEventListener *listener2,
                                     HostConfigurationEventListener *listener3,
                                     HostConfigurationEventListener *listener4) {
+  return setupAndRunStation(new WifiStationEsp32(),
+                            new WifiCredentialsRegistryDaoUsingNvs(),
+                            storageName, listener1, listener2, listener3,
+                            listener4);
+}
+
+WifiStationEsp32 *WifiHelperEsp32::setupAndRunStation(
+    WifiStationEsp32 *station, WifiCredentialsRegistryDaoUsingNvs *dao,
+    char *storageName, HostConfigurationEventListener *listener1,
+    HostConfigurationEventListener *listener2,
+    HostConfigurationEventListener *listener3,
+    HostConfigurationEventListener *listener4) {
   WifiEventDispatcherEsp32::installHandlers();
+  station->markBootStage("wifi-handlers");
 
   // do stuff
-  WifiStationEsp32 *station =
-      (new WifiStationEsp32()) //
-          ->withWifiCredentialsRegistryDao(
-              (new WifiCredentialsRegistryDaoUsingNvs())
-                  ->withDesignator(storageName))          //
-          ->withHostConfigurationEventListener(listener1) //
-          ->withHostConfigurationEventListener(listener2) //
-          ->withHostConfigurationEventListener(listener3) //
-          ->withHostConfigurationEventListener(listener4) //
+  station
+      ->withWifiCredentialsRegistryDao(dao->withDesignator(storageName)) //
+      ->withHostConfigurationEventListener(listener1)                    //
+      ->withHostConfigurationEventListener(listener2)                    //
+      ->withHostConfigurationEventListener(listener3)                    //
+      ->withHostConfigurationEventListener(listener4)                    //
       ;
   WifiEventDispatcherEsp32::addListener(station);
   station->init();
@@ -29,6 +29,19 @@ void WifiStationEsp32::install() {
   changeStateToInstalled();
 }
 
+void WifiStationEsp32::setConnecting(bool value) {
+  if (value == connecting) {
+    return;
+  }
+  connecting = value;
+  if (connecting) {
+    connectingSince = esp_timer_get_time();
+    connectingLock.acquire();
+  } else {
+    connectingLock.release();
+  }
+}
+
 bool WifiStationEsp32::changeStateToInstalled() {
   if (INSTALLED == state) {
     ESP_LOGD(TAG, "Already in a state 'installed'.");
@@ -48,7 +61,6 @@ bool WifiStationEsp32::changeStateToInstalled() {
 // ========================[ state management called elsewhere ]========================
 // clang-format on
 
-// NOBODY CALLS ME :,(
 bool WifiStationEsp32::changeStateToDoneTryingKnownAccessPoints() {
   if (DONE_TRYING_KNOWN_ACCESS_POINTS == state) {
     ESP_LOGD(TAG, "Already in a state 'done trying known access points'.");
@@ -109,10 +121,6 @@ void WifiStationEsp32::notifyLostHostConfiguration() {
 
 // ================
 void WifiStationEsp32::init() {
-  if (!wcregdao->loadInto(&wcreg)) {
-    ESP_LOGW(TAG,
-             "Could not restore saved credentials -or nothing to restore-.");
-  }
   esp_netif_config_t enct = ESP_NETIF_DEFAULT_WIFI_STA();
   if (NULL == enct.base->if_key) {
     ESP_LOGW(TAG, "esp_netif_config_t.base->if_key is NULL");
@@ -127,6 +135,16 @@ void WifiStationEsp32::init() {
     ESP_LOGI(TAG, "WILL Initialize wifi...");
     ESP_ERROR_CHECK(esp_wifi_init(&wifiStackConfiguration));
     ESP_LOGI(TAG, "DONE Initialize wifi.");
+    markBootStage("wifi-init");
+    esp_timer_create_args_t timerArgs = {.callback = onReconnectTimer,
+                                         .arg = this,
+                                         .dispatch_method = ESP_TIMER_TASK,
+                                         .name = "wifi-reconnect",
+                                         .skip_unhandled_events = true};
+    if (ESP_OK != esp_timer_create(&timerArgs, &reconnectTimer)) {
+      ESP_LOGW(TAG, "Could not create the reconnect timer.");
+      reconnectTimer = nullptr;
+    }
     changeStateToReadyToInstall();
   }
 }
@@ -141,7 +159,11 @@ bool WifiStationEsp32::changeStateToReadyToInstall() {
     return false;
   }
 
-  wcregdao->loadInto(&wcreg);
+  if (!wcregdao->loadInto(&wcreg)) {
+    ESP_LOGW(TAG,
+             "Could not restore saved credentials -or nothing to restore-.");
+  }
+  markBootStage("wifi-registry");
 
   ESP_LOGI(TAG, "Changing state to 'ready to install'.");
   state = READY_TO_INSTALL;
@@ -155,11 +177,84 @@ void WifiStationEsp32::tryToConnect() {
   }
 
   ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
+  startRadio();
+  markBootStage("wifi-start");
+}
+
+void WifiStationEsp32::startRadio() {
+  if (!radioOn) {
+    radioOn = true;
+    radioStartedAt = esp_timer_get_time();
+  }
   ESP_ERROR_CHECK(esp_wifi_start());
 }
 
+void WifiStationEsp32::stopRadio() {
+  esp_wifi_stop();
+  if (radioOn) {
+    radioOn = false;
+    radioOnTotal += esp_timer_get_time() - radioStartedAt;
+  }
+}
+
+bool WifiStationEsp32::postStationEvent(WifiStationEventId id) {
+  if (ESP_OK != esp_event_post(WIFI_STATION_EVENT, id, nullptr, 0,
+                               POST_TIMEOUT_TICKS)) {
+    ESP_LOGW(TAG, "Event loop busy, request %d dropped.", id);
+    return false;
+  }
+  return true;
+}
+
+bool WifiStationEsp32::park() {
+  bool connected = CONNECTED == state; // as seen by the caller
+  return postStationEvent(WIFI_STATION_EVENT_PARK) && connected;
+}
+
+bool WifiStationEsp32::wakeUp() {
+  bool connected = CONNECTED == state; // as seen by the caller
+  return postStationEvent(WIFI_STATION_EVENT_WAKE_UP) && !connected;
+}
+
+bool WifiStationEsp32::wakeUpNow() {
+  if (suspended) {
+    ESP_LOGI(TAG, "Suspended, the radio stays off.");
+    return false;
+  }
+  if (PARKED == state) {
+    ESP_LOGI(TAG, "Waking up the radio...");
+  } else if (NOT_CONNECTED_AND_IDLE == state && wcreg.getSize() > 0) {
+    ESP_LOGI(TAG, "Restarting the radio...");
+    stopRadio(); // to get a new WIFI_EVENT_STA_START
+  } else {
+    ESP_LOGD(TAG, "Nothing to wake up.");
+    return false;
+  }
+  ++wakeUpCount;
+  startRadio(); // WIFI_EVENT_STA_START will try the known access points
+  return true;
+}
+
+void WifiStationEsp32::suspendNow() {
+  ESP_LOGI(TAG, "Suspending the wifi...");
+  suspended = true;
+  reconnectBackoff.stop();
+  if (nullptr != reconnectTimer) {
+    esp_timer_stop(reconnectTimer);
+  }
+  if (CONNECTED == state) {
+    changeStateToParked();
+  } else if (isTryingToConnect()) {
+    changeStateToNotConnectedAndIdle();
+    stopRadio();
+  }
+}
+
 void WifiStationEsp32::forgetKnownAccessPoints() {
   ESP_LOGI(TAG, "Forgetting known access points...");
+  targetedAccessPoint = nullptr;
+  selector.clear();
+  reconnectBackoff.stop();
   while (wcreg.getSize() > 0) {
     wcreg.rewind()->remove(wcreg.next());
   }
@@ -174,7 +269,8 @@ void WifiStationEsp32::forgetKnownAccessPoints() {
 void WifiStationEsp32::handleWifiEventStationStart(void *event_data) {
   ESP_LOGI(TAG, "WIFI_EVENT_STA_START");
   if (WifiStationLifecycleState::NOT_CONNECTED_AND_IDLE == state ||
-      WifiStationLifecycleState::INSTALLED == state) {
+      WifiStationLifecycleState::INSTALLED == state ||
+      WifiStationLifecycleState::PARKED == state) {
     if (wcreg.getSize() > 0) {
       if (changeStateToTryingKnownAccessPoints()) {
         tryNextKnownAccessPoints();
@@ -192,33 +288,41 @@ bool WifiStationEsp32::changeStateToTryingKnownAccessPoints() {
     ESP_LOGD(TAG, "Already in a state 'trying known access points'.");
     return false;
   }
-  if (INSTALLED != state && NOT_CONNECTED_AND_IDLE != state) {
+  if (INSTALLED != state && NOT_CONNECTED_AND_IDLE != state &&
+      PARKED != state) {
     ESP_LOGW(TAG, "Not in a state that can be changed to 'trying known "
                   "access points'.");
     return false;
   }
 
   wcreg.rewind();
+  targetedAccessPoint = nullptr;
+  selectionStep = SELECTION_NOT_STARTED;
+  selector.clear();
 
   ESP_LOGI(TAG, "Changing state to 'trying known access points'.");
   state = TRYING_KNOWN_ACCESS_POINTS;
+  setConnecting(true);
   return true;
 }
 
 // ========================
 void WifiStationEsp32::handleWifiEventStationConnected(void *event_data) {
   ESP_LOGI(TAG, "WIFI_EVENT_STA_CONNECTED");
+  markBootStage("wifi-associated");
 }
 
 // ========================
 void WifiStationEsp32::handleWifiEventStationDisconnected(void *event_data) {
   ESP_LOGI(TAG, "WIFI_EVENT_STA_DISCONNECTED");
   // select next step according to state
-  if (TRYING_KNOWN_ACCESS_POINTS == state) {
+  if (PARKED == state) {
+    ESP_LOGD(TAG, "Disconnected on purpose.");
+  } else if (TRYING_KNOWN_ACCESS_POINTS == state) {
     ESP_LOGI(TAG, "Failed to connect to a known access point.");
     if (!tryNextKnownAccessPoints()) {
-      ESP_LOGI(TAG, "Tried all known access points, switch to wps...");
-      changeStateToTryingWps();
+      ESP_LOGI(TAG, "Tried all known access points.");
+      doneTryingKnownAccessPoints();
     }
   } else if (TRYING_WPS == state) {
     if (remainingRetriesForAccessPoint > 0) {
@@ -234,6 +338,10 @@ void WifiStationEsp32::handleWifiEventStationDisconnected(void *event_data) {
       ESP_LOGI(TAG, "Failed to connect to an available access point.");
       changeStateToNotConnectedAndIdle();
     }
+  } else if (CONNECTED == state) {
+    onLinkLost();
+  } else if (NOT_CONNECTED_AND_IDLE == state) {
+    ESP_LOGD(TAG, "Already idle.");
   } else {
     ESP_LOGW(TAG, "UNKNOWN STATE, failed to connect anyway, go back to idle.");
     changeStateToNotConnectedAndIdle();
@@ -241,12 +349,178 @@ void WifiStationEsp32::handleWifiEventStationDisconnected(void *event_data) {
 }
 
 bool WifiStationEsp32::tryNextKnownAccessPoints() {
-  WifiCredentials *wc = wcreg.next();
-  ESP_LOGI(TAG, "Connecting to known SSID: %s", wc->getSsid());
+  return scanFirst ? tryNextSelectedAccessPoint()
+                   : tryNextKnownAccessPointInRankOrder();
+}
+
+bool WifiStationEsp32::tryNextKnownAccessPointInRankOrder() {
+  WifiCredentials *wc = targetedAccessPoint;
+  targetedAccessPoint = nullptr;
+  if (nullptr != wc) {
+    ESP_LOGI(TAG, "Scanning all channels for known SSID: %s", wc->getSsid());
+    connectToKnownAccessPoint(wc, nullptr);
+  } else if (wcreg.hasNext()) {
+    wc = wcreg.next();
+    if (wc->hasAccessPoint()) {
+      targetedAccessPoint = wc;
+      ESP_LOGI(TAG, "Connecting to known SSID: %s, channel %d", wc->getSsid(),
+               wc->getChannel());
+      connectToKnownAccessPoint(wc, wc->getBssid(), wc->getChannel(),
+                                wc->getAuthMode());
+    } else {
+      ESP_LOGI(TAG, "Connecting to known SSID: %s", wc->getSsid());
+      connectToKnownAccessPoint(wc, nullptr);
+    }
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool WifiStationEsp32::tryNextSelectedAccessPoint() {
+  switch (selectionStep) {
+  case SELECTION_NOT_STARTED: {
+    WifiCredentials *best = wcreg.rewind()->next();
+    if (nullptr != best && best->hasAccessPoint()) {
+      selectionStep = SELECTION_TRYING_LAST;
+      targetedAccessPoint = best; // not to be tried again after the scan
+      ESP_LOGI(TAG, "Connecting to known SSID: %s, channel %d",
+               best->getSsid(), best->getChannel());
+      connectToKnownAccessPoint(best, best->getBssid(), best->getChannel(),
+                                best->getAuthMode());
+      return true;
+    }
+  } // no last access point, scan at once
+    [[fallthrough]];
+  case SELECTION_TRYING_LAST: {
+    wifi_scan_config_t scanConfig = {};
+    esp_err_t err = esp_wifi_scan_start(&scanConfig, false);
+    if (ESP_OK == err) {
+      ESP_LOGI(TAG, "Scanning for the known access points...");
+      selectionStep = SELECTION_SCANNING;
+      return true;
+    }
+    ESP_LOGW(TAG, "Could not scan (%s), try the known access points in turn.",
+             esp_err_to_name(err));
+    selectionStep = SELECTION_IN_RANK_ORDER;
+    wcreg.rewind();
+    return tryNextKnownAccessPointInRankOrder();
+  }
+  case SELECTION_SCANNING:
+    ESP_LOGD(TAG, "Still scanning.");
+    return true;
+  case SELECTION_READY: {
+    WifiCandidate *candidate = selector.next();
+    if (nullptr == candidate) {
+      return false;
+    }
+    ESP_LOGI(TAG, "Connecting to known SSID: %s, channel %d, rssi %d",
+             candidate->credentials->getSsid(),
+             candidate->accessPoint.channel, candidate->accessPoint.rssi);
+    connectToKnownAccessPoint(
+        candidate->credentials, candidate->accessPoint.bssid,
+        candidate->accessPoint.channel, candidate->accessPoint.authMode);
+    return true;
+  }
+  case SELECTION_IN_RANK_ORDER:
+    return tryNextKnownAccessPointInRankOrder();
+  }
+  return false;
+}
+
+void WifiStationEsp32::connectToKnownAccessPoint(WifiCredentials *wc,
+                                                 uint8_t *bssid,
+                                                 uint8_t channel,
+                                                 uint8_t authMode) {
+  setupAccessPoint(wifi_config_known_ap, bssid, channel, authMode);
   setupCredentials(wifi_config_known_ap, wc->getSsid(), wc->getKey());
   ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_config_known_ap));
   esp_wifi_connect();
-  return true;
+}
+
+void WifiStationEsp32::handleWifiEventScanDone(void *event_data) {
+  ESP_LOGI(TAG, "WIFI_EVENT_SCAN_DONE");
+  if (TRYING_KNOWN_ACCESS_POINTS != state ||
+      SELECTION_SCANNING != selectionStep) {
+    return; // not a scan of the selection
+  }
+  wifi_event_sta_scan_done_t *event = (wifi_event_sta_scan_done_t *)event_data;
+  uint16_t recordCount = MAX_SCANNED_ACCESS_POINTS;
+  if (nullptr == event || 0 != event->status ||
+      ESP_OK != esp_wifi_scan_get_ap_records(&recordCount, scanRecords)) {
+    ESP_LOGW(TAG, "Scan failed, try the known access points in turn.");
+    esp_wifi_clear_ap_list();
+    selectionStep = SELECTION_IN_RANK_ORDER;
+    wcreg.rewind();
+  } else {
+    for (uint16_t i = 0; i < recordCount; i++) {
+      memcpy(scanned[i].ssid, scanRecords[i].ssid, MAX_LENGTH_OF_SSID);
+      memcpy(scanned[i].bssid, scanRecords[i].bssid, LENGTH_OF_BSSID);
+      scanned[i].channel = scanRecords[i].primary;
+      scanned[i].rssi = scanRecords[i].rssi;
+      scanned[i].authMode = scanRecords[i].authmode;
+    }
+    selector.select(&wcreg, scanned, recordCount, targetedAccessPoint);
+    targetedAccessPoint = nullptr;
+    ESP_LOGI(TAG, "Found %d access points, %d of known networks.",
+             recordCount, selector.getCount());
+    selectionStep = SELECTION_READY;
+  }
+  if (!tryNextKnownAccessPoints()) {
+    ESP_LOGI(TAG, "No known access point around.");
+    doneTryingKnownAccessPoints();
+  }
+}
+
+void WifiStationEsp32::doneTryingKnownAccessPoints() {
+  changeStateToDoneTryingKnownAccessPoints();
+  if (reconnectBackoff.isRecovering() && !reconnectBackoff.isWpsAttempt()) {
+    ESP_LOGI(TAG, "Wait for the next attempt to reconnect...");
+    changeStateToNotConnectedAndIdle(); // schedules the next attempt
+  } else {
+    ESP_LOGI(TAG, "Switch to wps...");
+    changeStateToTryingWps();
+  }
+}
+
+// clang-format off
+// ========================[ WHEN the link is lost ]========================
+// clang-format on
+void WifiStationEsp32::onLinkLost() {
+  ESP_LOGW(TAG, "Lost the link to the access point.");
+  notifyLostHostConfiguration();
+  if (autoReconnect && !suspended && nullptr != reconnectTimer) {
+    reconnectBackoff.onLinkLost(esp_timer_get_time());
+  }
+  changeStateToNotConnectedAndIdle();
+}
+
+void WifiStationEsp32::scheduleReconnect() {
+  uint32_t delayMs = reconnectBackoff.nextDelayMs(esp_random());
+  ESP_LOGI(TAG, "Attempt %d to reconnect in %lu ms.",
+           reconnectBackoff.getAttempts(), (unsigned long)delayMs);
+  stopRadio(); // no radio while waiting
+  esp_timer_stop(reconnectTimer);
+  esp_timer_start_once(reconnectTimer, (uint64_t)delayMs * 1000);
+}
+
+void WifiStationEsp32::onReconnectTimer(void *arg) {
+  // the state is only changed by the event loop
+  if (ESP_OK != esp_event_post(WIFI_STATION_EVENT,
+                               WIFI_STATION_EVENT_RECONNECT, nullptr, 0, 0)) {
+    ESP_LOGW(TAG, "Event loop busy, reconnect a bit later.");
+    esp_timer_start_once(((WifiStationEsp32 *)arg)->reconnectTimer,
+                         RECONNECT_RETRY_POST_US);
+  }
+}
+
+void WifiStationEsp32::reconnectNow() {
+  if (suspended || NOT_CONNECTED_AND_IDLE != state ||
+      !reconnectBackoff.isRecovering()) {
+    return; // e.g. reconnected by `wakeUpNow()`
+  }
+  ESP_LOGI(TAG, "Attempt %d to reconnect...", reconnectBackoff.getAttempts());
+  startRadio(); // WIFI_EVENT_STA_START will try the known access points
 }
 
 bool WifiStationEsp32::changeStateToTryingWps() {
@@ -262,6 +536,8 @@ bool WifiStationEsp32::changeStateToTryingWps() {
 
   ESP_LOGI(TAG, "Changing state to 'trying wps'.");
   state = TRYING_WPS;
+  targetedAccessPoint = nullptr;
+  setConnecting(true);
   startWps();
 
   return true;
@@ -335,6 +611,7 @@ void WifiStationEsp32::handleIpEventGotIp(void *event_data) {
   ESP_LOGI(TAG, "got ip: " IPSTR, IP2STR(&event->ip_info.ip));
   ESP_LOGI(TAG, "got network mask: " IPSTR, IP2STR(&event->ip_info.netmask));
   ESP_LOGI(TAG, "got gateway: " IPSTR, IP2STR(&event->ip_info.gw));
+  markBootStage("wifi-dhcp");
 
   changeStateToConnected();
 
@@ -355,6 +632,11 @@ void WifiStationEsp32::handleIpEventGotIp(void *event_data) {
                                 esp_ip4_addr_get_byte(&event->ip_info.gw, 2),
                                 esp_ip4_addr_get_byte(&event->ip_info.gw, 3)}}};
   notifyGotHostConfiguration(&desc);
+
+  if (onDemand) {
+    // the listeners are done with the network, e.g. the time is synchronized
+    changeStateToParked();
+  }
 }
 
 bool WifiStationEsp32::changeStateToConnected() {
@@ -371,13 +653,29 @@ bool WifiStationEsp32::changeStateToConnected() {
   if (TRYING_KNOWN_ACCESS_POINTS == state) {
     WifiCredentials wc(wifi_config_known_ap.sta.ssid,
                        wifi_config_known_ap.sta.password, PASSWORD);
+    wifi_ap_record_t accessPoint;
+    if (ESP_OK == esp_wifi_sta_get_ap_info(&accessPoint)) {
+      // to connect again without scanning
+      wc.setAccessPoint(accessPoint.bssid, accessPoint.primary,
+                        accessPoint.authmode);
+    }
     wcreg.setPreferred(&wc);
     wcregdao->saveFrom(&wcreg);
   } else if (TRYING_WPS == state) {
   }
 
-  ESP_LOGI(TAG, "Changing state to 'connected'.");
+  int64_t now = esp_timer_get_time();
+  lastConnectDuration = now - connectingSince;
+  ESP_LOGI(TAG, "Changing state to 'connected', after %lld ms.",
+           lastConnectDuration / 1000);
+  if (reconnectBackoff.onConnected(now)) {
+    esp_timer_stop(reconnectTimer);
+    ESP_LOGI(TAG, "Recovered the link after %d attempts, in %lld ms.",
+             reconnectBackoff.getAttempts(),
+             reconnectBackoff.getLastTimeToRecover() / 1000);
+  }
   state = CONNECTED;
+  setConnecting(false);
   return true;
 }
 
@@ -411,6 +709,29 @@ bool WifiStationEsp32::changeStateToReadyToInit() {
   return true;
 }
 
+bool WifiStationEsp32::changeStateToParked() {
+  if (PARKED == state) {
+    ESP_LOGD(TAG, "Already in a state 'parked'.");
+    return false;
+  }
+  if (CONNECTED != state) {
+    ESP_LOGW(TAG, "Not in a state that can be changed to 'parked'.");
+    return false;
+  }
+
+  ESP_LOGI(TAG, "Changing state to 'parked'.");
+  state = PARKED; // before the disconnection events
+  notifyLostHostConfiguration();
+  esp_wifi_disconnect();
+  stopRadio();
+  ESP_LOGI(TAG, "Radio on %lld ms in total, duty cycle %lu per mille, %lu "
+                "wake ups.",
+           getRadioOnMicros() / 1000,
+           (unsigned long)getRadioDutyCyclePerMille(),
+           (unsigned long)wakeUpCount);
+  return true;
+}
+
 bool WifiStationEsp32::changeStateToNotConnectedAndIdle() {
   if (NOT_CONNECTED_AND_IDLE == state) {
     ESP_LOGD(TAG, "Already in a state 'not connected and idle'.");
@@ -423,11 +744,17 @@ bool WifiStationEsp32::changeStateToNotConnectedAndIdle() {
 
   if (wcreg.getSize() == 0) {
     ESP_ERROR_CHECK(esp_wifi_wps_disable());
+  } else if (TRYING_WPS == state) {
+    esp_wifi_wps_disable(); // to try the known access points next time
   } else {
     // TODO ? disable wifi
   }
 
   ESP_LOGI(TAG, "Changing state to 'not connected and idle'.");
   state = NOT_CONNECTED_AND_IDLE;
+  setConnecting(false);
+  if (reconnectBackoff.isRecovering()) {
+    scheduleReconnect();
+  }
   return true;
 }
@@ -21,7 +21,9 @@
 
 // esp32 includes
 #include "driver/i2c.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "nvs.h"
 #include "nvs_flash.h"
 
@@ -34,7 +36,9 @@
 #include "FeedbackLed.hpp"
 #include "GeneralPurposeInputOutput.hpp"
 #include "InputButton.hpp"
-#include "Task.h"
+#include "InputSimplist.hpp"
+#include "InputSimplistEsp32.hpp"
+#include "StaticTaskEsp32.hpp"
 // -- wifi
 #include "WifiHelperEsp32.hpp"
 #include "WifiSimplist.hpp"
@@ -42,8 +46,26 @@
 #include "SevenSegmentsFont.hpp"
 #include "Tm1637IicBridgeEsp32.hpp"
 // -- timekeepers
+#include "NetworkTimeKeeperBroadcastEsp32.hpp"
 #include "NetworkTimeKeeperEsp32.hpp"
-
+#include "SntpServerEsp32.hpp"
+#include "TimeKeeperSimplist.hpp"
+// -- menu
+#include "MenuSimplist.hpp"
+// -- animation phase
+#include "PhaseSyncSimplistEsp32.hpp"
+// -- alarms
+#include "AlarmSimplistEsp32.hpp"
+// -- periodic jobs
+#include "SchedulerSimplistEsp32.hpp"
+// -- power
+#include "PowerSimplistEsp32.hpp"
+// -- messages between the tasks
+#include "MessageSimplistEsp32.hpp"
+// -- boot
+#include "BootSimplistEsp32.hpp"
+
+#include "macros_allocation.hpp"
 #include "macros_property.hpp"
 
 extern "C" {
@@ -78,8 +100,22 @@ enum TimeKeepingEvents {
 #define PIN_BUTTON_MENU gpio_num_t(CONFIG_PIN_BUTTON_MENU)
 #define PIN_STATUS_MAIN gpio_num_t(CONFIG_PIN_STATUS_MAIN)
 
+//====================================================================
+// Tasks policy from configuration : core, priority and stack of a task, e.g.
+// 'APPLY_TASK_POLICY(task, DISPLAY)' uses the CONFIG_TASK_DISPLAY_* values.
+#define APPLY_TASK_POLICY(task, policy)                                        \
+  do {                                                                         \
+    (task)->setCore(CONFIG_TASK_##policy##_CORE);                              \
+    (task)->setPriority(CONFIG_TASK_##policy##_PRIORITY);                      \
+    (task)->setStackSize(CONFIG_TASK_##policy##_STACK_SIZE);                   \
+    ALLOCATE_STACK(task, CONFIG_TASK_##policy##_STACK_SIZE);                   \
+  } while (0)
+
 static constexpr char *TAG = (char *)"the-clock";
 static constexpr char *NAME_STORAGE_WIFI = (char *)"tclk_wcreg";
+static constexpr char *NAME_STORAGE_ALARMS = (char *)"tclk_alarms";
+static constexpr char *NAME_STORAGE_SETTINGS = (char *)"tclk_settings";
+static constexpr char *KEY_TIMEZONE = (char *)"tz";
 
 static constexpr char *GREETINGS_STRING = (char *)CONFIG_LABEL_TITLE;
 
@@ -99,6 +135,14 @@ public:
   }
 };
 
+class LoggerAlarmListener : public AlarmListener {
+public:
+  virtual void onAlarm(uint8_t index, AlarmRule *rule, bool snoozed) {
+    ESP_LOGI(TAG, "LoggerAlarmListener alarm #%d (%02d:%02d)%s...", index,
+             rule->getHour(), rule->getMinute(), snoozed ? " after snooze" : "");
+  }
+};
+
 //====================================================================
 // --- the clock display
 enum DisplayMode { GREETINGS, TIME, CHANGE_HOUR, CHANGE_MINUTES, MENU };
@@ -106,9 +150,37 @@ enum DisplayMode { GREETINGS, TIME, CHANGE_HOUR, CHANGE_MINUTES, MENU };
 const char FILL_CHAR = 0x20;    // a.k.a. ASCII space character
 const uint8_t DOT_BIT = 1 << 7; // To light the separator colon
 const uint8_t PHASE_MAX = 4;
+const int64_t PHASE_DURATION_US = 250000; // 4 Hz
+const uint8_t BRIGHTNESS_NOMINAL = 7;
+const uint8_t BRIGHTNESS_NIGHT = 1;
+const uint8_t BRIGHTNESS_LOW_POWER = 2;
+// lateness of the wake ups of the loops above which a deadline is missed
+const uint32_t JITTER_DEADLINE_DISPLAY_US = 5000;        // visible on the blink
+const uint32_t JITTER_DEADLINE_BUTTONS_US = 10000;       // half a poll period
+const uint32_t JITTER_DEADLINE_TIMER_SERVICE_US = 10000; // a system tick
+const uint32_t JITTER_DEADLINE_CLOCK_US = 20000;
+const int VALID_TIME_MIN_YEAR = 2023;          // before, the time is not set
+const int64_t INPUT_LATENCY_BUDGET_US = 30000; // from the button to the segments
+
+//====================================================================
+// --- messages between the tasks, each task owning a mailbox
+enum TheClockMessageType {
+  MESSAGE_COMMAND,         // code : the TheClockCommand
+  MESSAGE_DISPLAY_PHASE,   // start of an animation phase
+  MESSAGE_DISPLAY_MODE,    // code : the DisplayMode of the next content
+  MESSAGE_DISPLAY_CONTENT, // text : the next content
+  MESSAGE_DISPLAY_PUSH     // text : the next content, to show at once
+};
+
+Message messageOf(uint16_t type, uint16_t code = 0) {
+  Message message = {};
+  message.type = type;
+  message.code = code;
+  return message;
+}
 
 // Sample task : display updater
-class DisplayUpdaterTask : public Task {
+class DisplayUpdaterTask : public StaticTaskEsp32 {
 private:
   const uint8_t TTL_GREETINGS = 1;
   Tm1637IicBridgeEsp32 iicBridge = Tm1637IicBridgeEsp32();
@@ -117,6 +189,16 @@ private:
   bool iicReady = false;
   DisplayMode mode = GREETINGS;
   bool nightTimeMode = false;
+  /**
+   * @brief Brightness in the daytime, from the menu.
+   */
+  uint8_t brightness = BRIGHTNESS_NOMINAL;
+  /**
+   * @brief On battery : dimmer, and refreshed on the odd phases only (the
+   * colon and the field being set are shown in phase 1 and hidden in phase 3,
+   * the blinking stays at 1 Hz).
+   */
+  bool lowPowerMode = false;
   /**
    * @brief The display buffer will 4 steps of animation.
    *
@@ -148,12 +230,92 @@ private:
   DisplayMode modeToApply = GREETINGS;
 
   /**
-   * @brief The animation phase will be updated every 0.2 seconds.
+   * @brief The animation phase will be updated every 0.25 seconds.
    */
   uint8_t phase = 0;
 
+  /**
+   * @brief The animation phase is derived from the local monotonic time, so
+   * that it can be aligned with other clocks.
+   */
+  AnimationTimeline timeline = AnimationTimeline(PHASE_DURATION_US, PHASE_MAX);
+
+  /**
+   * @brief One shot timer, armed for the start of the next phase.
+   */
+  esp_timer_handle_t phaseTimer;
+
+  /**
+   * @brief The changes of content and the starts of phases, the task sleeps
+   * until one of them is posted.
+   */
+  MailboxEsp32 mailbox;
+
+  /**
+   * @brief Keep the bus clock during the upload.
+   */
+  PowerLockEsp32 uploadLock =
+      PowerLockEsp32("iic-upload", ESP_PM_APB_FREQ_MAX);
+
+  /**
+   * @brief When the phase timer is due, to measure the lateness of the phases
+   * (jitter of the display).
+   */
+  int64_t phaseDueAt = 0;
+  JitterProbe *jitterProbe = nullptr;
+
+  /**
+   * @brief Where to mark the first frame sent to the display, cleared once
+   * done.
+   */
+  BootProfiler *bootProfiler = nullptr;
+
+  static void onPhaseTimer(void *arg) {
+    Message message = messageOf(MESSAGE_DISPLAY_PHASE);
+    ((DisplayUpdaterTask *)arg)->mailbox.post(&message);
+  }
+
+  void measurePhaseLateness() {
+    if (0 == phaseDueAt || nullptr == jitterProbe) {
+      return;
+    }
+    jitterProbe->record(phaseDueAt, esp_timer_get_time());
+    phaseDueAt = 0;
+  }
+
+  /**
+   * @brief Take the message.
+   *
+   * @return true when the display is to be refreshed now.
+   */
+  bool handle(Message *message) {
+    switch (message->type) {
+    case MESSAGE_DISPLAY_MODE:
+      modeToApply = (DisplayMode)message->code;
+      return false;
+    case MESSAGE_DISPLAY_CONTENT:
+      std::memcpy(bufferChange, message->text, 4);
+      changeToApply = true;
+      return false;
+    case MESSAGE_DISPLAY_PUSH:
+      std::memcpy(bufferChange, message->text, 4);
+      changeToApply = true;
+      ttl = 0;
+      return true;
+    case MESSAGE_DISPLAY_PHASE:
+      measurePhaseLateness();
+      return true;
+    }
+    return false;
+  }
+
   uint8_t ttl = 0;
 
+  /**
+   * @brief Where to record the uploads of new contents, if any.
+   */
+  InputJournal *journal = nullptr;
+
   SevenSegmentFont *font = (SevenSegmentFont *)&SevenSegmentsFontUsAscii;
 
   void applyChange() {
@@ -187,26 +349,39 @@ private:
   }
 
 public:
-  DisplayUpdaterTask() {
+  DisplayUpdaterTask() : StaticTaskEsp32("display") {
     for (uint8_t i = 0; i < 16; i++) {
       buffer[i] = FILL_CHAR;
     }
+    esp_timer_create_args_t timerArgs = {.callback = onPhaseTimer,
+                                         .arg = this,
+                                         .dispatch_method = ESP_TIMER_TASK,
+                                         .name = "display-phase",
+                                         .skip_unhandled_events = true};
+    ESP_ERROR_CHECK(esp_timer_create(&timerArgs, &phaseTimer));
+    onPhaseTimer(this); // the first phase, as soon as the task runs
   }
   virtual ~DisplayUpdaterTask() {}
 
   void run(void *data) {
-    const TickType_t SLEEP_TIME = 250 / portTICK_PERIOD_MS; // 4 Hz
-
+    Message message;
     while (true) {
+      mailbox.receive(&message, portMAX_DELAY);
+      countWakeUp();
+      if (!handle(&message)) {
+        continue;
+      }
       if (iicReady) {
         if (ttl > 0) {
           --ttl;
         }
 
         // commit pending changes
+        bool applied = false;
         if (0 == ttl && changeToApply) {
           applyChange();
           changeToApply = false;
+          applied = true;
           switch (mode) {
           case GREETINGS:
             ttl = TTL_GREETINGS;
@@ -223,18 +398,18 @@ public:
         }
 
         // animation management
-        ++phase;
-        if (phase >= PHASE_MAX) {
-          phase = 0;
-        }
+        phase = timeline.getStepAt(esp_timer_get_time());
 
         // update display
-        displayRegisters.control.brightness = nightTimeMode ? 1 : 7;
+        displayRegisters.control.brightness =
+            nightTimeMode  ? BRIGHTNESS_NIGHT
+            : lowPowerMode ? BRIGHTNESS_LOW_POWER
+                           : brightness;
 
         uint8_t buffer_start = phase * 4;
         displayRegisters.data.digits[0] =
             font->glyphData[(uint8_t)buffer[buffer_start]];
-        if (phase - 1 < 2) {
+        if (phase < 3) { // lit but in the last phase
           displayRegisters.data.digits[1] =
               font->glyphData[(uint8_t)buffer[buffer_start + 1]] | DOT_BIT;
         } else {
@@ -246,22 +421,49 @@ public:
         displayRegisters.data.digits[3] =
             font->glyphData[(uint8_t)buffer[buffer_start + 3]];
 
+        uploadLock.acquire();
         iicBridge.upload(&displayRegisters, iicPort);
+        uploadLock.release();
+        if (nullptr != bootProfiler) {
+          bootProfiler->mark("first-frame");
+          bootProfiler = nullptr;
+        }
+        if (applied && nullptr != journal) {
+          journal->record(INPUT_JOURNAL_DISPLAY, 0, mode);
+        }
       }
-      vTaskDelay(SLEEP_TIME);
+      // wait for the start of the next phase, even when the timeline has been
+      // moved meanwhile.
+      int64_t now = esp_timer_get_time();
+      int64_t delay = lowPowerMode ? timeline.getDelayToNextOddStep(now)
+                                   : timeline.getDelayToNextStep(now);
+      esp_timer_stop(phaseTimer); // still armed after a push
+      esp_timer_start_once(phaseTimer, delay);
+      phaseDueAt = now + delay;
     }
   }
 
-  // external updaters
-  void scheduleContent(char *source) {
+  /**
+   * @brief Record the lateness of the starts of the animation phases.
+   */
+  void setJitterProbe(JitterProbe *probe) { jitterProbe = probe; }
+
+  /**
+   * @brief Mark the first frame sent to the display.
+   */
+  void setBootProfiler(BootProfiler *profiler) { bootProfiler = profiler; }
+
+  // external updaters, posting to the task
+  void scheduleContent(char *source, uint16_t type = MESSAGE_DISPLAY_CONTENT) {
+    Message message = messageOf(type);
     bool endOfSource = false;
     for (uint8_t i = 0; i < 4; i++) {
       char val = source[i];
       if (val == 0)
         endOfSource = true;
-      bufferChange[i] = endOfSource ? FILL_CHAR : val;
+      message.text[i] = endOfSource ? FILL_CHAR : val;
     }
-    changeToApply = true;
+    mailbox.post(&message);
   }
 
   /**
@@ -269,17 +471,41 @@ public:
    *
    * @param mode of display.
    */
-  void scheduleModeChange(DisplayMode mode) { modeToApply = mode; }
+  void scheduleModeChange(DisplayMode mode) {
+    Message message = messageOf(MESSAGE_DISPLAY_MODE, mode);
+    mailbox.post(&message);
+  }
+
+  /**
+   * @brief Show a content at once, e.g. in answer to a button : the updater
+   * is woken up without waiting for the next phase, and any time to live of
+   * the current content is cut short.
+   *
+   * @param source the content.
+   * @param mode the mode of display.
+   */
+  void pushContent(char *source, DisplayMode mode) {
+    scheduleModeChange(mode);
+    scheduleContent(source, MESSAGE_DISPLAY_PUSH);
+  }
 
   /**
-   * @brief The updater cannot queue the changes, so it is usually best to try
-   * again later.
+   * @brief The updater applies one change per phase, so it is usually best to
+   * try again later.
    *
    * @return true when there is a change that has not be applied yet.
    */
-  bool isBusy() { return ttl > 0 || changeToApply || !iicReady; }
+  bool isBusy() {
+    return ttl > 0 || changeToApply || 0 < mailbox.getDepth() || !iicReady;
+  }
+  MailboxEsp32 *getMailbox() { return &mailbox; }
   DisplayMode getMode() { return mode; }
+  AnimationTimeline *getTimeline() { return &timeline; }
   void setNightTime(bool value) { nightTimeMode = value; }
+  uint8_t getBrightness() { return brightness; }
+  void setBrightness(uint8_t value) { brightness = value; }
+  void setLowPower(bool value) { lowPowerMode = value; }
+  void setJournal(InputJournal *journal) { this->journal = journal; }
 
   // ----- setup iic
   void setupIic(uint8_t iicPort, const i2c_config_t *conf) {
@@ -301,46 +527,83 @@ public:
 };
 
 //====================================================================
-// --- the clock command interface
-/**
- * @brief The interface implemented by the clock, relative to buttons message.
- *
- * @note For each button, the clock will acknowledge two types of messages :
- * @note - A normal click, that happens when a buttons is transitioning from
- * high to low ;
- * @note - A long click, when the button is maintained push for a long enough
- * time
- * @note ---
- * @note For menu and back buttons, the long click will happen only once, until
- * the button is released.
- * @note ---
- * @note For up and down buttons, the long click will happen regularly, until
- * the button is released.
- *
- */
-class TheClockCommandListener {
-public:
-  virtual void onMenuClick() = 0;
-
-  virtual void onMenuLongClick() = 0;
-
-  virtual void onBackClick() = 0;
+// --- the clock menu, all in flash
+enum TheClockMenuId {
+  MENU_ACTION_RESYNC,
+  MENU_ACTION_FORGET_WIFI,
+  MENU_VALUE_BRIGHTNESS,
+  MENU_VALUE_TIMEZONE
+};
 
-  virtual void onBackLongClick() = 0;
+static constexpr const char *TIMEZONE_LABELS[] = {"CET", "UTC", "GMT",
+                                                  "EET", "EST", "PST"};
+static constexpr const char *TIMEZONE_RULES[] = {
+    "CET-1CEST-2,M3.5.0/02:00:00,M10.5.0/03:00:00", // default
+    "UTC0",
+    "GMT0BST,M3.5.0/1,M10.5.0",
+    "EET-2EEST,M3.5.0/3,M10.5.0/4",
+    "EST5EDT,M3.2.0,M11.1.0",
+    "PST8PDT,M3.2.0,M11.1.0"};
+const int16_t TIMEZONE_COUNT = sizeof(TIMEZONE_RULES) / sizeof(char *);
+
+// label ; type ; id ; parent ; first child, child count ; min, max ; choices
+static constexpr MenuItem THE_CLOCK_MENU[] = {
+    /* 0 */ {"MENU", MENU_ITEM_SUBMENU, 0, MENU_NO_PARENT, 1, 4, 0, 0, nullptr},
+    /* 1 */
+    {"SYNC", MENU_ITEM_ACTION, MENU_ACTION_RESYNC, 0, 0, 0, 0, 0, nullptr},
+    /* 2 */ {"BRIT", MENU_ITEM_VALUE, MENU_VALUE_BRIGHTNESS, 0, 0, 0, 1, 7,
+             nullptr},
+    /* 3 */
+    {"ZONE", MENU_ITEM_VALUE, MENU_VALUE_TIMEZONE, 0, 0, 0, 0,
+     TIMEZONE_COUNT - 1, TIMEZONE_LABELS},
+    /* 4 */ {"WIFI", MENU_ITEM_SUBMENU, 0, 0, 5, 1, 0, 0, nullptr},
+    /* 5 */
+    {"FORG", MENU_ITEM_ACTION, MENU_ACTION_FORGET_WIFI, 4, 0, 0, 0, 0,
+     nullptr},
+};
 
-  virtual void onUpClick() = 0;
+//====================================================================
+// --- the clock main loop
 
-  virtual void onUpLongClick() = 0;
+/**
+ * @brief Post the commands to the mailbox of the clock, instead of calling the
+ * clock from the task of the buttons.
+ */
+class TheClockCommandPoster : public TheClockCommandListener {
+private:
+  MailboxEsp32 *mailbox;
 
-  virtual void onDownClick() = 0;
+  void post(TheClockCommand command) {
+    Message message = messageOf(MESSAGE_COMMAND, command);
+    if (!mailbox->post(&message)) {
+      ESP_LOGW(TAG, "Command %d dropped, the clock is too busy.", command);
+    }
+  }
 
-  virtual void onDownLongClick() = 0;
+public:
+  TheClockCommandPoster(MailboxEsp32 *mailbox) : mailbox(mailbox) {}
+  virtual ~TheClockCommandPoster() {}
+  virtual void onMenuClick() { post(COMMAND_MENU_CLICK); }
+  virtual void onMenuLongClick() { post(COMMAND_MENU_LONG_CLICK); }
+  virtual void onMenuDoubleClick() { post(COMMAND_MENU_DOUBLE_CLICK); }
+  virtual void onMenuBackChord() { post(COMMAND_MENU_BACK_CHORD); }
+  virtual void onBackClick() { post(COMMAND_BACK_CLICK); }
+  virtual void onBackLongClick() { post(COMMAND_BACK_LONG_CLICK); }
+  virtual void onUpClick() { post(COMMAND_UP_CLICK); }
+  virtual void onUpLongClick() { post(COMMAND_UP_LONG_CLICK); }
+  virtual void onDownClick() { post(COMMAND_DOWN_CLICK); }
+  virtual void onDownLongClick() { post(COMMAND_DOWN_LONG_CLICK); }
 };
 
-// --- the clock main loop
-class TheClockTask : public Task, public TheClockCommandListener {
+class TheClockTask : public StaticTaskEsp32,
+                     public TheClockCommandListener,
+                     public MenuListener {
   PROPERTY(TheClockTask,DisplayUpdaterTask,Display)
   PROPERTY(TheClockTask,WifiStationEsp32,WifiStation)
+  PROPERTY(TheClockTask,InputJournal,InputJournal)
+  PROPERTY(TheClockTask,NetworkTimeKeeperEsp32,NetworkTimeKeeper)
+  PROPERTY(TheClockTask,JitterProbe,JitterProbe)
+  PROPERTY(TheClockTask,BootProfiler,BootProfiler)
 private:
   // Manage display of greetings
   uint8_t greetingsPosition = 0;
@@ -350,6 +613,139 @@ private:
       5; // wait at least a half seconds before updating time again.
 
   char timeBuffer[5]; // 4 digits + string terminator
+  bool bootReported = false;
+
+  // Manual setting of the time, driven by the commands
+  ManualTimeSetter setter;
+  char settingBuffer[5]; // 4 digits + string terminator
+  TimeSource timeSource = TIME_SOURCE_NONE;
+  int64_t lastSeenSynchronization = 0;
+
+  /**
+   * @brief Follow the synchronizations from the network, each one superseding
+   * a manual setting.
+   */
+  void updateTimeSource() {
+    if (!hasNetworkTimeKeeper()) {
+      return;
+    }
+    int64_t last = myNetworkTimeKeeper->getLastSynchronization();
+    if (last == lastSeenSynchronization) {
+      return;
+    }
+    lastSeenSynchronization = last;
+    if (TIME_SOURCE_MANUAL == timeSource) {
+      ESP_LOGI(TAG, "TheClockTask: manual time superseded by the network");
+    }
+    timeSource = TIME_SOURCE_NETWORK;
+  }
+
+  // Menu, driven by the commands
+  MenuNavigator menu = MenuNavigator(THE_CLOCK_MENU);
+  int16_t timezone = 0;
+
+  /**
+   * @brief Show the current item of the menu at once, or the time when the
+   * menu has been closed.
+   */
+  void pushMenu() {
+    if (!menu.isActive()) {
+      pushTime();
+      return;
+    }
+    menu.format(settingBuffer);
+    myDisplay->pushContent(settingBuffer, MENU);
+  }
+
+  /**
+   * @brief When the menu is open, give it the command.
+   *
+   * @return true when the menu is open.
+   */
+  bool routeToMenu(void (MenuNavigator::*command)()) {
+    if (!menu.isActive() || !hasDisplay()) {
+      return false;
+    }
+    (menu.*command)();
+    pushMenu();
+    return true;
+  }
+
+  /**
+   * @brief The clock is the only one to set the timezone, the time keepers
+   * only set the time.
+   */
+  void applyTimezone() {
+    setenv("TZ", TIMEZONE_RULES[timezone], 1);
+    tzset();
+  }
+
+  /**
+   * @brief Restore the timezone chosen in the menu, if any.
+   */
+  void loadTimezone() {
+    nvs_handle_t handle;
+    if (ESP_OK != nvs_open(NAME_STORAGE_SETTINGS, NVS_READONLY, &handle)) {
+      return; // nothing saved yet
+    }
+    int16_t value;
+    if (ESP_OK == nvs_get_i16(handle, KEY_TIMEZONE, &value) && 0 <= value &&
+        value < TIMEZONE_COUNT) {
+      timezone = value;
+    }
+    nvs_close(handle);
+  }
+
+  void saveTimezone() {
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(NAME_STORAGE_SETTINGS, NVS_READWRITE, &handle);
+    if (ESP_OK == err) {
+      err = nvs_set_i16(handle, KEY_TIMEZONE, timezone);
+      if (ESP_OK == err) {
+        err = nvs_commit(handle);
+      }
+      nvs_close(handle);
+    }
+    if (ESP_OK != err) {
+      ESP_LOGE(TAG, "Error (%s) saving the timezone!", esp_err_to_name(err));
+    }
+  }
+
+  /**
+   * @brief Show the time being set at once.
+   */
+  void pushSetting() {
+    setter.format(settingBuffer);
+    myDisplay->pushContent(settingBuffer, MANUAL_TIME_HOUR == setter.getField()
+                                              ? CHANGE_HOUR
+                                              : CHANGE_MINUTES);
+  }
+
+  /**
+   * @brief Back to the display of the time, at once.
+   */
+  void pushTime() {
+    time_t current;
+    struct tm local;
+    time(&current);
+    localtime_r(&current, &local);
+    strftime(settingBuffer, sizeof(settingBuffer), "%H%M", &local);
+    myDisplay->pushContent(settingBuffer, TIME);
+  }
+
+  /**
+   * @brief When setting the time, change the current field.
+   *
+   * @return true when the time is being set.
+   */
+  bool stepSetting(int32_t steps) {
+    if (!setter.isActive() || !hasDisplay()) {
+      return false;
+    }
+    setter.step(steps);
+    pushSetting();
+    return true;
+  }
   time_t now = 0;
   struct tm timeinfo = {.tm_sec = 0,
                         .tm_min = 0,
@@ -361,18 +757,41 @@ private:
                         .tm_yday = 0,
                         .tm_isdst = 0};
 
+  /**
+   * @brief The commands, from the task of the buttons.
+   */
+  MailboxEsp32 mailbox;
+  TheClockCommandPoster poster = TheClockCommandPoster(&mailbox);
+
 public:
-  virtual ~TheClockTask() {
-    setenv("TZ", "CET-1CEST-2,M3.5.0/02:00:00,M10.5.0/03:00:00",
-           1); // TODO make it configurable
-    tzset();
+  TheClockTask() : StaticTaskEsp32("the-clock") { menu.withListener(this); }
+  virtual ~TheClockTask() {}
+
+  /**
+   * @brief Once the correct time is shown for the first time, log the profile
+   * of the boot.
+   */
+  void reportBoot() {
+    if (!hasBootProfiler() || bootReported ||
+        (TIME_SOURCE_NONE == timeSource &&
+         timeinfo.tm_year < VALID_TIME_MIN_YEAR - 1900)) {
+      return; // not yet the correct time
+    }
+    bootReported = true;
+    myBootProfiler->mark("time-shown");
+    char summary[BOOT_PROFILER_SUMMARY_SIZE];
+    myBootProfiler->format(summary, sizeof(summary));
+    ESP_LOGI(TAG, "Boot profile (ms) : %s", summary);
   }
 
   void run(void *data) {
     const TickType_t SLEEP_TIME = 100 / portTICK_PERIOD_MS; // 10 Hz
+    loadTimezone();
+    applyTimezone();
 
     while (true) {
       if (0 == phaseTime) {
+        updateTimeSource();
         time(&now);
         localtime_r(&now, &timeinfo);
 
@@ -392,36 +811,131 @@ public:
             myDisplay->scheduleContent(GREETINGS_STRING + greetingsPosition);
             break;
           case TIME:
-            if (0 == phaseTime) {
+            if (0 == phaseTime && !setter.isActive() && !menu.isActive()) {
               myDisplay->scheduleContent(timeBuffer);
               phaseTime = PHASE_TIME_MAX;
+              reportBoot();
             }
             break;
           case CHANGE_HOUR:
-            ESP_LOGI(TAG, "TheClockTask: change hour -- or not");
-            break;
           case CHANGE_MINUTES:
-            ESP_LOGI(TAG, "TheClockTask: change minutes -- or not");
+            // pushed at once by the commands
             break;
           case MENU:
-            ESP_LOGI(TAG, "TheClockTask: menu -- or not");
+            // pushed at once by the commands
             break;
           default:
             ESP_LOGE(TAG, "TheClockTask: UNKNOWN MODE");
           }
         }
       }
-      if (0 == greetingsPosition) {
-        myDisplay->scheduleModeChange(TIME);
+      if (0 == greetingsPosition && !setter.isActive() && !menu.isActive()) {
+        if (TIME != myDisplay->getMode()) {
+          myDisplay->scheduleModeChange(TIME); // not posted again once applied
+        }
         phaseTime = 0; // force display of time next cycle
       }
 
-      vTaskDelay(SLEEP_TIME); // do nothing while no display
+      // handle the commands as soon as they are posted, until the next cycle
+      TickType_t cycleStart = xTaskGetTickCount();
+      int64_t cycleEndUs =
+          esp_timer_get_time() + SLEEP_TIME * portTICK_PERIOD_MS * 1000;
+      TickType_t elapsed = 0;
+      Message message;
+      while (elapsed < SLEEP_TIME &&
+             mailbox.receive(&message, SLEEP_TIME - elapsed)) {
+        countWakeUp();
+        if (MESSAGE_COMMAND == message.type) {
+          handleCommand((TheClockCommand)message.code);
+        }
+        elapsed = xTaskGetTickCount() - cycleStart;
+      }
+      countWakeUp();
+      if (hasJitterProbe()) {
+        myJitterProbe->record(cycleEndUs, esp_timer_get_time());
+      }
+    }
+  }
+
+  /**
+   * @brief The commands of the control panel are posted to this listener,
+   * they are then handled by the task of the clock.
+   */
+  TheClockCommandListener *getCommandPoster() { return &poster; }
+  MailboxEsp32 *getMailbox() { return &mailbox; }
+
+  void handleCommand(TheClockCommand command) {
+    switch (command) {
+    case COMMAND_MENU_CLICK:
+      onMenuClick();
+      break;
+    case COMMAND_MENU_LONG_CLICK:
+      onMenuLongClick();
+      break;
+    case COMMAND_MENU_DOUBLE_CLICK:
+      onMenuDoubleClick();
+      break;
+    case COMMAND_MENU_BACK_CHORD:
+      onMenuBackChord();
+      break;
+    case COMMAND_BACK_CLICK:
+      onBackClick();
+      break;
+    case COMMAND_BACK_LONG_CLICK:
+      onBackLongClick();
+      break;
+    case COMMAND_UP_CLICK:
+      onUpClick();
+      break;
+    case COMMAND_UP_LONG_CLICK:
+      onUpLongClick();
+      break;
+    case COMMAND_DOWN_CLICK:
+      onDownClick();
+      break;
+    case COMMAND_DOWN_LONG_CLICK:
+      onDownLongClick();
+      break;
     }
   }
 
   // === TheClockCommandListener
-  virtual void onMenuClick() { ESP_LOGI(TAG, "TheClockTask: on menu click"); }
+  /**
+   * @brief Set the time : the first click starts with the hour, the next one
+   * goes to the minutes, the last one sets the time.
+   */
+  virtual void onMenuClick() {
+    ESP_LOGI(TAG, "TheClockTask: on menu click");
+    if (!hasDisplay() || routeToMenu(&MenuNavigator::select)) {
+      return;
+    }
+    time_t current;
+    time(&current);
+    if (!setter.isActive()) {
+      struct tm local;
+      localtime_r(&current, &local);
+      setter.begin(&local);
+      pushSetting();
+    } else if (setter.nextField()) {
+      pushSetting();
+    } else {
+      struct timeval tv = {.tv_sec = setter.commit(current), .tv_usec = 0};
+      settimeofday(&tv, NULL);
+      timeSource = TIME_SOURCE_MANUAL;
+      if (hasNetworkTimeKeeper()) {
+        // only a later synchronization supersedes this setting
+        lastSeenSynchronization = myNetworkTimeKeeper->getLastSynchronization();
+      }
+      ESP_LOGI(TAG, "TheClockTask: time set manually");
+      pushTime();
+    }
+  }
+
+  /**
+   * @brief Where the current time comes from, a manual setting being
+   * replaced at the next synchronization from the network.
+   */
+  TimeSource getTimeSource() { return timeSource; }
 
   virtual void onMenuLongClick() {
     ESP_LOGI(TAG, "TheClockTask: on menu LONG click");
@@ -430,81 +944,345 @@ public:
     }
   }
 
-  virtual void onBackClick() { ESP_LOGI(TAG, "TheClockTask: on back click"); }
+  /**
+   * @brief Open the menu, unless the time is being set.
+   */
+  virtual void onMenuDoubleClick() {
+    ESP_LOGI(TAG, "TheClockTask: on menu DOUBLE click");
+    if (!hasDisplay() || setter.isActive() || menu.isActive()) {
+      return;
+    }
+    menu.open();
+    pushMenu();
+  }
+
+  virtual void onMenuBackChord() {
+    ESP_LOGI(TAG, "TheClockTask: on menu+back chord");
+    if (hasInputJournal()) {
+      dumpInputJournal();
+    }
+    reportMailbox("clock", &mailbox);
+    if (hasDisplay()) {
+      reportMailbox("display", myDisplay->getMailbox());
+    }
+  }
+
+  /**
+   * @brief Log the depth and the latency of a mailbox.
+   */
+  static void reportMailbox(const char *name, MailboxEsp32 *mailbox) {
+    MailboxStatistics statistics;
+    mailbox->getStatistics(&statistics);
+    ESP_LOGI(TAG,
+             "Mailbox '%s' : %lu posted, %lu dropped, max depth %lu, latency "
+             "max %lld us, average %lld us",
+             name, (unsigned long)statistics.posted,
+             (unsigned long)statistics.dropped,
+             (unsigned long)statistics.maxDepth, statistics.maxLatency,
+             0 < statistics.received
+                 ? statistics.totalLatency / statistics.received
+                 : 0LL);
+  }
+
+  /**
+   * @brief Log the input journal, to be replayed on the native environment
+   * (the import accepts a capture of the log), and the latencies.
+   */
+  void dumpInputJournal() {
+    char line[64];
+    uint32_t count = myInputJournal->getSize();
+    ESP_LOGI(TAG, "Input journal, %lu entries :", (unsigned long)count);
+    for (uint32_t i = 0; i < count; i++) {
+      int length = myInputJournal->exportEntry(i, line, sizeof(line));
+      if (0 < length) {
+        ESP_LOGI(TAG, "%.*s", length - 1, line); // without the newline
+      }
+    }
+    InputLatency latency;
+    if (myInputJournal->measure(INPUT_JOURNAL_EDGE, INPUT_JOURNAL_COMMAND,
+                                &latency)) {
+      ESP_LOGI(TAG, "Edge to command : %lld..%lld us, average %lld us",
+               latency.min, latency.max, latency.total / latency.count);
+    }
+    if (myInputJournal->measure(INPUT_JOURNAL_EDGE, INPUT_JOURNAL_DISPLAY,
+                                &latency)) {
+      ESP_LOGI(TAG, "Edge to display : %lld..%lld us, average %lld us",
+               latency.min, latency.max, latency.total / latency.count);
+      if (INPUT_LATENCY_BUDGET_US < latency.max) {
+        ESP_LOGW(TAG, "Edge to display over the budget of %lld us",
+                 INPUT_LATENCY_BUDGET_US);
+      }
+    }
+    if (myInputJournal->measure(INPUT_JOURNAL_COMMAND, INPUT_JOURNAL_DISPLAY,
+                                &latency)) {
+      ESP_LOGI(TAG, "Command to display : %lld..%lld us, average %lld us",
+               latency.min, latency.max, latency.total / latency.count);
+    }
+  }
+
+  virtual void onBackClick() {
+    ESP_LOGI(TAG, "TheClockTask: on back click");
+    if (routeToMenu(&MenuNavigator::back)) {
+      return;
+    }
+    if (setter.isActive() && hasDisplay()) {
+      setter.cancel();
+      pushTime();
+    }
+  }
 
   virtual void onBackLongClick() {
     ESP_LOGI(TAG, "TheClockTask: on back LONG click");
   }
 
-  virtual void onUpClick() { ESP_LOGI(TAG, "TheClockTask: on up click"); }
+  virtual void onUpClick() {
+    if (!routeToMenu(&MenuNavigator::up) && !stepSetting(1)) {
+      ESP_LOGI(TAG, "TheClockTask: on up click");
+    }
+  }
 
   virtual void onUpLongClick() {
-    ESP_LOGI(TAG, "TheClockTask: on up LONG click");
+    if (!routeToMenu(&MenuNavigator::up) && !stepSetting(1)) {
+      ESP_LOGI(TAG, "TheClockTask: on up LONG click");
+    }
   }
 
-  virtual void onDownClick() { ESP_LOGI(TAG, "TheClockTask: on down click"); }
+  virtual void onDownClick() {
+    if (!routeToMenu(&MenuNavigator::down) && !stepSetting(-1)) {
+      ESP_LOGI(TAG, "TheClockTask: on down click");
+    }
+  }
 
   virtual void onDownLongClick() {
-    ESP_LOGI(TAG, "TheClockTask: on down LONG click");
+    if (!routeToMenu(&MenuNavigator::down) && !stepSetting(-1)) {
+      ESP_LOGI(TAG, "TheClockTask: on down LONG click");
+    }
+  }
+
+  // === MenuListener
+  virtual void onMenuAction(uint8_t id) {
+    switch (id) {
+    case MENU_ACTION_RESYNC:
+      ESP_LOGI(TAG, "TheClockTask: resynchronize now%s",
+               TIME_SOURCE_MANUAL == getTimeSource()
+                   ? ", replacing the manual time"
+                   : "");
+      if (hasWifiStation() && myWifiStation->wakeUp()) {
+        break; // synchronized once connected
+      }
+      if (hasNetworkTimeKeeper()) {
+        myNetworkTimeKeeper->resynchronize();
+      }
+      break;
+    case MENU_ACTION_FORGET_WIFI:
+      if (hasWifiStation()) {
+        myWifiStation->forgetKnownAccessPoints();
+      }
+      break;
+    }
+  }
+
+  virtual int16_t getMenuValue(uint8_t id) {
+    switch (id) {
+    case MENU_VALUE_BRIGHTNESS:
+      return myDisplay->getBrightness();
+    case MENU_VALUE_TIMEZONE:
+      return timezone;
+    }
+    return 0;
+  }
+
+  virtual void onMenuValue(uint8_t id, int16_t value) {
+    switch (id) {
+    case MENU_VALUE_BRIGHTNESS:
+      myDisplay->setBrightness((uint8_t)value);
+      break;
+    case MENU_VALUE_TIMEZONE:
+      timezone = value;
+      applyTimezone();
+      saveTimezone();
+      phaseTime = 0; // show the new local time next cycle
+      break;
+    }
+  }
+};
+
+//====================================================================
+// Power usage report
+class PowerReportJob : public TimerJob {
+public:
+  virtual ~PowerReportJob() {}
+  void onTimer(uint64_t now) { PowerManagerEsp32::report(); }
+};
+
+//====================================================================
+// Heap usage report : free heap, low water mark and change since the end
+// of the setup, unused stack of the tasks.
+class HeapReportJob : public TimerJob {
+private:
+  static constexpr char *TAG = (char *)"HeapReportJob";
+  static const uint32_t MAX_TASKS = 12;
+  StaticTaskEsp32 *tasks[MAX_TASKS];
+  uint32_t taskCount = 0;
+  size_t freeAfterSetup = 0;
+
+public:
+  virtual ~HeapReportJob() {}
+  HeapReportJob *withTask(StaticTaskEsp32 *task) {
+    if (nullptr != task && taskCount < MAX_TASKS) {
+      tasks[taskCount++] = task;
+    }
+    return this;
+  }
+  void markEndOfSetup() {
+    freeAfterSetup = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  }
+  void onTimer(uint64_t now) {
+    size_t freeNow = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    ESP_LOGI(TAG, "heap : free %lu, lowest %lu, used since setup %ld",
+             (unsigned long)freeNow,
+             (unsigned long)heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT),
+             (long)freeAfterSetup - (long)freeNow);
+    for (uint32_t i = 0; i < taskCount; i++) {
+      StaticTaskEsp32 *task = tasks[i];
+      if (!task->isStarted()) {
+        continue;
+      }
+      ESP_LOGI(TAG, "stack of '%s' (%s) : %lu/%lu unused", task->getName(),
+               task->isStatic() ? "static" : "heap",
+               (unsigned long)uxTaskGetStackHighWaterMark(task->getHandle()),
+               (unsigned long)task->getStackSize());
+    }
+  }
+};
+
+//====================================================================
+// Stress test : force the wifi to reconnect, the jitter of the display must
+// stay flat meanwhile.
+class WifiReconnectStormJob : public TimerJob {
+private:
+  WifiStationEsp32 *station;
+  JitterMonitorEsp32 *jitter;
+
+public:
+  WifiReconnectStormJob(WifiStationEsp32 *station, JitterMonitorEsp32 *jitter)
+      : station(station), jitter(jitter) {}
+  virtual ~WifiReconnectStormJob() {}
+  void onTimer(uint64_t now) {
+    jitter->report();
+    if (station->isConnected() && station->park()) {
+      ESP_LOGI(TAG, "Stress test : forcing a reconnection.");
+      station->wakeUp();
+    }
   }
 };
 
 //====================================================================
-// Sample task : led updater
-class LedUpdaterTask : public Task {
+// Connect on demand : wake up the radio to synchronize the time
+class WifiWakeUpJob : public TimerJob {
+private:
+  WifiStationEsp32 *station;
+
+public:
+  WifiWakeUpJob(WifiStationEsp32 *station) : station(station) {}
+  virtual ~WifiWakeUpJob() {}
+  void onTimer(uint64_t now) { station->wakeUp(); }
+};
+
+//====================================================================
+// Sample job : led updater
+class LedUpdaterJob : public TimerJob {
 private:
   GeneralPurposeInputOutput *gpio;
   FeedbackLed *led;
 
 public:
-  virtual ~LedUpdaterTask() {}
-  LedUpdaterTask *withGpio(GeneralPurposeInputOutput *gpio) {
+  static const uint32_t PERIOD_MS = 100; // 10 Hz
+  virtual ~LedUpdaterJob() {}
+  LedUpdaterJob *withGpio(GeneralPurposeInputOutput *gpio) {
     this->gpio = gpio;
     return this;
   }
-  LedUpdaterTask *withLed(FeedbackLed *led) {
+  LedUpdaterJob *withLed(FeedbackLed *led) {
     this->led = led;
     return this;
   }
-  void run(void *data) {
-    const TickType_t SLEEP_TIME = 100 / portTICK_PERIOD_MS; // 10 Hz
-    while (true) {
-      bool nextValue = led->next();
-      gpio->getDigital()->write(CONFIG_PIN_STATUS_MAIN,
-                                CONFIG_PIN_STATUS_MAIN_INVERTED ? !nextValue
-                                                                : nextValue);
-      vTaskDelay(SLEEP_TIME);
-    }
+  void onTimer(uint64_t now) {
+    bool nextValue = led->next();
+    gpio->getDigital()->write(CONFIG_PIN_STATUS_MAIN,
+                              CONFIG_PIN_STATUS_MAIN_INVERTED ? !nextValue
+                                                              : nextValue);
   }
 };
 
 // Sample task : button watcher
-class ButtonWatcherTask : public Task, public InputButtonListener {
+class ButtonWatcherTask : public StaticTaskEsp32, public InputButtonListener {
 private:
   GeneralPurposeInputOutput *gpio;
+  ButtonInterruptsEsp32 *interrupts = nullptr;
+  ButtonBatchReaderEsp32 *batch = nullptr;
   InputButton *buttonMenu;
   InputButton *buttonBack;
   InputButton *buttonUp;
   InputButton *buttonDown;
   FeedbackLed *led; // TODO move to TheClock
-  TheClockCommandListener *theClock;
-
-  // long clicks managements
-  uint8_t counterMenu = 0;
-  uint8_t counterBack = 0;
-  uint8_t counterUp = 0;
-  uint8_t counterDown = 0;
-  const uint8_t LONG_CLICK_MENU = 100; // 2 seconds
-  const uint8_t LONG_CLICK_BACK = 100; // 2 seconds
-  const uint8_t LONG_CLICK_UP = 25;    // 0.5 seconds
-  const uint8_t LONG_CLICK_DOWN = 25;  // 0.5s seconds
+  InputJournal *journal = nullptr;
+
+  // gestures : long click ; double click ; repeat delay, period, min period,
+  // acceleration (all in ms and %)
+  static constexpr GestureProfile GESTURES_MENU = {2000, 300, 0, 0, 0, 0};
+  static constexpr GestureProfile GESTURES_BACK = {2000, 0, 0, 0, 0, 0};
+  static constexpr GestureProfile GESTURES_UP_DOWN = {0, 0, 500, 250, 40, 15};
+  GestureRecognizer gestures;
+  ButtonCommandDispatcher dispatcher =
+      ButtonCommandDispatcher(CONFIG_PIN_BUTTON_MENU, CONFIG_PIN_BUTTON_BACK,
+                              CONFIG_PIN_BUTTON_UP, CONFIG_PIN_BUTTON_DOWN);
+
+  /**
+   * @brief Lengthened on battery, when polling the buttons.
+   */
+  volatile uint32_t pollPeriodMs = POLL_PERIOD_NOMINAL_MS;
+  JitterProbe *jitterProbe = nullptr;
+
+  static uint32_t nowMs() { return (uint32_t)(esp_timer_get_time() / 1000); }
 
 public:
+  static const uint32_t POLL_PERIOD_NOMINAL_MS = 20;   // 50 Hz
+  static const uint32_t POLL_PERIOD_LOW_POWER_MS = 50; // 20 Hz
+  ButtonWatcherTask() : StaticTaskEsp32("buttons") {
+    gestures.withButton(CONFIG_PIN_BUTTON_MENU, &GESTURES_MENU)
+        ->withButton(CONFIG_PIN_BUTTON_BACK, &GESTURES_BACK)
+        ->withButton(CONFIG_PIN_BUTTON_UP, &GESTURES_UP_DOWN)
+        ->withButton(CONFIG_PIN_BUTTON_DOWN, &GESTURES_UP_DOWN)
+        ->withChord(CONFIG_PIN_BUTTON_MENU, CONFIG_PIN_BUTTON_BACK)
+        ->withListener(&dispatcher);
+  }
   virtual ~ButtonWatcherTask() {}
+  void setPollPeriod(uint32_t periodMs) { pollPeriodMs = periodMs; }
+  /**
+   * @brief Record the lateness of the samplings of the buttons, when they are
+   * polled.
+   */
+  void setJitterProbe(JitterProbe *probe) { jitterProbe = probe; }
   ButtonWatcherTask *withGpio(GeneralPurposeInputOutput *gpio) {
     this->gpio = gpio;
     return this;
   }
+  /**
+   * @brief When set, the task sleeps until a button changes instead of
+   * polling the buttons.
+   */
+  ButtonWatcherTask *withInterrupts(ButtonInterruptsEsp32 *interrupts) {
+    this->interrupts = interrupts;
+    return this;
+  }
+  /**
+   * @brief When set, the buttons are polled with one read of the inputs.
+   */
+  ButtonWatcherTask *withBatchReader(ButtonBatchReaderEsp32 *batch) {
+    this->batch = batch;
+    return this;
+  }
   ButtonWatcherTask *withButtonMenu(InputButton *button) {
     this->buttonMenu = button;
     button->withListener(this);
@@ -530,88 +1308,180 @@ public:
     return this;
   }
   ButtonWatcherTask *withTheClock(TheClockCommandListener *theClock) {
-    this->theClock = theClock;
+    dispatcher.withListener(theClock);
+    return this;
+  }
+  ButtonCommandDispatcher *getDispatcher() { return &dispatcher; }
+  /**
+   * @brief Record the changes of the buttons, the gestures and the commands.
+   */
+  ButtonWatcherTask *withJournal(InputJournal *journal) {
+    this->journal = journal;
+    dispatcher.withJournal(journal);
     return this;
   }
   void run(void *data) {
-    const TickType_t SLEEP_TIME = 20 / portTICK_PERIOD_MS; // 50 Hz
+    if (nullptr != interrupts) {
+      interrupts->withJournal(journal)
+          ->withButton(buttonMenu)
+          ->withButton(buttonBack)
+          ->withButton(buttonUp)
+          ->withButton(buttonDown)
+          ->start();
+    } else if (nullptr != batch) {
+      batch->withButton(buttonMenu)
+          ->withButton(buttonBack)
+          ->withButton(buttonUp)
+          ->withButton(buttonDown)
+          ->start();
+    }
     while (true) {
-      // update state
-      buttonMenu->update(gpio->getDigital()->read(buttonMenu->getId()));
-      buttonBack->update(gpio->getDigital()->read(buttonBack->getId()));
-      buttonUp->update(gpio->getDigital()->read(buttonUp->getId()));
-      buttonDown->update(gpio->getDigital()->read(buttonDown->getId()));
-
-      // manage long clicks
-      if (!buttonMenu->isHigh()) {
-        if (LONG_CLICK_MENU >= counterMenu) {
-          ++counterMenu;
-          if (LONG_CLICK_MENU == counterMenu) {
-            theClock->onMenuLongClick();
-            // only once until release
-          }
-        }
-      }
-      if (!buttonBack->isHigh()) {
-        if (LONG_CLICK_BACK >= counterBack) {
-          ++counterBack;
-          if (LONG_CLICK_BACK == counterBack) {
-            theClock->onBackLongClick();
-            // only once until release
-          }
-        }
-      }
-      if (!buttonUp->isHigh()) {
-        ++counterUp;
-        if (LONG_CLICK_UP == counterUp) {
-          theClock->onUpLongClick();
-          counterUp = 0; // repeat
-        }
+      countWakeUp();
+      if (nullptr != batch) {
+        batch->update();
+      } else if (nullptr == interrupts) {
+        // update state
+        buttonMenu->update(gpio->getDigital()->read(buttonMenu->getId()));
+        buttonBack->update(gpio->getDigital()->read(buttonBack->getId()));
+        buttonUp->update(gpio->getDigital()->read(buttonUp->getId()));
+        buttonDown->update(gpio->getDigital()->read(buttonDown->getId()));
       }
-      if (!buttonDown->isHigh()) {
-        ++counterDown;
-        if (LONG_CLICK_DOWN == counterDown) {
-          theClock->onDownLongClick();
-          counterDown = 0; // repeat
+
+      // expire the gestures deadlines (long clicks, repeats...)
+      uint32_t now = nowMs();
+      gestures.tick(now);
+
+      uint32_t deadline;
+      if (nullptr == interrupts) {
+        uint32_t period = pollPeriodMs;
+        int64_t sleptAt = esp_timer_get_time();
+        vTaskDelay(period / portTICK_PERIOD_MS);
+        if (nullptr != jitterProbe) {
+          jitterProbe->record(sleptAt + period * 1000, esp_timer_get_time());
         }
+      } else if (!gestures.getNextDeadline(&deadline)) {
+        interrupts->waitForChange(portMAX_DELAY); // nothing pending
+      } else {
+        int32_t remaining = (int32_t)(deadline - now);
+        TickType_t timeout = pdMS_TO_TICKS(0 < remaining ? remaining : 0);
+        interrupts->waitForChange(0 < timeout ? timeout : 1);
       }
-      vTaskDelay(SLEEP_TIME);
     }
   }
   void onInputButtonEvent(InputButtonEvent *event) {
     if (!isStarted())
       return; // no connection
     if (STATE_CHANGE == event->type) {
-      switch (event->source->getId()) {
-      case CONFIG_PIN_BUTTON_MENU:
-        if (!event->source->isHigh()) {
-          theClock->onMenuClick();
-        } else {
-          counterMenu = 0;
-        }
-        break;
-      case CONFIG_PIN_BUTTON_BACK:
-        if (!event->source->isHigh()) {
-          theClock->onBackClick();
-        } else {
-          counterBack = 0;
-        }
-        break;
-      case CONFIG_PIN_BUTTON_UP:
-        if (!event->source->isHigh()) {
-          theClock->onUpClick();
-        } else {
-          counterUp = 0;
-        }
-        break;
-      case CONFIG_PIN_BUTTON_DOWN:
-        if (!event->source->isHigh()) {
-          theClock->onDownClick();
-        } else {
-          counterDown = 0;
-        }
-        break;
+      // the buttons are active low
+      bool pressed = !event->source->isHigh();
+      if (nullptr != journal) {
+        journal->record(INPUT_JOURNAL_STATE_CHANGE, event->source->getId(),
+                        pressed);
       }
+      gestures.update(event->source->getId(), pressed, nowMs());
+    }
+  }
+};
+
+//====================================================================
+// --- degraded profiles, while on battery
+class DisplayPowerProfile : public PowerProfile {
+private:
+  DisplayUpdaterTask *display;
+
+public:
+  DisplayPowerProfile(DisplayUpdaterTask *display) : display(display) {}
+  virtual ~DisplayPowerProfile() {}
+  void onDegraded() { display->setLowPower(true); }
+  void onNominal() { display->setLowPower(false); }
+};
+
+class ButtonsPowerProfile : public PowerProfile {
+private:
+  ButtonWatcherTask *watcher;
+
+public:
+  ButtonsPowerProfile(ButtonWatcherTask *watcher) : watcher(watcher) {}
+  virtual ~ButtonsPowerProfile() {}
+  void onDegraded() {
+    watcher->setPollPeriod(ButtonWatcherTask::POLL_PERIOD_LOW_POWER_MS);
+  }
+  void onNominal() {
+    watcher->setPollPeriod(ButtonWatcherTask::POLL_PERIOD_NOMINAL_MS);
+  }
+};
+
+/**
+ * @brief Suspend the wifi, thus the time synchronization, and resume both with
+ * the mains power.
+ */
+class WifiPowerProfile : public PowerProfile {
+private:
+  WifiStationEsp32 *station;
+  TimerServiceEsp32 *service;
+  /**
+   * @brief The wake up job of the connect on demand mode, if any.
+   */
+  WifiWakeUpJob *wakeUpJob;
+  uint32_t wakeUpPeriodMs;
+
+public:
+  WifiPowerProfile(WifiStationEsp32 *station, TimerServiceEsp32 *service,
+                   WifiWakeUpJob *wakeUpJob, uint32_t wakeUpPeriodMs)
+      : station(station), service(service), wakeUpJob(wakeUpJob),
+        wakeUpPeriodMs(wakeUpPeriodMs) {}
+  virtual ~WifiPowerProfile() {}
+  void onDegraded() {
+    if (nullptr != wakeUpJob) {
+      service->cancel(wakeUpJob);
+    }
+    station->suspend(); // gives up any connection or reconnection too
+  }
+  void onNominal() {
+    station->resume(); // and synchronize the time
+    if (nullptr != wakeUpJob) {
+      service->schedule(wakeUpJob, wakeUpPeriodMs, wakeUpPeriodMs);
+    }
+  }
+};
+
+#ifdef CONFIG_ROTARY_ENCODER
+//====================================================================
+// Rotary encoder : the rotations as 'up' and 'down' clicks
+class RotaryEncoderJob : public TimerJob {
+private:
+  // counts per detent ; slow and fast speeds (detents per second) ; max steps
+  // per detent
+  static constexpr RotaryProfile PROFILE = {CONFIG_ROTARY_COUNTS_PER_DETENT, 8,
+                                            40, 10};
+  RotaryEncoderPcntEsp32 *encoder;
+  RotaryAccelerator accelerator = RotaryAccelerator(&PROFILE);
+  ButtonCommandDispatcher *dispatcher;
+
+public:
+  static const uint32_t PERIOD_MS = 20;
+  RotaryEncoderJob(RotaryEncoderPcntEsp32 *encoder,
+                   ButtonCommandDispatcher *dispatcher)
+      : encoder(encoder), dispatcher(dispatcher) {}
+  virtual ~RotaryEncoderJob() {}
+  void onTimer(uint64_t now) {
+    dispatcher->onRotation(
+        accelerator.update(encoder->getCount(), PERIOD_MS));
+  }
+};
+#endif
+
+class PowerStateJob : public TimerJob {
+private:
+  PowerStateManager *manager;
+
+public:
+  PowerStateJob(PowerStateManager *manager) : manager(manager) {}
+  virtual ~PowerStateJob() {}
+  void onTimer(uint64_t now) {
+    if (manager->update()) {
+      ESP_LOGI(TAG, "Now on %s.",
+               manager->isOnBattery() ? "battery" : "mains power");
     }
   }
 };
@@ -619,8 +1489,15 @@ public:
 // global instances
 // -- tasks and gpios
 GeneralPurposeInputOutput *gpio;
-Task *ledUpdater;
+TimerServiceEsp32 *timerService;
+LedUpdaterJob *ledUpdater;
+PowerReportJob *powerReport;
+HeapReportJob *heapReport = nullptr;
+TaskMonitorEsp32 *taskMonitor = nullptr;
+JitterMonitorEsp32 *jitter;
+WifiReconnectStormJob *wifiReconnectStorm = nullptr;
 ButtonWatcherTask *buttonWatcher;
+InputJournal *inputJournal = nullptr;
 InputButton *button;
 FeedbackLed *mainLed;
 DisplayUpdaterTask *displayUpdater;
@@ -628,58 +1505,135 @@ TheClockTask *theClock;
 
 // -- wifi
 WifiStationEsp32 *wifiStation;
+WifiWakeUpJob *wifiWakeUp = nullptr;
 LoggerHostConfigurationEventListener *listener;
+#ifdef CONFIG_SNTP_CLIENT_MODE_BROADCAST
+NetworkTimeKeeperBroadcastEsp32 *networkTimeKeeper;
+#else
 NetworkTimeKeeperEsp32 *networkTimeKeeper;
+#endif
+SntpServerEsp32 *sntpServer = nullptr;
+PhaseSyncTaskEsp32 *phaseSync = nullptr;
+
+// -- power supply
+PowerStateManager *powerState = nullptr;
+PowerStateJob *powerStateJob = nullptr;
+
+#ifdef CONFIG_ROTARY_ENCODER
+// -- rotary encoder
+RotaryEncoderJob *rotaryEncoder = nullptr;
+#endif
+
+// -- boot
+BootProfiler bootProfiler(esp_timer_get_time);
+BootSequencer bootSequence;
+BootSequencerEsp32 bootSequencer(&bootSequence);
+
+// -- alarms
+HolidayCalendar *holidays;
+AlarmScheduler *alarmScheduler;
+AlarmTaskEsp32 *alarmTask;
 
 // TODO : support configurable button inversion !
-InputButton *createButton(uint64_t gpioId) {
-  return (new InputButton(gpioId)) //
-      ->withDebouncer(DEBOUNCER_TYPICAL);
+InputButton *debounced(InputButton *button) {
+#if defined(CONFIG_BUTTONS_INTERRUPTS) || defined(CONFIG_BUTTONS_POLLING_BATCH)
+  return button; // debounced by the reader
+#else
+  return button->withDebouncer(DEBOUNCER_TYPICAL);
+#endif
 }
 
-void app_main(void) {
-  // setup
-  // -- NVS
-  esp_err_t err = nvs_flash_init();
-  if (err == ESP_ERR_NVS_NO_FREE_PAGES ||
-      err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
-    // NVS partition was truncated and needs to be erased
-    // Retry nvs_flash_init
-    ESP_ERROR_CHECK(nvs_flash_erase());
-    err = nvs_flash_init();
-  }
-  ESP_ERROR_CHECK(err);
+// ========[ Boot stages ]========
+// run by the boot sequencer, the lane 1 (display, buttons, clock, alarms)
+// overlapping the lane 0 (nvs, wifi).
+
+/**
+ * @brief Power management, gpio, status led, timer service and input
+ * journal, used by all the other stages.
+ */
+void bootCore() {
+  // -- power
+#ifdef CONFIG_PM_ENABLE
+#ifdef CONFIG_POWER_LIGHT_SLEEP
+  PowerManagerEsp32::configure(CONFIG_POWER_MAX_FREQ_MHZ,
+                               CONFIG_POWER_MIN_FREQ_MHZ, true);
+#else
+  PowerManagerEsp32::configure(CONFIG_POWER_MAX_FREQ_MHZ,
+                               CONFIG_POWER_MIN_FREQ_MHZ, false);
+#endif
+#endif
 
   // -- I/O peripherals
-  gpio = (new GeneralPurposeInputOutput())
-             ->withDigital(new DigitalInputOutputEsp32());
+  gpio = (ALLOCATE(GeneralPurposeInputOutput)())
+             ->withDigital(ALLOCATE(DigitalInputOutputEsp32)());
   gpio->getDigital()->setup(CONFIG_PIN_STATUS_MAIN, WRITE);
   gpio->getDigital()->setup(CONFIG_PIN_BUTTON_MENU, READ);
 
+  bootProfiler.mark("gpio");
+
   // -- animated led
-  mainLed = new FeedbackLed();
+  mainLed = ALLOCATE(FeedbackLed)();
   mainLed->setFeedbackSequenceAndLoop(BLINK_ONCE);
 
   // Tasks
+  // -- periodic jobs
+  timerService = ALLOCATE(TimerServiceEsp32)();
+  jitter = ALLOCATE(JitterMonitorEsp32)();
+  timerService->withJitterProbe(
+      jitter->createProbe("timer-service", JITTER_DEADLINE_TIMER_SERVICE_US));
+  APPLY_TASK_POLICY(timerService, TIMER_SERVICE);
+  timerService->start();
+
   // -- LED
-  ledUpdater = (new LedUpdaterTask()) //
-                   ->withGpio(gpio)   //
+  ledUpdater = (ALLOCATE(LedUpdaterJob)()) //
+                   ->withGpio(gpio)        //
                    ->withLed(mainLed);
-  ledUpdater->start();
+  timerService->schedule(ledUpdater, 0, LedUpdaterJob::PERIOD_MS);
+
+#if defined(CONFIG_POWER_REPORT_PERIOD_S) && CONFIG_POWER_REPORT_PERIOD_S > 0
+  // -- power usage report
+  powerReport = ALLOCATE(PowerReportJob)();
+  timerService->schedule(powerReport, CONFIG_POWER_REPORT_PERIOD_S * 1000,
+                         CONFIG_POWER_REPORT_PERIOD_S * 1000);
+#endif
+#if defined(CONFIG_HEAP_REPORT_PERIOD_S) && CONFIG_HEAP_REPORT_PERIOD_S > 0
+  // -- heap usage report
+  heapReport = ALLOCATE(HeapReportJob)();
+  heapReport->withTask(timerService);
+#endif
+
+#ifdef CONFIG_INPUT_JOURNAL
+  // -- journal of the inputs and of the display
+  inputJournal = ALLOCATE(InputJournal)(esp_timer_get_time);
+#endif
+}
 
-  // -- Buttons
-  buttonWatcher = (new ButtonWatcherTask())                                  //
-                      ->withGpio(gpio)                                       //
-                      ->withLed(mainLed)                                     //
-                      ->withButtonMenu(createButton(CONFIG_PIN_BUTTON_MENU)) //
-                      ->withButtonBack(createButton(CONFIG_PIN_BUTTON_BACK)) //
-                      ->withButtonUp(createButton(CONFIG_PIN_BUTTON_UP))     //
-                      ->withButtonDown(createButton(CONFIG_PIN_BUTTON_DOWN)) //
-      ;
-  buttonWatcher->start();
+/**
+ * @brief Non volatile storage, for the wifi credentials and the alarms.
+ */
+void bootNvs() {
+  // -- NVS
+  esp_err_t err = nvs_flash_init();
+  if (err == ESP_ERR_NVS_NO_FREE_PAGES ||
+      err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+    // NVS partition was truncated and needs to be erased
+    // Retry nvs_flash_init
+    ESP_ERROR_CHECK(nvs_flash_erase());
+    err = nvs_flash_init();
+  }
+  ESP_ERROR_CHECK(err);
+}
 
+/**
+ * @brief Seven segment display, the first frame is shown as soon as it runs.
+ */
+void bootDisplay() {
   // -- Seven segment display
-  displayUpdater = new DisplayUpdaterTask();
+  displayUpdater = ALLOCATE(DisplayUpdaterTask)();
+  displayUpdater->setJitterProbe(
+      jitter->createProbe("display", JITTER_DEADLINE_DISPLAY_US));
+  displayUpdater->setJournal(inputJournal);
+  displayUpdater->setBootProfiler(&bootProfiler);
 
   // -- -- i2c #1
   int i2c_master_port = 0;
@@ -699,18 +1653,277 @@ void app_main(void) {
   };
 
   displayUpdater->setupIic(i2c_master_port, &conf);
+  bootProfiler.mark("iic");
+  APPLY_TASK_POLICY(displayUpdater, DISPLAY);
   displayUpdater->start();
+}
+
+/**
+ * @brief Buttons.
+ */
+void bootButtons() {
+  // -- Buttons
+  buttonWatcher =
+      (ALLOCATE(ButtonWatcherTask)()) //
+          ->withGpio(gpio)            //
+          ->withLed(mainLed)          //
+          ->withButtonMenu(
+              debounced(ALLOCATE(InputButton)(CONFIG_PIN_BUTTON_MENU))) //
+          ->withButtonBack(
+              debounced(ALLOCATE(InputButton)(CONFIG_PIN_BUTTON_BACK))) //
+          ->withButtonUp(
+              debounced(ALLOCATE(InputButton)(CONFIG_PIN_BUTTON_UP))) //
+          ->withButtonDown(
+              debounced(ALLOCATE(InputButton)(CONFIG_PIN_BUTTON_DOWN))) //
+      ;
+#ifdef CONFIG_BUTTONS_INTERRUPTS
+  buttonWatcher->withInterrupts(
+      ALLOCATE(ButtonInterruptsEsp32)(CONFIG_BUTTONS_SETTLE_MS));
+#elif defined(CONFIG_BUTTONS_POLLING_BATCH)
+  buttonWatcher->withBatchReader(ALLOCATE(ButtonBatchReaderEsp32)());
+#endif
+#ifdef CONFIG_INPUT_JOURNAL
+  buttonWatcher->withJournal(inputJournal);
+#endif
+  APPLY_TASK_POLICY(buttonWatcher, BUTTONS);
+  buttonWatcher->setJitterProbe(
+      jitter->createProbe("buttons", JITTER_DEADLINE_BUTTONS_US));
+  buttonWatcher->start();
+}
 
+/**
+ * @brief The clock, after the display, the buttons and the nvs (the timezone).
+ */
+void bootClock() {
   // -- The clock
-  theClock = (new TheClockTask())->withDisplay(displayUpdater);
+  theClock = (ALLOCATE(TheClockTask)())->withDisplay(displayUpdater);
+  theClock->withInputJournal(inputJournal);
+  theClock->withBootProfiler(&bootProfiler);
+  theClock->withJitterProbe(
+      jitter->createProbe("the-clock", JITTER_DEADLINE_CLOCK_US));
+  APPLY_TASK_POLICY(theClock, CLOCK);
   theClock->start();
-  buttonWatcher->withTheClock(theClock);
+  buttonWatcher->withTheClock(theClock->getCommandPoster());
+
+#ifdef CONFIG_ROTARY_ENCODER
+  // -- rotary encoder
+  RotaryEncoderPcntEsp32 *encoder = ALLOCATE(RotaryEncoderPcntEsp32)(
+      gpio_num_t(CONFIG_PIN_ROTARY_A), gpio_num_t(CONFIG_PIN_ROTARY_B));
+  if (encoder->start()) {
+    rotaryEncoder =
+        ALLOCATE(RotaryEncoderJob)(encoder, buttonWatcher->getDispatcher());
+    timerService->schedule(rotaryEncoder, 0, RotaryEncoderJob::PERIOD_MS);
+  }
+#endif
+}
 
+/**
+ * @brief Wifi station and network services, after the nvs and the display (the
+ * timeline of the phase sync).
+ */
+void bootWifi() {
   // -- wifi
-  listener = new LoggerHostConfigurationEventListener();
-  networkTimeKeeper = new NetworkTimeKeeperEsp32(CONFIG_SNTP_TIME_SERVER);
-  wifiStation = WifiHelperEsp32::setupAndRunStation(NAME_STORAGE_WIFI, listener,
-                                                    networkTimeKeeper);
+  listener = ALLOCATE(LoggerHostConfigurationEventListener)();
+#ifdef CONFIG_SNTP_CLIENT_MODE_BROADCAST
+  networkTimeKeeper = ALLOCATE(NetworkTimeKeeperBroadcastEsp32)(
+      CONFIG_SNTP_BROADCAST_MULTICAST_GROUP);
+  APPLY_TASK_POLICY(networkTimeKeeper, NETWORK);
+#else
+  networkTimeKeeper = ALLOCATE(NetworkTimeKeeperEsp32)(CONFIG_SNTP_TIME_SERVER);
+#endif
+#ifdef CONFIG_SNTP_SERVER_ENABLE
+  sntpServer = ALLOCATE(SntpServerEsp32)(
+      networkTimeKeeper, CONFIG_SNTP_SERVER_UPSTREAM_STRATUM,
+      CONFIG_SNTP_SERVER_MAX_REPLIES_PER_SECOND,
+      CONFIG_SNTP_SERVER_CLIENT_MIN_INTERVAL_MS);
+  APPLY_TASK_POLICY(sntpServer, NETWORK);
+#endif
+#if defined(CONFIG_PHASE_SYNC_ROLE_LEADER)
+  phaseSync = ALLOCATE(PhaseSyncTaskEsp32)(
+      displayUpdater->getTimeline(), PHASE_SYNC_LEADER, CONFIG_PHASE_SYNC_PORT,
+      CONFIG_PHASE_SYNC_BEACON_INTERVAL_MS, 0);
+#elif defined(CONFIG_PHASE_SYNC_ROLE_FOLLOWER)
+  phaseSync = ALLOCATE(PhaseSyncTaskEsp32)(
+      displayUpdater->getTimeline(), PHASE_SYNC_FOLLOWER,
+      CONFIG_PHASE_SYNC_PORT, CONFIG_PHASE_SYNC_BEACON_INTERVAL_MS,
+      CONFIG_PHASE_SYNC_TRANSIT_COMPENSATION_US);
+#endif
+#if defined(CONFIG_PHASE_SYNC_ROLE_LEADER) ||                                  \
+    defined(CONFIG_PHASE_SYNC_ROLE_FOLLOWER)
+  APPLY_TASK_POLICY(phaseSync, NETWORK);
+#endif
+  WifiStationEsp32 *station =
+      ALLOCATE(WifiStationEsp32)()->withBootProfiler(&bootProfiler);
+#ifdef CONFIG_WIFI_SCAN_FIRST
+  station->withScanFirst(true, CONFIG_WIFI_SCAN_MIN_RSSI);
+#endif
+#ifdef CONFIG_WIFI_RECONNECT
+  station->withAutoReconnect(true, CONFIG_WIFI_RECONNECT_INITIAL_DELAY_MS,
+                             CONFIG_WIFI_RECONNECT_MAX_DELAY_MS,
+                             CONFIG_WIFI_RECONNECT_JITTER_PERCENT,
+                             CONFIG_WIFI_RECONNECT_WPS_EVERY);
+#endif
+  wifiStation = WifiHelperEsp32::setupAndRunStation(
+      station, ALLOCATE(WifiCredentialsRegistryDaoUsingNvs)(),
+      NAME_STORAGE_WIFI, listener, networkTimeKeeper, sntpServer, phaseSync);
+}
+
+/**
+ * @brief Connect the clock to the network time, after the clock and the wifi.
+ */
+void bootNetworkClock() {
+  // -- the clock, over the network
   theClock->withWifiStation(wifiStation);
+#ifndef CONFIG_SNTP_CLIENT_MODE_BROADCAST
+  theClock->withNetworkTimeKeeper(networkTimeKeeper);
+#endif
+#ifdef CONFIG_WIFI_ON_DEMAND
+  wifiStation->withOnDemand(true);
+  wifiWakeUp = ALLOCATE(WifiWakeUpJob)(wifiStation);
+  timerService->schedule(wifiWakeUp, CONFIG_WIFI_ON_DEMAND_PERIOD_MIN * 60000,
+                         CONFIG_WIFI_ON_DEMAND_PERIOD_MIN * 60000);
+#endif
+}
+
+#if defined(CONFIG_POWER_SUPPLY_PROBE_GPIO) ||                                 \
+    defined(CONFIG_POWER_SUPPLY_PROBE_ADC)
+/**
+ * @brief Power supply probe, switching the profiles of the display, buttons and
+ * wifi.
+ */
+void bootPowerSupply() {
+  // -- power supply
+  powerState =
+      (ALLOCATE(PowerStateManager)())
+#if defined(CONFIG_POWER_SUPPLY_PROBE_GPIO)
+          ->withProbe(ALLOCATE(PowerSupplyProbeUsingGpioEsp32)(
+              gpio_num_t(CONFIG_POWER_SUPPLY_PIN),
+              CONFIG_POWER_SUPPLY_MAINS_LEVEL))
+#else
+          ->withProbe(ALLOCATE(PowerSupplyProbeUsingAdcEsp32)(
+              adc_channel_t(CONFIG_POWER_SUPPLY_ADC_CHANNEL),
+              CONFIG_POWER_SUPPLY_THRESHOLD_MV,
+              CONFIG_POWER_SUPPLY_HYSTERESIS_MV))
+#endif
+          ->withConfirmations(CONFIG_POWER_SUPPLY_CONFIRMATIONS)
+          ->withProfile(ALLOCATE(DisplayPowerProfile)(displayUpdater))
+          ->withProfile(ALLOCATE(ButtonsPowerProfile)(buttonWatcher))
+#ifdef CONFIG_WIFI_ON_DEMAND
+          ->withProfile(ALLOCATE(WifiPowerProfile)(
+              wifiStation, timerService, wifiWakeUp,
+              CONFIG_WIFI_ON_DEMAND_PERIOD_MIN * 60000));
+#else
+          ->withProfile(ALLOCATE(WifiPowerProfile)(wifiStation, timerService,
+                                                   nullptr, 0));
+#endif
+  powerStateJob = ALLOCATE(PowerStateJob)(powerState);
+  timerService->schedule(powerStateJob, 0, CONFIG_POWER_SUPPLY_POLL_PERIOD_MS);
+}
+#endif
+
+/**
+ * @brief Alarms, after the nvs.
+ */
+void bootAlarms() {
+  // -- alarms
+  holidays = ALLOCATE(HolidayCalendar)();
+  alarmScheduler = (ALLOCATE(AlarmScheduler)())
+                       ->withHolidayCalendar(holidays)
+                       ->withListener(ALLOCATE(LoggerAlarmListener)());
+  alarmTask = ALLOCATE(AlarmTaskEsp32)(
+      alarmScheduler, (ALLOCATE(AlarmRegistryDaoUsingNvs)())
+                          ->withDesignator(NAME_STORAGE_ALARMS));
+  APPLY_TASK_POLICY(alarmTask, ALARMS);
+  alarmTask->start();
+}
+
+void app_main(void) {
+  // setup
+  bootProfiler.mark("app-main"); // after the boot loader
+  size_t freeHeapAtStart = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+
+  bootSequence.withProfiler(&bootProfiler);
+  int8_t coreStage = bootSequence.addStage("core", bootCore, 0);
+  int8_t displayStage = bootSequence.addStage(
+      "display", bootDisplay, 1, BootSequencer::maskOf(coreStage));
+  int8_t nvsStage = bootSequence.addStage("nvs", bootNvs, 0);
+  int8_t buttonsStage = bootSequence.addStage(
+      "buttons", bootButtons, 1, BootSequencer::maskOf(coreStage));
+  int8_t clockStage = bootSequence.addStage(
+      "clock", bootClock, 1,
+      BootSequencer::maskOf(displayStage) |
+          BootSequencer::maskOf(buttonsStage) |
+          BootSequencer::maskOf(nvsStage));
+  int8_t wifiStage = bootSequence.addStage(
+      "wifi", bootWifi, 0,
+      BootSequencer::maskOf(nvsStage) | BootSequencer::maskOf(displayStage));
+  [[maybe_unused]] int8_t networkClockStage = bootSequence.addStage(
+      "network-clock", bootNetworkClock, 0,
+      BootSequencer::maskOf(clockStage) | BootSequencer::maskOf(wifiStage));
+#if defined(CONFIG_POWER_SUPPLY_PROBE_GPIO) ||                                 \
+    defined(CONFIG_POWER_SUPPLY_PROBE_ADC)
+  bootSequence.addStage("power-supply", bootPowerSupply, 0,
+                        BootSequencer::maskOf(networkClockStage));
+#endif
+  bootSequence.addStage("alarms", bootAlarms, 1,
+                        BootSequencer::maskOf(coreStage) |
+                            BootSequencer::maskOf(nvsStage));
+#ifdef CONFIG_BOOT_PARALLEL
+  bootSequencer.run(true);
+#else
+  bootSequencer.run(false);
+#endif
+
+  bootProfiler.mark("setup");
+
+  // -- memory used by the setup
+  size_t freeHeapAfterSetup = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  ESP_LOGI(TAG, "setup : %ld bytes of heap used, %lu free",
+           (long)freeHeapAtStart - (long)freeHeapAfterSetup,
+           (unsigned long)freeHeapAfterSetup);
+#if defined(CONFIG_HEAP_REPORT_PERIOD_S) && CONFIG_HEAP_REPORT_PERIOD_S > 0
+  heapReport->withTask(buttonWatcher)
+      ->withTask(displayUpdater)
+      ->withTask(theClock)
+      ->withTask(alarmTask);
+#ifdef CONFIG_SNTP_CLIENT_MODE_BROADCAST
+  heapReport->withTask(networkTimeKeeper);
+#endif
+  heapReport->withTask(sntpServer)->withTask(phaseSync);
+  heapReport->markEndOfSetup();
+  timerService->schedule(heapReport, CONFIG_HEAP_REPORT_PERIOD_S * 1000,
+                         CONFIG_HEAP_REPORT_PERIOD_S * 1000);
+#endif
+
+  // -- task usage report
+#if defined(CONFIG_TASK_MONITOR_PERIOD_S) && CONFIG_TASK_MONITOR_PERIOD_S > 0
+  taskMonitor = ALLOCATE(TaskMonitorEsp32)(CONFIG_TASK_MONITOR_STACK_WARNING);
+  taskMonitor->withTask(timerService)
+      ->withTask(buttonWatcher)
+      ->withTask(displayUpdater)
+      ->withTask(theClock)
+      ->withTask(alarmTask);
+#ifdef CONFIG_SNTP_CLIENT_MODE_BROADCAST
+  taskMonitor->withTask(networkTimeKeeper);
+#endif
+  taskMonitor->withTask(sntpServer)->withTask(phaseSync);
+  timerService->schedule(taskMonitor, CONFIG_TASK_MONITOR_PERIOD_S * 1000,
+                         CONFIG_TASK_MONITOR_PERIOD_S * 1000);
+#endif
+
+  // -- jitter report
+#if defined(CONFIG_JITTER_REPORT_PERIOD_S) && CONFIG_JITTER_REPORT_PERIOD_S > 0
+  timerService->schedule(jitter, CONFIG_JITTER_REPORT_PERIOD_S * 1000,
+                         CONFIG_JITTER_REPORT_PERIOD_S * 1000);
+#endif
+
+#if defined(CONFIG_TASK_STRESS_WIFI_RECONNECT_PERIOD_S) &&                     \
+    CONFIG_TASK_STRESS_WIFI_RECONNECT_PERIOD_S > 0
+  // -- stress test
+  wifiReconnectStorm = ALLOCATE(WifiReconnectStormJob)(wifiStation, jitter);
+  timerService->schedule(wifiReconnectStorm,
+                         CONFIG_TASK_STRESS_WIFI_RECONNECT_PERIOD_S * 1000,
+                         CONFIG_TASK_STRESS_WIFI_RECONNECT_PERIOD_S * 1000);
+#endif
   // and voila
 }
\ No newline at end of file
@@ -0,0 +1,238 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Alarm Simplist'.
+// ---
+// 'Alarm Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Alarm Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Alarm Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "AlarmSimplist.hpp"
+#include <cstdlib>
+#include <unity.h>
+#include <vector>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {
+  setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1); // Europe/Paris
+  tzset();
+}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+typedef struct {
+  uint8_t index;
+  bool snoozed;
+  time_t at;
+} FiredAlarm;
+
+class RecordingAlarmListener : public AlarmListener {
+public:
+  time_t now;
+  std::vector<FiredAlarm> fired;
+  virtual void onAlarm(uint8_t index, AlarmRule *, bool snoozed) {
+    fired.push_back({.index = index, .snoozed = snoozed, .at = now});
+  }
+  uint32_t countOf(uint8_t index) {
+    uint32_t count = 0;
+    for (FiredAlarm &alarm : fired) {
+      count += index == alarm.index ? 1 : 0;
+    }
+    return count;
+  }
+};
+
+time_t localTime(int year, int month, int day, int hour, int minute) {
+  struct tm date = {};
+  date.tm_year = year - 1900;
+  date.tm_mon = month - 1;
+  date.tm_mday = day;
+  date.tm_hour = hour;
+  date.tm_min = minute;
+  date.tm_isdst = -1;
+  return mktime(&date);
+}
+
+void test_shouldPackAndUnpackRules() {
+  // Prepare
+  AlarmRule rule;
+  rule.recurring(23, 59, ALARM_WEEKEND)
+      ->withSkipHolidays(true)
+      ->withSnoozeMinutes(15);
+  AlarmRule oneShot;
+  oneShot.oneShot(2030, 12, 31, 6, 5)->withSnoozeMinutes(200);
+
+  // Execute
+  AlarmRuleRecord record;
+  AlarmRuleRecord oneShotRecord;
+  rule.pack(&record);
+  oneShot.pack(&oneShotRecord);
+  AlarmRule result;
+  AlarmRule oneShotResult;
+  result.unpack(&record);
+  oneShotResult.unpack(&oneShotRecord);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(8, sizeof(AlarmRuleRecord));
+  TEST_ASSERT_EQUAL_UINT8(23, result.getHour());
+  TEST_ASSERT_EQUAL_UINT8(59, result.getMinute());
+  TEST_ASSERT_EQUAL_UINT8(ALARM_WEEKEND, result.getWeekdays());
+  TEST_ASSERT_TRUE(result.isEnabled());
+  TEST_ASSERT_TRUE(result.isSkipHolidays());
+  TEST_ASSERT_EQUAL_UINT8(15, result.getSnoozeMinutes());
+  TEST_ASSERT_FALSE(result.isOneShot());
+  TEST_ASSERT_TRUE(oneShotResult.isOneShot());
+  TEST_ASSERT_FALSE(oneShotResult.isSkipHolidays());
+  TEST_ASSERT_EQUAL_UINT8(ALARM_MAX_SNOOZE_MINUTES,
+                          oneShotResult.getSnoozeMinutes());
+  TEST_ASSERT_EQUAL(localTime(2030, 12, 31, 6, 5),
+                    oneShotResult.getNextFireTime(
+                        localTime(2030, 1, 1, 0, 0), nullptr));
+}
+
+void test_shouldConvertDayNumbers() {
+  // Prepare
+  struct tm date = {};
+
+  // Execute & Verify
+  TEST_ASSERT_EQUAL_INT32(0, CivilDate::toDayNumber(2000, 1, 1));
+  TEST_ASSERT_EQUAL_INT32(60, CivilDate::toDayNumber(2000, 3, 1));
+  TEST_ASSERT_EQUAL_INT32(8485, CivilDate::toDayNumber(2023, 3, 26));
+  for (int32_t dayNumber = -1000; dayNumber < 40000; dayNumber++) {
+    CivilDate::fromDayNumber(dayNumber, &date);
+    TEST_ASSERT_EQUAL_INT32(dayNumber, CivilDate::toDayNumber(&date));
+  }
+}
+
+void test_shouldFireAlongAWholeYear() {
+  // Prepare
+  HolidayCalendar holidays;
+  holidays.withYearly(1, 1)
+      ->withYearly(5, 1)
+      ->withYearly(7, 14)
+      ->withYearly(12, 25)
+      ->withDate(2023, 4, 10);
+  RecordingAlarmListener listener;
+  AlarmScheduler scheduler;
+  scheduler.withHolidayCalendar(&holidays)->withListener(&listener);
+  time_t now = localTime(2023, 1, 1, 0, 0);
+  time_t end = localTime(2024, 1, 1, 0, 0);
+  AlarmRule rule;
+  scheduler.setRule(0, rule.recurring(7, 0, ALARM_WORKING_DAYS)
+                           ->withSkipHolidays(true),
+                    now);
+  scheduler.setRule(1, rule.recurring(2, 30, ALARM_EVERY_DAY)
+                           ->withSkipHolidays(false),
+                    now);
+  scheduler.setRule(2, rule.oneShot(2023, 7, 14, 10, 15), now);
+  scheduler.setRule(3, rule.recurring(8, 0, ALARM_EVERY_DAY)
+                           ->withEnabled(false),
+                    now);
+
+  // Execute : jump from an alarm to the next one, as the firmware sleeps
+  uint32_t wakeUps = 0;
+  while (scheduler.getNextFireTime() < end) {
+    now = scheduler.getNextFireTime();
+    listener.now = now;
+    ++wakeUps;
+    TEST_ASSERT_GREATER_THAN(0, scheduler.fireDue(now));
+  }
+
+  // Verify
+  // 260 working days in 2023, minus 4 holidays on a working day
+  TEST_ASSERT_EQUAL_UINT32(256, listener.countOf(0));
+  TEST_ASSERT_EQUAL_UINT32(365, listener.countOf(1));
+  TEST_ASSERT_EQUAL_UINT32(1, listener.countOf(2));
+  TEST_ASSERT_EQUAL_UINT32(0, listener.countOf(3));
+  TEST_ASSERT_EQUAL_UINT32(listener.fired.size(), wakeUps);
+  for (FiredAlarm &alarm : listener.fired) {
+    struct tm date;
+    localtime_r(&alarm.at, &date);
+    if (0 == alarm.index) {
+      TEST_ASSERT_EQUAL_INT(7, date.tm_hour);
+      TEST_ASSERT_EQUAL_INT(0, date.tm_min);
+      TEST_ASSERT_TRUE(date.tm_wday >= 1 && date.tm_wday <= 5);
+      TEST_ASSERT_FALSE(holidays.isHoliday(&date));
+    } else if (1 == alarm.index) {
+      // 2:30 does not exist when springing forward
+      bool springForward = 2 == date.tm_mon && 26 == date.tm_mday;
+      TEST_ASSERT_EQUAL_INT(springForward ? 3 : 2, date.tm_hour);
+      TEST_ASSERT_EQUAL_INT(30, date.tm_min);
+    }
+  }
+  TEST_ASSERT_FALSE(scheduler.getRule(2)->isEnabled());
+  TEST_ASSERT_TRUE(scheduler.isDirty());
+}
+
+void test_shouldSnoozeAndDismiss() {
+  // Prepare
+  RecordingAlarmListener listener;
+  AlarmScheduler scheduler;
+  scheduler.withListener(&listener);
+  time_t now = localTime(2023, 6, 1, 6, 0);
+  AlarmRule rule;
+  scheduler.setRule(5, rule.recurring(7, 0, ALARM_EVERY_DAY)
+                           ->withSnoozeMinutes(10),
+                    now);
+  now = scheduler.getNextFireTime();
+  scheduler.fireDue(now);
+
+  // Execute
+  scheduler.snooze(5, now + 30);
+
+  // Verify
+  TEST_ASSERT_EQUAL(now + 30 + 600, scheduler.getNextFireTime());
+  listener.now = scheduler.getNextFireTime();
+  TEST_ASSERT_EQUAL_UINT8(1, scheduler.fireDue(scheduler.getNextFireTime()));
+  TEST_ASSERT_TRUE(listener.fired.back().snoozed);
+
+  // Execute : snooze again, then dismiss
+  scheduler.snooze(5, listener.now + 5);
+  scheduler.dismiss(5, listener.now + 10);
+
+  // Verify
+  TEST_ASSERT_EQUAL(localTime(2023, 6, 2, 7, 0), scheduler.getNextFireTime());
+}
+
+void test_shouldRescheduleWhenTheTimeZoneChanges() {
+  // Prepare
+  AlarmScheduler scheduler;
+  time_t now = localTime(2023, 6, 1, 6, 0);
+  AlarmRule rule;
+  scheduler.setRule(0, rule.recurring(7, 0, ALARM_EVERY_DAY), now);
+
+  // Execute
+  setenv("TZ", "EST5EDT,M3.2.0,M11.1.0", 1);
+  tzset();
+  scheduler.reschedule(now);
+
+  // Verify
+  time_t next = scheduler.getNextFireTime();
+  struct tm date;
+  localtime_r(&next, &date);
+  TEST_ASSERT_EQUAL_INT(7, date.tm_hour);
+  TEST_ASSERT_EQUAL_INT(0, date.tm_min);
+  TEST_ASSERT_EQUAL_INT(1, date.tm_mday); // it is 0:00 there
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldPackAndUnpackRules);
+  RUN_TEST(test_shouldConvertDayNumbers);
+  RUN_TEST(test_shouldFireAlongAWholeYear);
+  RUN_TEST(test_shouldSnoozeAndDismiss);
+  RUN_TEST(test_shouldRescheduleWhenTheTimeZoneChanges);
+  UNITY_END();
+}
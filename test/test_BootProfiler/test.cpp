@@ -0,0 +1,164 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Boot Simplist'.
+// ---
+// 'Boot Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Boot Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Boot Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "AlarmSimplist.hpp"
+#include "BootSimplist.hpp"
+#include "SchedulerSimplist.hpp"
+#include "WifiSimplist.hpp"
+#include <chrono>
+#include <cstring>
+#include <unity.h>
+
+static int64_t fakeNow = 0;
+static int64_t fakeClock() { return fakeNow; }
+
+static std::chrono::steady_clock::time_point reset;
+static int64_t sinceReset() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - reset)
+      .count();
+}
+
+/**
+ * @brief Before test
+ */
+void setUp(void) { fakeNow = 0; }
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+void test_shouldKeepTheFirstMarkOfEachStage() {
+  // Prepare
+  BootProfiler profiler(fakeClock);
+
+  // Execute
+  fakeNow = 300000;
+  bool nvs = profiler.mark("nvs");
+  fakeNow = 2500000;
+  bool associated = profiler.mark("associated");
+  fakeNow = 9000000;
+  bool again = profiler.mark("associated"); // a reconnection
+
+  // Verify
+  int64_t at = 0;
+  TEST_ASSERT_TRUE(nvs);
+  TEST_ASSERT_TRUE(associated);
+  TEST_ASSERT_FALSE(again);
+  TEST_ASSERT_EQUAL_UINT8(2, profiler.getStageCount());
+  TEST_ASSERT_TRUE(profiler.isMarked("associated", &at));
+  TEST_ASSERT_EQUAL_INT64(2500000, at);
+  TEST_ASSERT_FALSE(profiler.isMarked("time"));
+}
+
+void test_shouldSummarizeOnOneLine() {
+  // Prepare
+  BootProfiler profiler(fakeClock);
+  char summary[64];
+  fakeNow = 352000;
+  profiler.mark("nvs");
+  fakeNow = 355500;
+  profiler.mark("gpio");
+
+  // Execute
+  size_t length = profiler.format(summary, sizeof(summary));
+
+  // Verify
+  TEST_ASSERT_EQUAL_STRING("nvs 352(+352) gpio 355(+3)", summary);
+  TEST_ASSERT_EQUAL_UINT32(strlen(summary), length);
+}
+
+void test_shouldTruncateTheSummaryAndRefuseTooManyStages() {
+  // Prepare
+  BootProfiler profiler(fakeClock);
+  static char names[BOOT_PROFILER_MAX_STAGES + 1][8];
+  char summary[16];
+  for (uint8_t i = 0; i < BOOT_PROFILER_MAX_STAGES; i++) {
+    snprintf(names[i], sizeof(names[i]), "s%d", i);
+    profiler.mark(names[i]);
+  }
+
+  // Execute
+  bool extra = profiler.mark("extra");
+  size_t length = profiler.format(summary, sizeof(summary));
+
+  // Verify
+  TEST_ASSERT_FALSE(extra);
+  TEST_ASSERT_EQUAL_UINT8(BOOT_PROFILER_MAX_STAGES, profiler.getStageCount());
+  TEST_ASSERT_EQUAL_UINT32(15, length);
+  TEST_ASSERT_EQUAL_UINT32(15, strlen(summary));
+}
+
+/**
+ * @brief The stages of the boot that do not need the radio nor the
+ * peripherals, with the libraries of the firmware, to catch the regressions
+ * of the boot time in native runs.
+ */
+void test_shouldBootTheNativeStagesWithinBudget() {
+  // Prepare
+  const int64_t BUDGET_US = 50000;
+  reset = std::chrono::steady_clock::now();
+  BootProfiler profiler(sinceReset);
+  uint8_t ssid[MAX_LENGTH_OF_SSID];
+  uint8_t key[MAX_LENGTH_OF_KEYPASS] = "key pass";
+
+  // Execute
+  TimerWheel *wheel = new TimerWheel();
+  profiler.mark("timer-service");
+
+  WifiCredentialsRegistry *registry = new WifiCredentialsRegistry();
+  for (uint8_t i = 0; i < registry->getCapacity(); i++) {
+    snprintf((char *)ssid, sizeof(ssid), "access point %d", i);
+    WifiCredentials credentials(ssid, key, PASSWORD);
+    registry->put(&credentials);
+  }
+  profiler.mark("wifi-registry");
+
+  HolidayCalendar holidays;
+  holidays.withYearly(1, 1)->withYearly(5, 1)->withYearly(12, 25);
+  AlarmScheduler *alarms = new AlarmScheduler();
+  alarms->withHolidayCalendar(&holidays);
+  AlarmRule rule;
+  time_t now = time(nullptr);
+  for (uint8_t i = 0; i < alarms->getCapacity(); i++) {
+    alarms->setRule(i, rule.recurring(i % 24, 0, ALARM_WORKING_DAYS), now);
+  }
+  alarms->reschedule(now);
+  profiler.mark("alarms");
+
+  // Verify
+  char summary[128];
+  profiler.format(summary, sizeof(summary));
+  printf("native boot : %s\n", summary);
+  int64_t end = 0;
+  TEST_ASSERT_TRUE(profiler.isMarked("alarms", &end));
+  TEST_ASSERT_LESS_THAN(BUDGET_US, end);
+  TEST_ASSERT_EQUAL_UINT8(3, profiler.getStageCount());
+
+  delete alarms;
+  delete registry;
+  delete wheel;
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldKeepTheFirstMarkOfEachStage);
+  RUN_TEST(test_shouldSummarizeOnOneLine);
+  RUN_TEST(test_shouldTruncateTheSummaryAndRefuseTooManyStages);
+  RUN_TEST(test_shouldBootTheNativeStagesWithinBudget);
+  UNITY_END();
+}
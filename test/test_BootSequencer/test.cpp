@@ -0,0 +1,168 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Boot Simplist'.
+// ---
+// 'Boot Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Boot Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Boot Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "BootSimplist.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <unity.h>
+
+static int64_t fakeNow = 0;
+static int64_t fakeClock() { return fakeNow; }
+
+static char trace[16];
+static std::atomic<uint8_t> traced{0};
+static void traceStage(char name) {
+  uint8_t index = traced.fetch_add(1);
+  if (index < sizeof(trace) - 1) {
+    trace[index] = name;
+  }
+}
+
+static void stageA() { traceStage('a'); }
+static void stageB() { traceStage('b'); }
+static void stageC() { traceStage('c'); }
+
+/**
+ * @brief Each lane runs in its own thread, like each core of the device.
+ */
+class ThreadLaneSync : public BootLaneSync {
+private:
+  std::mutex lock;
+  std::condition_variable changed;
+  uint32_t done = 0;
+
+public:
+  void waitFor(uint32_t stages) {
+    std::unique_lock<std::mutex> guard(lock);
+    changed.wait(guard, [this, stages] { return stages == (done & stages); });
+  }
+  void signal(uint32_t stages) {
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      done |= stages;
+    }
+    changed.notify_all();
+  }
+};
+
+// the display stage waits for the wifi stage to be running on the other lane.
+static std::atomic<bool> wifiRunning{false};
+static std::atomic<bool> overlapped{false};
+static void stageWifi() {
+  wifiRunning = true;
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  traceStage('w');
+}
+static void stageDisplay() {
+  for (int i = 0; i < 1000 && !wifiRunning; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  overlapped = wifiRunning.load();
+  traceStage('d');
+}
+static void stageClock() { traceStage('k'); }
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {
+  memset(trace, 0, sizeof(trace));
+  traced = 0;
+  wifiRunning = false;
+  overlapped = false;
+  fakeNow = 0;
+}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+void test_shouldRefuseTheDependenciesOnStagesNotYetAdded() {
+  // Prepare
+  BootSequencer sequencer;
+  int8_t a = sequencer.addStage("a", stageA, 0);
+
+  // Execute
+  int8_t ahead = sequencer.addStage("b", stageB, 0, 1UL << 1);
+  bool validBefore = sequencer.isValid();
+  int8_t noLane = sequencer.addStage("c", stageC, BOOT_SEQUENCER_MAX_LANES);
+  int8_t afterRefused = sequencer.addStage(
+      "c", stageC, 0, BootSequencer::maskOf(BOOT_SEQUENCER_NO_STAGE));
+
+  // Verify
+  TEST_ASSERT_EQUAL_INT8(0, a);
+  TEST_ASSERT_EQUAL_INT8(BOOT_SEQUENCER_NO_STAGE, ahead);
+  TEST_ASSERT_FALSE(validBefore);
+  TEST_ASSERT_EQUAL_INT8(BOOT_SEQUENCER_NO_STAGE, noLane);
+  TEST_ASSERT_EQUAL_INT8(BOOT_SEQUENCER_NO_STAGE, afterRefused);
+  TEST_ASSERT_EQUAL_UINT8(1, sequencer.getStageCount());
+}
+
+void test_shouldRunInTheOrderOfAdditionAndProfileEachStage() {
+  // Prepare
+  BootProfiler profiler(fakeClock);
+  BootSequencer sequencer;
+  sequencer.withProfiler(&profiler);
+  int8_t a = sequencer.addStage("a", stageA, 0);
+  int8_t b = sequencer.addStage("b", stageB, 1);
+  sequencer.addStage("c", stageC, 0,
+                     BootSequencer::maskOf(a) | BootSequencer::maskOf(b));
+
+  // Execute
+  sequencer.runInOrder();
+
+  // Verify
+  TEST_ASSERT_TRUE(sequencer.isValid());
+  TEST_ASSERT_EQUAL_UINT8(2, sequencer.getLaneCount());
+  TEST_ASSERT_EQUAL_UINT32(0x7, sequencer.getAllStages());
+  TEST_ASSERT_EQUAL_STRING("abc", trace);
+  TEST_ASSERT_EQUAL_UINT8(3, profiler.getStageCount());
+  TEST_ASSERT_EQUAL_STRING("c", profiler.getStage(2)->name);
+}
+
+void test_shouldOverlapTheLanesAndKeepTheDependencies() {
+  // Prepare
+  BootSequencer sequencer;
+  ThreadLaneSync sync;
+  int8_t display = sequencer.addStage("display", stageDisplay, 1);
+  int8_t wifi = sequencer.addStage("wifi", stageWifi, 0);
+  sequencer.addStage("clock", stageClock, 1,
+                     BootSequencer::maskOf(display) |
+                         BootSequencer::maskOf(wifi));
+
+  // Execute
+  std::thread other([&sequencer, &sync] { sequencer.runLane(1, &sync); });
+  sequencer.runLane(0, &sync);
+  sync.waitFor(sequencer.getAllStages());
+  other.join();
+
+  // Verify
+  TEST_ASSERT_TRUE(overlapped);
+  TEST_ASSERT_EQUAL_STRING("dwk", trace);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldRefuseTheDependenciesOnStagesNotYetAdded);
+  RUN_TEST(test_shouldRunInTheOrderOfAdditionAndProfileEachStage);
+  RUN_TEST(test_shouldOverlapTheLanesAndKeepTheDependencies);
+  UNITY_END();
+}
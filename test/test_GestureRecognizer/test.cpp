@@ -0,0 +1,220 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "InputSimplist.hpp"
+#include <string>
+#include <unity.h>
+#include <vector>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+const uint8_t MENU = 15;
+const uint8_t BACK = 18;
+const uint8_t UP = 17;
+const uint8_t DOWN = 16;
+
+// long click ; double click ; repeat delay, period, min period, acceleration
+const GestureProfile PROFILE_MENU = {2000, 300, 0, 0, 0, 0};
+const GestureProfile PROFILE_BACK = {2000, 0, 0, 0, 0, 0};
+const GestureProfile PROFILE_UP_DOWN = {0, 0, 500, 200, 50, 25};
+
+class RecordingGestureListener : public GestureListener {
+public:
+  std::vector<Gesture> gestures;
+  std::vector<uint32_t> times;
+  uint32_t now = 0;
+  virtual void onGesture(Gesture *gesture) {
+    gestures.push_back(*gesture);
+    times.push_back(now);
+  }
+};
+
+/**
+ * @brief Feed the changes and tick every millisecond, like the task would.
+ */
+class Driver {
+public:
+  GestureRecognizer recognizer;
+  RecordingGestureListener listener;
+  Driver() {
+    recognizer.withButton(MENU, &PROFILE_MENU)
+        ->withButton(BACK, &PROFILE_BACK)
+        ->withButton(UP, &PROFILE_UP_DOWN)
+        ->withButton(DOWN, &PROFILE_UP_DOWN)
+        ->withChord(MENU, BACK)
+        ->withListener(&listener);
+  }
+  void runUntil(uint32_t until) {
+    while (listener.now < until) {
+      ++listener.now;
+      recognizer.tick(listener.now);
+    }
+  }
+  void press(uint8_t id) { recognizer.update(id, true, listener.now); }
+  void release(uint8_t id) { recognizer.update(id, false, listener.now); }
+};
+
+void test_shouldClickOnPressWhenNothingElseToTellApart() {
+  // Prepare
+  Driver test;
+
+  // Execute
+  test.runUntil(100);
+  test.press(UP);
+  test.runUntil(150);
+  test.release(UP);
+  test.runUntil(2000);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(1, test.listener.gestures.size());
+  TEST_ASSERT_EQUAL(GESTURE_CLICK, test.listener.gestures[0].type);
+  TEST_ASSERT_EQUAL_UINT8(UP, test.listener.gestures[0].button);
+  TEST_ASSERT_EQUAL_UINT32(100, test.listener.times[0]);
+}
+
+void test_shouldTellClickFromDoubleClick() {
+  // Prepare
+  Driver test;
+
+  // Execute
+  test.press(MENU);
+  test.runUntil(80);
+  test.release(MENU);
+  test.runUntil(1000); // single click, given after the double click delay
+  test.press(MENU);
+  test.runUntil(1080);
+  test.release(MENU);
+  test.runUntil(1200);
+  test.press(MENU); // double click
+  test.runUntil(1280);
+  test.release(MENU);
+  test.runUntil(3000);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(2, test.listener.gestures.size());
+  TEST_ASSERT_EQUAL(GESTURE_CLICK, test.listener.gestures[0].type);
+  TEST_ASSERT_EQUAL_UINT32(380, test.listener.times[0]);
+  TEST_ASSERT_EQUAL(GESTURE_DOUBLE_CLICK, test.listener.gestures[1].type);
+  TEST_ASSERT_EQUAL_UINT32(1200, test.listener.times[1]);
+}
+
+void test_shouldLongClickOnceUntilReleased() {
+  // Prepare
+  Driver test;
+
+  // Execute
+  test.press(BACK);
+  test.runUntil(5000);
+  test.release(BACK);
+  test.runUntil(6000);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(1, test.listener.gestures.size());
+  TEST_ASSERT_EQUAL(GESTURE_LONG_CLICK, test.listener.gestures[0].type);
+  TEST_ASSERT_EQUAL_UINT32(2000, test.listener.times[0]);
+}
+
+void test_shouldRecognizeChordInsteadOfClicks() {
+  // Prepare
+  Driver test;
+
+  // Execute
+  test.press(BACK);
+  test.runUntil(40);
+  test.press(MENU);
+  test.runUntil(3000); // no long click either
+  test.release(BACK);
+  test.runUntil(3020);
+  test.release(MENU);
+  test.runUntil(4000);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(1, test.listener.gestures.size());
+  TEST_ASSERT_EQUAL(GESTURE_CHORD, test.listener.gestures[0].type);
+  TEST_ASSERT_EQUAL_UINT8(BACK, test.listener.gestures[0].button);
+  TEST_ASSERT_EQUAL_UINT8(MENU, test.listener.gestures[0].other);
+  TEST_ASSERT_EQUAL_UINT32(40, test.listener.times[0]);
+}
+
+void test_shouldRepeatFasterAndFaster() {
+  // Prepare
+  Driver test;
+
+  // Execute
+  test.press(DOWN);
+  test.runUntil(2000);
+  test.release(DOWN);
+  test.runUntil(3000);
+
+  // Verify
+  // click at 0, then repeat at 500 ; periods 200, 150, 113, 85, 64, 50, 50...
+  uint32_t expected[] = {0,   500, 700,  850,  963,  1048, 1112,
+                         1162, 1212, 1262, 1312, 1362, 1412, 1462,
+                         1512, 1562, 1612, 1662, 1712, 1762, 1812,
+                         1862, 1912, 1962};
+  uint32_t expectedCount = sizeof(expected) / sizeof(expected[0]);
+  TEST_ASSERT_EQUAL_UINT32(expectedCount, test.listener.gestures.size());
+  TEST_ASSERT_EQUAL(GESTURE_CLICK, test.listener.gestures[0].type);
+  for (uint32_t i = 1; i < expectedCount; i++) {
+    TEST_ASSERT_EQUAL(GESTURE_REPEAT, test.listener.gestures[i].type);
+    TEST_ASSERT_EQUAL_UINT16(i, test.listener.gestures[i].count);
+    TEST_ASSERT_EQUAL_UINT32(expected[i], test.listener.times[i]);
+  }
+}
+
+void test_shouldFollowEachButtonIndependently() {
+  // Prepare
+  Driver test;
+
+  // Execute
+  test.press(UP);
+  test.runUntil(10);
+  test.press(BACK);
+  test.runUntil(700);
+  test.release(UP);
+  test.runUntil(2500);
+  test.release(BACK);
+  uint32_t deadline = 0;
+  bool hasDeadline = test.recognizer.getNextDeadline(&deadline);
+
+  // Verify
+  // UP : click, repeat at 500 and 700 ; BACK : click on release only, but held
+  // long enough for a long click at 2010
+  TEST_ASSERT_FALSE(hasDeadline);
+  TEST_ASSERT_EQUAL_UINT32(4, test.listener.gestures.size());
+  TEST_ASSERT_EQUAL(GESTURE_LONG_CLICK, test.listener.gestures[3].type);
+  TEST_ASSERT_EQUAL_UINT8(BACK, test.listener.gestures[3].button);
+  TEST_ASSERT_EQUAL_UINT32(2010, test.listener.times[3]);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldClickOnPressWhenNothingElseToTellApart);
+  RUN_TEST(test_shouldTellClickFromDoubleClick);
+  RUN_TEST(test_shouldLongClickOnceUntilReleased);
+  RUN_TEST(test_shouldRecognizeChordInsteadOfClicks);
+  RUN_TEST(test_shouldRepeatFasterAndFaster);
+  RUN_TEST(test_shouldFollowEachButtonIndependently);
+  UNITY_END();
+}
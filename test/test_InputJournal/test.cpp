@@ -0,0 +1,259 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "InputSimplist.hpp"
+#include <string>
+#include <unity.h>
+#include <vector>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+const uint8_t MENU = 15;
+const uint8_t BACK = 18;
+const uint8_t UP = 17;
+const uint8_t DOWN = 16;
+
+const GestureProfile PROFILE_MENU = {2000, 300, 0, 0, 0, 0};
+const GestureProfile PROFILE_BACK = {2000, 0, 0, 0, 0, 0};
+const GestureProfile PROFILE_UP_DOWN = {0, 0, 500, 250, 40, 15};
+
+static int64_t deviceNow = 0;
+int64_t deviceClock() { return deviceNow; }
+
+/**
+ * @brief Stands for `TheClockTask`, records the calls as letters.
+ */
+class RecordingClock : public TheClockCommandListener {
+public:
+  std::string calls;
+  void onMenuClick() { calls += "m"; }
+  void onMenuLongClick() { calls += "M"; }
+  void onMenuDoubleClick() { calls += "2"; }
+  void onMenuBackChord() { calls += "+"; }
+  void onBackClick() { calls += "b"; }
+  void onBackLongClick() { calls += "B"; }
+  void onUpClick() { calls += "u"; }
+  void onUpLongClick() { calls += "U"; }
+  void onDownClick() { calls += "d"; }
+  void onDownLongClick() { calls += "D"; }
+};
+
+/**
+ * @brief The input processing of the control panel, journaled.
+ */
+class ControlPanel {
+public:
+  GestureRecognizer recognizer;
+  ButtonCommandDispatcher dispatcher =
+      ButtonCommandDispatcher(MENU, BACK, UP, DOWN);
+  RecordingClock clock;
+  ControlPanel(InputJournal *journal) {
+    recognizer.withButton(MENU, &PROFILE_MENU)
+        ->withButton(BACK, &PROFILE_BACK)
+        ->withButton(UP, &PROFILE_UP_DOWN)
+        ->withButton(DOWN, &PROFILE_UP_DOWN)
+        ->withChord(MENU, BACK)
+        ->withListener(&dispatcher);
+    dispatcher.withListener(&clock)->withJournal(journal);
+  }
+};
+
+/**
+ * @brief Simulate the device : edges with bounces, debounced changes 3 ms
+ * later, recognizer ticked every millisecond, display refreshed 10 ms after
+ * each command.
+ */
+void simulateSession(InputJournal *journal, ControlPanel *panel) {
+  struct Action {
+    int64_t time;
+    uint8_t button;
+    bool pressed;
+  };
+  Action actions[] = {{100000, UP, true},     {180000, UP, false},
+                      {600000, DOWN, true},   {2100000, DOWN, false},
+                      {3000000, MENU, true},  {3070000, MENU, false},
+                      {3200000, MENU, true},  {3260000, MENU, false},
+                      {4000000, BACK, true},  {4030000, MENU, true},
+                      {4500000, MENU, false}, {4520000, BACK, false},
+                      {5000000, MENU, true},  {5090000, MENU, false}};
+  uint32_t next = 0;
+  uint32_t commands = 0;
+  int64_t displayAt = -1;
+  for (deviceNow = 0; deviceNow < 7000000; deviceNow += 1000) {
+    if (next < sizeof(actions) / sizeof(actions[0]) &&
+        actions[next].time == deviceNow) {
+      Action *action = &actions[next];
+      journal->recordAt(deviceNow - 3000, INPUT_JOURNAL_EDGE, action->button,
+                        !action->pressed);
+      journal->recordAt(deviceNow - 2500, INPUT_JOURNAL_EDGE, action->button,
+                        action->pressed);
+      journal->record(INPUT_JOURNAL_STATE_CHANGE, action->button,
+                      action->pressed);
+      panel->recognizer.update(action->button, action->pressed,
+                               deviceNow / 1000);
+      ++next;
+    }
+    panel->recognizer.tick(deviceNow / 1000);
+    if (panel->clock.calls.size() > commands) {
+      commands = panel->clock.calls.size();
+      displayAt = deviceNow + 10000;
+    }
+    if (displayAt == deviceNow) {
+      journal->record(INPUT_JOURNAL_DISPLAY, 0, 0);
+    }
+  }
+}
+
+void test_shouldKeepTheLastEntriesInOrder() {
+  // Prepare
+  InputJournal test(deviceClock);
+
+  // Execute
+  for (uint32_t i = 0; i < INPUT_JOURNAL_CAPACITY + 10; i++) {
+    test.recordAt(i, INPUT_JOURNAL_EDGE, 1, i % 2);
+  }
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(INPUT_JOURNAL_CAPACITY, test.getSize());
+  TEST_ASSERT_EQUAL_INT64(10, test.get(0)->time);
+  TEST_ASSERT_EQUAL_INT64(INPUT_JOURNAL_CAPACITY + 9,
+                          test.get(INPUT_JOURNAL_CAPACITY - 1)->time);
+}
+
+void test_shouldExportAndImport() {
+  // Prepare
+  InputJournal source(deviceClock), test(deviceClock);
+  source.recordAt(1234567890123LL, INPUT_JOURNAL_GESTURE, 17, GESTURE_REPEAT,
+                  17, 12);
+  source.recordAt(1234567890999LL, INPUT_JOURNAL_COMMAND, 17,
+                  COMMAND_UP_LONG_CLICK, 17, 12);
+  char buffer[256];
+
+  // Execute
+  size_t length = source.exportTo(buffer, sizeof(buffer));
+  uint32_t count = test.importFrom(buffer);
+
+  // Verify
+  TEST_ASSERT_EQUAL_STRING("1234567890123 2 17 3 17 12\n"
+                           "1234567890999 3 17 7 17 12\n",
+                           buffer);
+  TEST_ASSERT_EQUAL_UINT32(strlen(buffer), length);
+  TEST_ASSERT_EQUAL_UINT32(2, count);
+  TEST_ASSERT_EQUAL_INT64(1234567890999LL, test.get(1)->time);
+  TEST_ASSERT_EQUAL_UINT8(COMMAND_UP_LONG_CLICK, test.get(1)->code);
+  TEST_ASSERT_EQUAL_UINT16(12, test.get(1)->count);
+}
+
+void test_shouldImportACaptureOfTheLog() {
+  // Prepare
+  InputJournal test(deviceClock);
+  const char *capture =
+      "I (1200) the-clock: 1234567890123 2 17 3 17 12\n"
+      "\033[0;32mI (1201) the-clock: 1234567890999 3 17 7 17 12\033[0m\r\n";
+
+  // Execute
+  uint32_t count = test.importFrom(capture);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(2, count);
+  TEST_ASSERT_EQUAL_INT64(1234567890123LL, test.get(0)->time);
+  TEST_ASSERT_EQUAL_INT64(1234567890999LL, test.get(1)->time);
+  TEST_ASSERT_EQUAL_UINT16(12, test.get(1)->count);
+}
+
+void test_shouldMeasureEndToEndLatency() {
+  // Prepare
+  InputJournal journal(deviceClock);
+  ControlPanel panel(&journal);
+  simulateSession(&journal, &panel);
+
+  // Execute
+  InputLatency edgeToCommand, edgeToDisplay;
+  bool measured = journal.measure(INPUT_JOURNAL_EDGE, INPUT_JOURNAL_COMMAND,
+                                  &edgeToCommand);
+  journal.measure(INPUT_JOURNAL_EDGE, INPUT_JOURNAL_DISPLAY, &edgeToDisplay);
+
+  // Verify
+  // UP click on press : 3 ms after the first edge
+  TEST_ASSERT_TRUE(measured);
+  TEST_ASSERT_EQUAL_INT64(3000, edgeToCommand.min);
+  TEST_ASSERT_EQUAL_INT64(13000, edgeToDisplay.min);
+  char message[100];
+  snprintf(message, sizeof(message),
+           "edge to display : %u measures, %lld..%lld us",
+           (unsigned)edgeToDisplay.count, (long long)edgeToDisplay.min,
+           (long long)edgeToDisplay.max);
+  TEST_MESSAGE(message);
+}
+
+void test_shouldReplayTheSameCommandsAtTheSameTimes() {
+  // Prepare
+  InputJournal recorded(deviceClock);
+  ControlPanel device(&recorded);
+  simulateSession(&recorded, &device);
+  static char exported[INPUT_JOURNAL_CAPACITY * 40];
+  recorded.exportTo(exported, sizeof(exported));
+  InputJournal imported(deviceClock);
+  imported.importFrom(exported);
+
+  InputJournal output(InputJournalReplayer::clock);
+  ControlPanel native(&output);
+  InputJournalReplayer test(&native.recognizer, &output);
+
+  // Execute
+  uint32_t replayed = test.replay(&imported);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(14, replayed);
+  // UP too short to repeat, 6 repeats of DOWN, MENU double click, chord, and
+  // MENU click after the double click delay
+  TEST_ASSERT_EQUAL_STRING("udDDDDDD2+m", device.clock.calls.c_str());
+  TEST_ASSERT_EQUAL_STRING(device.clock.calls.c_str(),
+                           native.clock.calls.c_str());
+  std::vector<int64_t> expected, actual;
+  for (uint32_t i = 0; i < recorded.getSize(); i++) {
+    if (INPUT_JOURNAL_COMMAND == recorded.get(i)->kind) {
+      expected.push_back(recorded.get(i)->time);
+    }
+  }
+  for (uint32_t i = 0; i < output.getSize(); i++) {
+    if (INPUT_JOURNAL_COMMAND == output.get(i)->kind) {
+      actual.push_back(output.get(i)->time);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    TEST_ASSERT_EQUAL_INT64(expected[i], actual[i]);
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldKeepTheLastEntriesInOrder);
+  RUN_TEST(test_shouldExportAndImport);
+  RUN_TEST(test_shouldImportACaptureOfTheLog);
+  RUN_TEST(test_shouldMeasureEndToEndLatency);
+  RUN_TEST(test_shouldReplayTheSameCommandsAtTheSameTimes);
+  UNITY_END();
+}
@@ -0,0 +1,116 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist'.
+// ---
+// 'Scheduler Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "SchedulerSimplist.hpp"
+#include <unity.h>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+void test_shouldFillTheHistogramAndCountTheMisses() {
+  // Prepare
+  JitterMonitor monitor;
+  JitterProbe *probe = monitor.createProbe("display", 5000);
+  JitterStatistics statistics[JITTER_MAX_PROBES];
+
+  // Execute
+  probe->record(1000, 990);    // early
+  probe->record(2000, 2050);   // < 100
+  probe->record(3000, 3700);   // < 1000
+  probe->record(4000, 10000);  // < 10000, missed
+  probe->record(5000, 105000); // >= 50000, missed
+  uint8_t count = monitor.takeStatistics(statistics);
+
+  // Verify
+  uint32_t expected[JITTER_BUCKETS] = {2, 0, 1, 0, 1, 0, 1};
+  TEST_ASSERT_EQUAL_UINT8(1, count);
+  TEST_ASSERT_EQUAL_UINT32(5, statistics[0].count);
+  TEST_ASSERT_EQUAL_UINT32(2, statistics[0].misses);
+  TEST_ASSERT_EQUAL_UINT32(100000, statistics[0].maxUs);
+  TEST_ASSERT_EQUAL_UINT32(106750, (uint32_t)statistics[0].sumUs);
+  TEST_ASSERT_EQUAL_UINT32_ARRAY(expected, statistics[0].histogram,
+                                 JITTER_BUCKETS);
+}
+
+void test_shouldStartAgainAfterTakingTheStatistics() {
+  // Prepare
+  JitterMonitor monitor;
+  JitterProbe *probe = monitor.createProbe("buttons", 1000);
+  JitterStatistics statistics[JITTER_MAX_PROBES];
+  probe->record(0, 2000);
+  monitor.takeStatistics(statistics);
+
+  // Execute
+  probe->record(0, 10);
+  monitor.takeStatistics(statistics);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(1, statistics[0].count);
+  TEST_ASSERT_EQUAL_UINT32(0, statistics[0].misses);
+  TEST_ASSERT_EQUAL_UINT32(10, statistics[0].maxUs);
+}
+
+void test_shouldSortTheWorstOffendersFirst() {
+  // Prepare
+  JitterMonitor monitor;
+  JitterProbe *good = monitor.createProbe("good", 1000);
+  JitterProbe *late = monitor.createProbe("late", 1000);
+  JitterProbe *missing = monitor.createProbe("missing", 1000);
+  JitterStatistics statistics[JITTER_MAX_PROBES];
+
+  // Execute
+  good->record(0, 10);
+  late->record(0, 900);
+  missing->record(0, 1500);
+  uint8_t count = monitor.takeStatistics(statistics);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT8(3, count);
+  TEST_ASSERT_EQUAL_STRING("missing", statistics[0].name);
+  TEST_ASSERT_EQUAL_STRING("late", statistics[1].name);
+  TEST_ASSERT_EQUAL_STRING("good", statistics[2].name);
+}
+
+void test_shouldRefuseTooManyProbes() {
+  // Prepare
+  JitterMonitor monitor;
+  for (uint8_t i = 0; i < JITTER_MAX_PROBES; i++) {
+    monitor.createProbe("probe", 1000);
+  }
+
+  // Execute
+  JitterProbe *extra = monitor.createProbe("extra", 1000);
+
+  // Verify
+  TEST_ASSERT_NULL(extra);
+  TEST_ASSERT_EQUAL_UINT8(JITTER_MAX_PROBES, monitor.getProbeCount());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldFillTheHistogramAndCountTheMisses);
+  RUN_TEST(test_shouldStartAgainAfterTakingTheStatistics);
+  RUN_TEST(test_shouldSortTheWorstOffendersFirst);
+  RUN_TEST(test_shouldRefuseTooManyProbes);
+  UNITY_END();
+}
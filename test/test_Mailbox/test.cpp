@@ -0,0 +1,141 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Message Simplist'.
+// ---
+// 'Message Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Message Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Message Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "MessageSimplist.hpp"
+#include <atomic>
+#include <thread>
+#include <unity.h>
+
+/**
+ * @brief A clock that goes forward by 10 us at each reading.
+ */
+static std::atomic<int64_t> fakeTime{0};
+static int64_t fakeClock() { return fakeTime.fetch_add(10); }
+
+/**
+ * @brief Before test
+ */
+void setUp(void) { fakeTime.store(0); }
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+static Message messageOf(uint16_t type, int32_t value) {
+  Message message;
+  message.type = type;
+  message.code = 0;
+  message.value = value;
+  return message;
+}
+
+void test_shouldReceiveInTheOrderOfPosting() {
+  // Prepare
+  Mailbox test(fakeClock);
+  for (int32_t i = 0; i < 5; i++) {
+    Message message = messageOf(1, i);
+    test.post(&message);
+  }
+
+  // Execute
+  Message received;
+  int32_t values[5];
+  for (int32_t i = 0; i < 5; i++) {
+    test.receive(&received);
+    values[i] = received.value;
+  }
+  bool more = test.receive(&received);
+
+  // Verify
+  int32_t expected[5] = {0, 1, 2, 3, 4};
+  TEST_ASSERT_EQUAL_INT32_ARRAY(expected, values, 5);
+  TEST_ASSERT_FALSE(more);
+}
+
+void test_shouldDropWhenFullAndMeasure() {
+  // Prepare
+  Mailbox test(fakeClock);
+  Message message = messageOf(1, 0);
+  for (uint32_t i = 0; i < MAILBOX_CAPACITY + 3; i++) {
+    test.post(&message);
+  }
+
+  // Execute
+  Message received;
+  while (test.receive(&received)) {
+  }
+  MailboxStatistics statistics;
+  test.getStatistics(&statistics);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(MAILBOX_CAPACITY, statistics.posted);
+  TEST_ASSERT_EQUAL_UINT32(3, statistics.dropped);
+  TEST_ASSERT_EQUAL_UINT32(MAILBOX_CAPACITY, statistics.received);
+  TEST_ASSERT_EQUAL_UINT32(MAILBOX_CAPACITY, statistics.maxDepth);
+  TEST_ASSERT_GREATER_THAN(0, statistics.maxLatency);
+}
+
+void test_shouldKeepTheOrderOfEachSender() {
+  // Prepare
+  const int SENDERS = 4;
+  const int32_t COUNT = 20000;
+  Mailbox test(fakeClock);
+  std::atomic<bool> go{false};
+  std::thread senders[SENDERS];
+  for (int s = 0; s < SENDERS; s++) {
+    senders[s] = std::thread([&test, &go, s, COUNT]() {
+      while (!go.load()) {
+      }
+      for (int32_t i = 0; i < COUNT;) {
+        Message message = messageOf(s, i);
+        if (test.post(&message)) {
+          ++i; // retry until accepted
+        }
+      }
+    });
+  }
+
+  // Execute
+  int32_t next[SENDERS] = {0, 0, 0, 0};
+  bool ordered = true;
+  int32_t total = 0;
+  go.store(true);
+  Message received;
+  while (total < SENDERS * COUNT) {
+    if (test.receive(&received)) {
+      ordered = ordered && (next[received.type] == received.value);
+      next[received.type] = received.value + 1;
+      ++total;
+    }
+  }
+  for (int s = 0; s < SENDERS; s++) {
+    senders[s].join();
+  }
+
+  // Verify
+  TEST_ASSERT_TRUE(ordered);
+  TEST_ASSERT_EQUAL_INT32(SENDERS * COUNT, total);
+  TEST_ASSERT_EQUAL_UINT32(0, test.getDepth());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldReceiveInTheOrderOfPosting);
+  RUN_TEST(test_shouldDropWhenFullAndMeasure);
+  RUN_TEST(test_shouldKeepTheOrderOfEachSender);
+  UNITY_END();
+}
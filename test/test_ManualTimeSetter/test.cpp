@@ -0,0 +1,110 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Time Keeper Simplist'.
+// ---
+// 'Time Keeper Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Time Keeper Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Time Keeper Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "TimeKeeperSimplist.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <unity.h>
+
+/**
+ * @brief Before test : the local time is the universal time.
+ */
+void setUp(void) {
+  setenv("TZ", "UTC0", 1);
+  tzset();
+}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+//**@brief 2023-06-15 23:45:30 UTC
+const time_t NOW = 1686872730;
+
+static ManualTimeSetter startedAtNow() {
+  ManualTimeSetter setter;
+  struct tm local;
+  localtime_r(&NOW, &local);
+  setter.begin(&local);
+  return setter;
+}
+
+void test_shouldStartFromTheCurrentTime() {
+  // Prepare
+  ManualTimeSetter test = startedAtNow();
+  char buffer[5];
+
+  // Execute
+  test.format(buffer);
+
+  // Verify
+  TEST_ASSERT_TRUE(test.isActive());
+  TEST_ASSERT_EQUAL(MANUAL_TIME_HOUR, test.getField());
+  TEST_ASSERT_EQUAL_STRING("2345", buffer);
+}
+
+void test_shouldWrapEachFieldAlone() {
+  // Prepare
+  ManualTimeSetter test = startedAtNow();
+
+  // Execute
+  test.step(2);
+  test.nextField();
+  test.step(-50);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT8(1, test.getHour());
+  TEST_ASSERT_EQUAL_UINT8(55, test.getMinutes());
+}
+
+void test_shouldTellWhenThereIsNoNextField() {
+  // Prepare
+  ManualTimeSetter test = startedAtNow();
+
+  // Execute
+  bool toMinutes = test.nextField();
+  bool afterMinutes = test.nextField();
+
+  // Verify
+  TEST_ASSERT_TRUE(toMinutes);
+  TEST_ASSERT_FALSE(afterMinutes);
+  TEST_ASSERT_EQUAL(MANUAL_TIME_MINUTES, test.getField());
+}
+
+void test_shouldCommitOnTheSameDayWithoutSeconds() {
+  // Prepare
+  ManualTimeSetter test = startedAtNow();
+  test.step(-13); // 10:45
+  test.nextField();
+  test.step(20); // 10:05
+
+  // Execute
+  time_t result = test.commit(NOW);
+
+  // Verify
+  TEST_ASSERT_FALSE(test.isActive());
+  TEST_ASSERT_EQUAL_INT64(1686823500, (int64_t)result); // 2023-06-15 10:05:00
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldStartFromTheCurrentTime);
+  RUN_TEST(test_shouldWrapEachFieldAlone);
+  RUN_TEST(test_shouldTellWhenThereIsNoNextField);
+  RUN_TEST(test_shouldCommitOnTheSameDayWithoutSeconds);
+  UNITY_END();
+}
@@ -0,0 +1,161 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Menu Simplist'.
+// ---
+// 'Menu Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Menu Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Menu Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "MenuSimplist.hpp"
+#include <string>
+#include <unity.h>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+enum TestMenuId { ACTION_SYNC, ACTION_FORGET, VALUE_LEVEL, VALUE_ZONE };
+
+static constexpr const char *ZONES[] = {"UTC", "CET", "EST"};
+
+/**
+ * @brief root > [sync, wifi > [forget], level, zone]
+ */
+static constexpr MenuItem ITEMS[] = {
+    {"MENU", MENU_ITEM_SUBMENU, 0, MENU_NO_PARENT, 1, 4, 0, 0, nullptr},
+    {"SYNC", MENU_ITEM_ACTION, ACTION_SYNC, 0, 0, 0, 0, 0, nullptr},
+    {"WIFI", MENU_ITEM_SUBMENU, 0, 0, 5, 1, 0, 0, nullptr},
+    {"LEVL", MENU_ITEM_VALUE, VALUE_LEVEL, 0, 0, 0, 1, 7, nullptr},
+    {"ZONE", MENU_ITEM_VALUE, VALUE_ZONE, 0, 0, 0, 0, 2, ZONES},
+    {"FORG", MENU_ITEM_ACTION, ACTION_FORGET, 2, 0, 0, 0, 0, nullptr},
+};
+
+/**
+ * @brief Records the calls, and keeps the values.
+ */
+class RecordingMenuListener : public MenuListener {
+public:
+  std::string calls;
+  int16_t values[4] = {0, 0, 5, 1};
+  virtual void onMenuAction(uint8_t id) { calls.push_back('a' + id); }
+  virtual int16_t getMenuValue(uint8_t id) { return values[id]; }
+  virtual void onMenuValue(uint8_t id, int16_t value) {
+    calls.push_back('A' + id);
+    values[id] = value;
+  }
+};
+
+static std::string display(MenuNavigator *navigator) {
+  char buffer[5];
+  navigator->format(buffer);
+  return std::string(buffer);
+}
+
+void test_shouldWrapAroundAmongSiblings() {
+  // Prepare
+  MenuNavigator test(ITEMS);
+  test.open();
+
+  // Execute
+  test.up();
+  std::string last = display(&test);
+  test.down();
+  std::string first = display(&test);
+
+  // Verify
+  TEST_ASSERT_EQUAL_STRING("ZONE", last.c_str());
+  TEST_ASSERT_EQUAL_STRING("SYNC", first.c_str());
+}
+
+void test_shouldEnterSubmenuTriggerActionAndGoBack() {
+  // Prepare
+  RecordingMenuListener listener;
+  MenuNavigator test(ITEMS);
+  test.withListener(&listener)->open();
+
+  // Execute
+  test.select(); // sync
+  test.down();
+  test.select(); // into wifi
+  std::string inside = display(&test);
+  test.down(); // only child
+  test.select(); // forget
+  test.back();
+  std::string outside = display(&test);
+  test.back();
+
+  // Verify
+  TEST_ASSERT_EQUAL_STRING("FORG", inside.c_str());
+  TEST_ASSERT_EQUAL_STRING("WIFI", outside.c_str());
+  TEST_ASSERT_EQUAL_STRING("ab", listener.calls.c_str());
+  TEST_ASSERT_FALSE(test.isActive());
+}
+
+void test_shouldEditValueWithinBoundsAndConfirm() {
+  // Prepare
+  RecordingMenuListener listener;
+  MenuNavigator test(ITEMS);
+  test.withListener(&listener)->open();
+  test.up();
+  test.up(); // level
+
+  // Execute
+  test.select();
+  std::string start = display(&test);
+  test.down();
+  test.down();
+  test.down(); // 5 -> 6 -> 7 -> 1
+  std::string wrapped = display(&test);
+  test.select();
+
+  // Verify
+  TEST_ASSERT_EQUAL_STRING("   5", start.c_str());
+  TEST_ASSERT_EQUAL_STRING("   1", wrapped.c_str());
+  TEST_ASSERT_EQUAL_STRING("C", listener.calls.c_str());
+  TEST_ASSERT_EQUAL_INT16(1, listener.values[VALUE_LEVEL]);
+  TEST_ASSERT_FALSE(test.isEditing());
+}
+
+void test_shouldShowChoicesAndCancelOnBack() {
+  // Prepare
+  RecordingMenuListener listener;
+  MenuNavigator test(ITEMS);
+  test.withListener(&listener)->open();
+  test.up(); // zone
+
+  // Execute
+  test.select();
+  test.down();
+  std::string choice = display(&test);
+  test.back();
+  std::string label = display(&test);
+
+  // Verify
+  TEST_ASSERT_EQUAL_STRING("EST ", choice.c_str());
+  TEST_ASSERT_EQUAL_STRING("ZONE", label.c_str());
+  TEST_ASSERT_EQUAL_STRING("", listener.calls.c_str());
+  TEST_ASSERT_TRUE(test.isActive());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldWrapAroundAmongSiblings);
+  RUN_TEST(test_shouldEnterSubmenuTriggerActionAndGoBack);
+  RUN_TEST(test_shouldEditValueWithinBoundsAndConfirm);
+  RUN_TEST(test_shouldShowChoicesAndCancelOnBack);
+  UNITY_END();
+}
@@ -0,0 +1,267 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "NtpBroadcastClient.hpp"
+#include "UdpEndpointUsingSockets.hpp"
+#include <chrono>
+#include <sys/time.h>
+#include <thread>
+#include <unity.h>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+const int64_t SECOND = 1000000;
+const int64_t SOME_TIME = 1700000000LL * SECOND + 250000; // Nov. 2023
+UdpPeer dummyServer = {.address = {.v4 = {192, 168, 1, 10}}, .port = NTP_PORT};
+UdpPeer dummyIntruder = {.address = {.v4 = {192, 168, 1, 66}},
+                         .port = NTP_PORT};
+
+int64_t localNow() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (int64_t)tv.tv_sec * SECOND + tv.tv_usec;
+}
+
+size_t makeServerPacket(uint8_t *packet, NtpMode mode, int64_t transmit,
+                        uint8_t stratum = 2) {
+  NtpPacketDescription desc;
+  memset(&desc, 0, sizeof(desc));
+  desc.leapIndicator = NTP_LEAP_NONE;
+  desc.version = NTP_VERSION;
+  desc.mode = mode;
+  desc.stratum = stratum;
+  desc.transmitTimestamp = NtpPacket::toNtpTimestamp(transmit);
+  return NtpPacket::encode(&desc, packet);
+}
+
+size_t makeReply(uint8_t *packet, const uint8_t *request, int64_t received,
+                 int64_t transmit) {
+  NtpPacketDescription req;
+  NtpPacket::decode(request, NTP_PACKET_SIZE, &req);
+  size_t size = makeServerPacket(packet, NTP_MODE_SERVER, transmit);
+  NtpTimestamp t2 = NtpPacket::toNtpTimestamp(received);
+  NtpPacket::writeTimestamp(packet + NTP_OFFSET_ORIGIN_TIMESTAMP,
+                            &req.transmitTimestamp);
+  NtpPacket::writeTimestamp(packet + NTP_OFFSET_RECEIVE_TIMESTAMP, &t2);
+  return size;
+}
+
+void test_shouldConvertTimestampsBothWays() {
+  // Prepare
+  int64_t values[] = {0, SOME_TIME, SOME_TIME + 999999,
+                      2200000000LL * SECOND}; // last one is in era 1
+
+  for (int64_t value : values) {
+    // Execute
+    NtpTimestamp ts = NtpPacket::toNtpTimestamp(value);
+
+    // Verify
+    TEST_ASSERT_INT64_WITHIN(1, value, NtpPacket::toUnixMicros(&ts));
+  }
+}
+
+void test_shouldEncodeAndDecodePackets() {
+  // Prepare
+  uint8_t packet[NTP_PACKET_SIZE];
+  makeServerPacket(packet, NTP_MODE_BROADCAST, SOME_TIME, 3);
+
+  // Execute
+  NtpPacketDescription result;
+  bool decoded = NtpPacket::decode(packet, sizeof(packet), &result);
+
+  // Verify
+  TEST_ASSERT_TRUE(decoded);
+  TEST_ASSERT_EQUAL_INT(NTP_MODE_BROADCAST, result.mode);
+  TEST_ASSERT_EQUAL_UINT8(NTP_VERSION, result.version);
+  TEST_ASSERT_EQUAL_UINT8(3, result.stratum);
+  TEST_ASSERT_INT64_WITHIN(1, SOME_TIME,
+                           NtpPacket::toUnixMicros(&result.transmitTimestamp));
+  TEST_ASSERT_FALSE(NtpPacket::decode(packet, NTP_PACKET_SIZE - 1, &result));
+}
+
+void test_shouldAdoptFirstBeaconSenderThenRequireCalibration() {
+  // Prepare
+  NtpBroadcastClient test;
+  uint8_t packet[NTP_PACKET_SIZE];
+  size_t size = makeServerPacket(packet, NTP_MODE_BROADCAST, SOME_TIME);
+
+  // Execute
+  bool accepted = test.acceptBeacon(packet, size, &dummyServer, SOME_TIME);
+
+  // Verify
+  TEST_ASSERT_FALSE(accepted);
+  TEST_ASSERT_EQUAL_INT(CALIBRATING, test.getState());
+  TEST_ASSERT_TRUE(test.isCalibrationRequired());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(dummyServer.address.v4,
+                                test.getServer()->address.v4, SIZE_OF_IPV4);
+}
+
+void test_shouldComputeOffsetAndDelayFromCalibration() {
+  // Prepare : server is 3 s ahead, 2 ms each way, 1 ms of processing
+  NtpBroadcastClient test;
+  uint8_t packet[NTP_PACKET_SIZE];
+  uint8_t request[NTP_PACKET_SIZE];
+  size_t size = makeServerPacket(packet, NTP_MODE_BROADCAST, SOME_TIME);
+  test.acceptBeacon(packet, size, &dummyServer, SOME_TIME);
+  int64_t t1 = SOME_TIME + SECOND;
+  test.prepareCalibrationRequest(request, t1);
+  size = makeReply(packet, request, t1 + 3 * SECOND + 2000,
+                   t1 + 3 * SECOND + 3000);
+
+  // Execute
+  bool calibrated =
+      test.acceptCalibrationReply(packet, size, &dummyServer, t1 + 5000);
+
+  // Verify
+  TEST_ASSERT_TRUE(calibrated);
+  TEST_ASSERT_EQUAL_INT(TRACKING, test.getState());
+  TEST_ASSERT_INT64_WITHIN(1, 2000, test.getOneWayDelay());
+  TEST_ASSERT_INT64_WITHIN(1, 3 * SECOND, test.getOffset());
+  TEST_ASSERT_TRUE(test.isStepRequired());
+}
+
+void test_shouldRejectReplyNotEchoingTheRequest() {
+  // Prepare
+  NtpBroadcastClient test;
+  uint8_t packet[NTP_PACKET_SIZE];
+  uint8_t request[NTP_PACKET_SIZE];
+  size_t size = makeServerPacket(packet, NTP_MODE_BROADCAST, SOME_TIME);
+  test.acceptBeacon(packet, size, &dummyServer, SOME_TIME);
+  test.prepareCalibrationRequest(request, SOME_TIME + SECOND);
+  uint8_t forged[NTP_PACKET_SIZE];
+  test.prepareCalibrationRequest(forged, SOME_TIME + 2 * SECOND);
+  size = makeReply(packet, request, SOME_TIME, SOME_TIME);
+
+  // Execute
+  bool calibrated = test.acceptCalibrationReply(
+      packet, size, &dummyServer, SOME_TIME + 2 * SECOND + 1000);
+
+  // Verify
+  TEST_ASSERT_FALSE(calibrated);
+  TEST_ASSERT_EQUAL_INT(CALIBRATING, test.getState());
+}
+
+void test_shouldTrackOnlyTheAdoptedServerWithNewerBeacons() {
+  // Prepare : calibrated with a 1 ms one way delay, no offset
+  NtpBroadcastClient test;
+  uint8_t packet[NTP_PACKET_SIZE];
+  uint8_t request[NTP_PACKET_SIZE];
+  size_t size = makeServerPacket(packet, NTP_MODE_BROADCAST, SOME_TIME);
+  test.acceptBeacon(packet, size, &dummyServer, SOME_TIME);
+  test.prepareCalibrationRequest(request, SOME_TIME);
+  size = makeReply(packet, request, SOME_TIME + 1000, SOME_TIME + 1000);
+  test.acceptCalibrationReply(packet, size, &dummyServer, SOME_TIME + 2000);
+
+  // Execute & verify : local clock is 40 ms late
+  size = makeServerPacket(packet, NTP_MODE_BROADCAST, SOME_TIME + 64 * SECOND);
+  TEST_ASSERT_TRUE(test.acceptBeacon(packet, size, &dummyServer,
+                                     SOME_TIME + 64 * SECOND + 1000 - 40000));
+  TEST_ASSERT_INT64_WITHIN(1, 40000, test.getOffset());
+  TEST_ASSERT_FALSE(test.isStepRequired());
+
+  // replayed beacon
+  TEST_ASSERT_FALSE(test.acceptBeacon(packet, size, &dummyServer,
+                                      SOME_TIME + 65 * SECOND));
+  // other server
+  size = makeServerPacket(packet, NTP_MODE_BROADCAST, SOME_TIME + 128 * SECOND);
+  TEST_ASSERT_FALSE(test.acceptBeacon(packet, size, &dummyIntruder,
+                                      SOME_TIME + 128 * SECOND));
+  // unsynchronized server
+  size = makeServerPacket(packet, NTP_MODE_BROADCAST, SOME_TIME + 192 * SECOND,
+                          0);
+  TEST_ASSERT_FALSE(test.acceptBeacon(packet, size, &dummyServer,
+                                      SOME_TIME + 192 * SECOND));
+  TEST_ASSERT_EQUAL_UINT32(1, test.getAcceptedBeaconCount());
+  TEST_ASSERT_EQUAL_UINT32(3, test.getRejectedBeaconCount());
+}
+
+/**
+ * @brief A local broadcaster on the loopback interface, 2 seconds ahead of the
+ * host clock, that sends beacons and answers one calibration request.
+ */
+void runLocalBroadcaster(UdpEndpointUsingSockets *server, UdpPeer client,
+                         int beaconCount) {
+  const int64_t AHEAD = 2 * SECOND;
+  uint8_t packet[NTP_PACKET_SIZE];
+  uint8_t request[NTP_PACKET_SIZE];
+  UdpPeer requester;
+  for (int i = 0; i < beaconCount; i++) {
+    size_t size =
+        makeServerPacket(packet, NTP_MODE_BROADCAST, localNow() + AHEAD);
+    server->sendTo(&client, packet, size);
+    if (server->receiveFrom(request, sizeof(request), &requester, 20) > 0) {
+      int64_t received = localNow() + AHEAD;
+      size = makeReply(packet, request, received, localNow() + AHEAD);
+      server->sendTo(&requester, packet, size);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+}
+
+void test_shouldSynchronizeWithLocalBroadcaster() {
+  // Prepare
+  UdpEndpointUsingSockets server;
+  UdpEndpointUsingSockets listener;
+  TEST_ASSERT_TRUE(server.open(0, true));
+  TEST_ASSERT_TRUE(listener.open(0, true));
+  UdpPeer client = {.address = {.v4 = {127, 0, 0, 1}},
+                    .port = listener.getLocalPort()};
+  std::thread broadcaster(runLocalBroadcaster, &server, client, 10);
+  NtpBroadcastClient test;
+  uint8_t packet[NTP_PACKET_SIZE];
+  UdpPeer sender;
+
+  // Execute
+  int received;
+  while ((received = listener.receiveFrom(packet, sizeof(packet), &sender,
+                                          500)) > 0) {
+    int64_t now = localNow();
+    if (test.acceptBeacon(packet, received, &sender, now) ||
+        test.acceptCalibrationReply(packet, received, &sender, now)) {
+      continue;
+    }
+    if (test.isCalibrationRequired()) {
+      size_t size = test.prepareCalibrationRequest(packet, localNow());
+      listener.sendTo(test.getServer(), packet, size);
+    }
+  }
+  broadcaster.join();
+
+  // Verify
+  TEST_ASSERT_EQUAL_INT(TRACKING, test.getState());
+  TEST_ASSERT_GREATER_THAN(5, test.getAcceptedBeaconCount());
+  TEST_ASSERT_INT64_WITHIN(5000, 2 * SECOND, test.getOffset());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldConvertTimestampsBothWays);
+  RUN_TEST(test_shouldEncodeAndDecodePackets);
+  RUN_TEST(test_shouldAdoptFirstBeaconSenderThenRequireCalibration);
+  RUN_TEST(test_shouldComputeOffsetAndDelayFromCalibration);
+  RUN_TEST(test_shouldRejectReplyNotEchoingTheRequest);
+  RUN_TEST(test_shouldTrackOnlyTheAdoptedServerWithNewerBeacons);
+  RUN_TEST(test_shouldSynchronizeWithLocalBroadcaster);
+  UNITY_END();
+}
@@ -0,0 +1,279 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Phase Sync Simplist'.
+// ---
+// 'Phase Sync Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Phase Sync Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Phase Sync Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "PhaseSyncAgent.hpp"
+#include <cstdlib>
+#include <deque>
+#include <unity.h>
+#include <vector>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+const int64_t MS = 1000;
+const int64_t STEP = 250 * MS;
+const uint8_t STEPS = 4;
+
+/**
+ * @brief Shared medium of the simulated clocks : broadcasts are delivered to
+ * every other endpoint bound to the port, after a random delay.
+ */
+class SimulatedNetwork {
+public:
+  int64_t now = 0; // true time
+  int64_t minDelay = 1 * MS;
+  int64_t maxDelay = 8 * MS;
+  std::vector<class SimulatedUdpEndpoint *> endpoints;
+  void broadcast(SimulatedUdpEndpoint *from, uint16_t port,
+                 const uint8_t *data, size_t length);
+};
+
+typedef struct {
+  int64_t deliverAt;
+  std::vector<uint8_t> data;
+} SimulatedDatagram;
+
+class SimulatedUdpEndpoint : public UdpEndpoint {
+public:
+  SimulatedNetwork *network;
+  uint16_t port = 0;
+  bool opened = false;
+  std::deque<SimulatedDatagram> inbox;
+
+  SimulatedUdpEndpoint(SimulatedNetwork *net) : network(net) {
+    network->endpoints.push_back(this);
+  }
+  bool open(uint16_t localPort, bool) {
+    port = localPort;
+    opened = true;
+    return true;
+  }
+  bool joinMulticastGroup(const IpAddress *) { return false; }
+  int sendTo(const UdpPeer *to, const uint8_t *data, size_t length) {
+    network->broadcast(this, to->port, data, length);
+    return (int)length;
+  }
+  int receiveFrom(uint8_t *buffer, size_t capacity, UdpPeer *, uint32_t) {
+    // never blocks : the test drives the time
+    if (inbox.empty() || inbox.front().deliverAt > network->now) {
+      return 0;
+    }
+    SimulatedDatagram datagram = inbox.front();
+    inbox.pop_front();
+    size_t size = datagram.data.size() < capacity ? datagram.data.size()
+                                                  : capacity;
+    memcpy(buffer, datagram.data.data(), size);
+    return (int)size;
+  }
+  void close() { opened = false; }
+  bool resolve(const char *, IpAddress *) { return false; }
+};
+
+void SimulatedNetwork::broadcast(SimulatedUdpEndpoint *from, uint16_t port,
+                                 const uint8_t *data, size_t length) {
+  for (SimulatedUdpEndpoint *endpoint : endpoints) {
+    if (endpoint == from || !endpoint->opened || endpoint->port != port) {
+      continue;
+    }
+    int64_t delay = minDelay + rand() % (maxDelay - minDelay + 1);
+    // keep the order of the datagrams, as on a LAN
+    int64_t deliverAt = now + delay;
+    if (!endpoint->inbox.empty() &&
+        endpoint->inbox.back().deliverAt > deliverAt) {
+      deliverAt = endpoint->inbox.back().deliverAt;
+    }
+    endpoint->inbox.push_back(
+        {.deliverAt = deliverAt,
+         .data = std::vector<uint8_t>(data, data + length)});
+  }
+}
+
+/**
+ * @brief A simulated clock : its own local time, timeline, endpoint and agent.
+ */
+class SimulatedClock {
+public:
+  int64_t localOffset;
+  AnimationTimeline timeline;
+  SimulatedUdpEndpoint endpoint;
+  PhaseSyncAgent agent;
+  SimulatedClock(SimulatedNetwork *network, PhaseSyncRole role,
+                 int64_t offset, int64_t origin)
+      : localOffset(offset), timeline(STEP, STEPS, origin), endpoint(network),
+        agent(&endpoint, &timeline, role) {}
+  int64_t localNow(int64_t trueNow) { return trueNow + localOffset; }
+  /**
+   * @brief Start of the cycle, in true time, folded around the given one.
+   */
+  int64_t getPhaseErrorTo(SimulatedClock *other) {
+    int64_t cycle = timeline.getCycleDuration();
+    int64_t error = ((timeline.getOrigin() - localOffset) -
+                     (other->timeline.getOrigin() - other->localOffset)) %
+                    cycle;
+    if (error < 0) {
+      error += cycle;
+    }
+    return error > cycle / 2 ? error - cycle : error;
+  }
+  void runOnce(int64_t trueNow) {
+    uint8_t buffer[64];
+    int size;
+    while ((size = endpoint.receiveFrom(buffer, sizeof(buffer), nullptr, 0)) >
+           0) {
+      agent.onBeacon(buffer, size, localNow(trueNow));
+    }
+    agent.onTick(localNow(trueNow));
+  }
+};
+
+void runNetwork(SimulatedNetwork *network, std::vector<SimulatedClock *> clocks,
+                int64_t duration) {
+  int64_t end = network->now + duration;
+  for (; network->now < end; network->now += MS) {
+    for (SimulatedClock *clock : clocks) {
+      clock->runOnce(network->now);
+    }
+  }
+}
+
+void test_shouldComputeStepsAndDelays() {
+  // Prepare
+  AnimationTimeline test(STEP, STEPS, 100 * MS);
+
+  // Execute & Verify
+  TEST_ASSERT_EQUAL_UINT8(0, test.getStepAt(100 * MS));
+  TEST_ASSERT_EQUAL_UINT8(1, test.getStepAt(350 * MS));
+  TEST_ASSERT_EQUAL_UINT8(3, test.getStepAt(99 * MS)); // before the origin
+  TEST_ASSERT_EQUAL_INT64(150 * MS, test.getDelayToNextStep(200 * MS));
+  TEST_ASSERT_EQUAL_INT64(STEP, test.getDelayToNextStep(350 * MS));
+  TEST_ASSERT_EQUAL_INT64(-200 * MS, test.getShiftTo(900 * MS));
+  TEST_ASSERT_EQUAL_INT64(200 * MS, test.getShiftTo(1300 * MS));
+}
+
+void test_shouldAlternateTheColonWhenRefreshingEveryOtherStep() {
+  // Prepare
+  AnimationTimeline test(STEP, STEPS, 100 * MS);
+  int64_t now = 130 * MS; // woken up by a push, in step 0
+  bool colonLit[4];
+
+  // Execute
+  for (uint8_t i = 0; i < 4; i++) {
+    now += test.getDelayToNextOddStep(now);
+    uint8_t step = test.getStepAt(now);
+    TEST_ASSERT_EQUAL_UINT8(1, step % 2);
+    colonLit[i] = step < 3; // like the display
+  }
+
+  // Verify
+  TEST_ASSERT_TRUE(colonLit[0]);
+  TEST_ASSERT_FALSE(colonLit[1]);
+  TEST_ASSERT_TRUE(colonLit[2]);
+  TEST_ASSERT_FALSE(colonLit[3]);
+  TEST_ASSERT_EQUAL_INT64(2 * STEP, test.getDelayToNextOddStep(350 * MS));
+}
+
+void test_shouldEncodeAndDecodeBeacons() {
+  // Prepare
+  PhaseBeaconDescription beacon = {.stepCount = STEPS,
+                                   .stepDurationMs = 250,
+                                   .sequence = 0x01020304,
+                                   .elapsedInCycle = 987654};
+  uint8_t packet[PHASE_BEACON_SIZE];
+
+  // Execute
+  size_t size = PhaseBeacon::encode(&beacon, packet);
+  PhaseBeaconDescription result;
+  bool decoded = PhaseBeacon::decode(packet, size, &result);
+
+  // Verify
+  TEST_ASSERT_TRUE(decoded);
+  TEST_ASSERT_EQUAL_UINT8(STEPS, result.stepCount);
+  TEST_ASSERT_EQUAL_UINT16(250, result.stepDurationMs);
+  TEST_ASSERT_EQUAL_UINT32(0x01020304, result.sequence);
+  TEST_ASSERT_EQUAL_UINT32(987654, result.elapsedInCycle);
+  packet[0] = 'X';
+  TEST_ASSERT_FALSE(PhaseBeacon::decode(packet, size, &result));
+}
+
+void test_shouldLockSeveralFollowersWithinTenMilliseconds() {
+  // Prepare : free running clocks, booted at various times
+  srand(42);
+  SimulatedNetwork network;
+  SimulatedClock leader(&network, PHASE_SYNC_LEADER, 12345 * MS, 0);
+  std::vector<SimulatedClock *> clocks = {&leader};
+  for (int i = 1; i <= 5; i++) {
+    clocks.push_back(new SimulatedClock(&network, PHASE_SYNC_FOLLOWER,
+                                        i * 7919 * MS + i * 131, i * 97 * MS));
+  }
+  for (SimulatedClock *clock : clocks) {
+    TEST_ASSERT_TRUE(clock->agent.open());
+  }
+  TEST_ASSERT_GREATER_THAN(10 * MS,
+                           std::llabs(clocks[1]->getPhaseErrorTo(&leader)));
+
+  // Execute
+  runNetwork(&network, clocks, 30000 * MS);
+
+  // Verify
+  for (size_t i = 1; i < clocks.size(); i++) {
+    TEST_ASSERT_GREATER_OR_EQUAL(25, clocks[i]->agent.getAcceptedCount());
+    TEST_ASSERT_LESS_THAN(10 * MS,
+                          std::llabs(clocks[i]->getPhaseErrorTo(&leader)));
+    for (size_t j = 1; j < clocks.size(); j++) {
+      TEST_ASSERT_LESS_THAN(10 * MS,
+                            std::llabs(clocks[i]->getPhaseErrorTo(clocks[j])));
+    }
+  }
+  for (size_t i = 1; i < clocks.size(); i++) {
+    delete clocks[i];
+  }
+}
+
+void test_shouldFollowTheLeaderWhenItRestarts() {
+  // Prepare
+  srand(7);
+  SimulatedNetwork network;
+  SimulatedClock leader(&network, PHASE_SYNC_LEADER, 0, 0);
+  SimulatedClock follower(&network, PHASE_SYNC_FOLLOWER, 5000 * MS, 0);
+  std::vector<SimulatedClock *> clocks = {&leader, &follower};
+  leader.agent.open();
+  follower.agent.open();
+  runNetwork(&network, clocks, 10000 * MS);
+
+  // Execute : the leader timeline jumps by 400 ms
+  leader.timeline.setOrigin(leader.timeline.getOrigin() + 400 * MS);
+  runNetwork(&network, clocks, 15000 * MS);
+
+  // Verify
+  TEST_ASSERT_LESS_THAN(10 * MS, std::llabs(follower.getPhaseErrorTo(&leader)));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldComputeStepsAndDelays);
+  RUN_TEST(test_shouldAlternateTheColonWhenRefreshingEveryOtherStep);
+  RUN_TEST(test_shouldEncodeAndDecodeBeacons);
+  RUN_TEST(test_shouldLockSeveralFollowersWithinTenMilliseconds);
+  RUN_TEST(test_shouldFollowTheLeaderWhenItRestarts);
+  UNITY_END();
+}
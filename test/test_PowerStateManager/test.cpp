@@ -0,0 +1,165 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Power Simplist'.
+// ---
+// 'Power Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Power Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Power Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "PowerSimplist.hpp"
+#include <string>
+#include <unity.h>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+/**
+ * @brief A probe that reads what the test tells, as the mains detection
+ * input would on the device.
+ */
+class FakePowerSupplyProbe : public PowerSupplyProbe {
+public:
+  PowerSupplyState next = POWER_SUPPLY_UNKNOWN;
+  virtual PowerSupplyState read() { return next; }
+};
+
+/**
+ * @brief Records the calls of all the profiles in a shared journal.
+ */
+class RecordingPowerProfile : public PowerProfile {
+public:
+  std::string *journal;
+  char name;
+  bool degraded = false;
+  RecordingPowerProfile(std::string *journal, char name)
+      : journal(journal), name(name) {}
+  virtual void onDegraded() {
+    degraded = true;
+    journal->push_back('-');
+    journal->push_back(name);
+  }
+  virtual void onNominal() {
+    degraded = false;
+    journal->push_back('+');
+    journal->push_back(name);
+  }
+};
+
+void test_shouldStayNominalWhenStartingOnMains() {
+  // Prepare
+  std::string journal;
+  FakePowerSupplyProbe probe;
+  RecordingPowerProfile display(&journal, 'd');
+  PowerStateManager test;
+  test.withProbe(&probe)->withProfile(&display)->withConfirmations(2);
+
+  // Execute
+  probe.next = POWER_SUPPLY_UNKNOWN;
+  bool firstChange = test.update();
+  probe.next = POWER_SUPPLY_MAINS;
+  bool secondChange = test.update();
+  bool thirdChange = test.update();
+
+  // Verify
+  TEST_ASSERT_FALSE(firstChange);
+  TEST_ASSERT_FALSE(secondChange);
+  TEST_ASSERT_TRUE(thirdChange);
+  TEST_ASSERT_EQUAL(POWER_SUPPLY_MAINS, test.getState());
+  TEST_ASSERT_EQUAL_STRING("", journal.c_str());
+}
+
+void test_shouldDegradeInOrderAndRestoreInReverseOrder() {
+  // Prepare
+  std::string journal;
+  FakePowerSupplyProbe probe;
+  RecordingPowerProfile display(&journal, 'd'), wifi(&journal, 'w'),
+      buttons(&journal, 'b');
+  PowerStateManager test;
+  test.withProbe(&probe)
+      ->withProfile(&display)
+      ->withProfile(&wifi)
+      ->withProfile(&buttons)
+      ->withConfirmations(1);
+  probe.next = POWER_SUPPLY_MAINS;
+  test.update();
+
+  // Execute
+  probe.next = POWER_SUPPLY_BATTERY;
+  test.update();
+  bool degraded = display.degraded && wifi.degraded && buttons.degraded;
+  probe.next = POWER_SUPPLY_MAINS;
+  test.update();
+
+  // Verify
+  TEST_ASSERT_TRUE(degraded);
+  TEST_ASSERT_FALSE(display.degraded || wifi.degraded || buttons.degraded);
+  TEST_ASSERT_EQUAL_STRING("-d-w-b+b+w+d", journal.c_str());
+  TEST_ASSERT_EQUAL_UINT32(3, test.getTransitionCount());
+}
+
+void test_shouldIgnoreGlitchesOfTheProbe() {
+  // Prepare
+  std::string journal;
+  PowerStateManager test;
+  RecordingPowerProfile display(&journal, 'd');
+  test.withProfile(&display)->withConfirmations(3);
+  test.update(POWER_SUPPLY_MAINS);
+  test.update(POWER_SUPPLY_MAINS);
+  test.update(POWER_SUPPLY_MAINS);
+
+  // Execute
+  PowerSupplyState readings[] = {POWER_SUPPLY_BATTERY, POWER_SUPPLY_BATTERY,
+                                 POWER_SUPPLY_MAINS,   POWER_SUPPLY_BATTERY,
+                                 POWER_SUPPLY_UNKNOWN, POWER_SUPPLY_BATTERY,
+                                 POWER_SUPPLY_BATTERY};
+  for (PowerSupplyState reading : readings) {
+    test.update(reading);
+  }
+  bool onBatteryTooSoon = test.isOnBattery();
+  test.update(POWER_SUPPLY_BATTERY);
+
+  // Verify
+  TEST_ASSERT_FALSE(onBatteryTooSoon);
+  TEST_ASSERT_TRUE(test.isOnBattery());
+  TEST_ASSERT_EQUAL_STRING("-d", journal.c_str());
+}
+
+void test_shouldDegradeProfileRegisteredWhileOnBattery() {
+  // Prepare
+  std::string journal;
+  PowerStateManager test;
+  RecordingPowerProfile display(&journal, 'd'), late(&journal, 'l');
+  test.withProfile(&display)->withConfirmations(1);
+  test.update(POWER_SUPPLY_BATTERY);
+
+  // Execute
+  test.withProfile(&late);
+  test.update(POWER_SUPPLY_MAINS);
+
+  // Verify
+  TEST_ASSERT_EQUAL_STRING("-d-l+l+d", journal.c_str());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldStayNominalWhenStartingOnMains);
+  RUN_TEST(test_shouldDegradeInOrderAndRestoreInReverseOrder);
+  RUN_TEST(test_shouldIgnoreGlitchesOfTheProbe);
+  RUN_TEST(test_shouldDegradeProfileRegisteredWhileOnBattery);
+  UNITY_END();
+}
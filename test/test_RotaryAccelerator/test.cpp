@@ -0,0 +1,140 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "InputSimplist.hpp"
+#include <cstdint>
+#include <unity.h>
+#include <vector>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+// 4 counts per detent, 1 step per detent up to 8 detents per second, 10 steps
+// from 40 detents per second.
+const RotaryProfile PROFILE = {4, 8, 40, 10};
+const uint32_t POLL_MS = 20;
+
+/**
+ * @brief Synthetic counts of a decoder turned at a constant speed, sampled
+ * every 20 ms.
+ */
+std::vector<int32_t> countsAtSpeed(int32_t start, int32_t detentsPerSecond,
+                                   uint32_t durationMs) {
+  std::vector<int32_t> counts;
+  for (uint32_t t = 0; t <= durationMs; t += POLL_MS) {
+    counts.push_back(start + (int32_t)((int64_t)detentsPerSecond *
+                                       PROFILE.countsPerDetent * t / 1000));
+  }
+  return counts;
+}
+
+int32_t feed(RotaryAccelerator *test, std::vector<int32_t> counts) {
+  int32_t steps = 0;
+  for (int32_t count : counts) {
+    steps += test->update(count, POLL_MS);
+  }
+  return steps;
+}
+
+void test_shouldGiveOneStepPerDetentWhenSlow() {
+  // Prepare
+  RotaryAccelerator test(&PROFILE);
+
+  // Execute
+  int32_t steps = feed(&test, countsAtSpeed(0, 5, 2000));
+
+  // Verify
+  TEST_ASSERT_EQUAL_INT32(10, steps);
+  TEST_ASSERT_EQUAL_UINT32(5, test.getSpeed());
+}
+
+void test_shouldAccelerateWhenFast() {
+  // Prepare
+  RotaryAccelerator test(&PROFILE);
+
+  // Execute
+  int32_t steps = feed(&test, countsAtSpeed(0, 50, 1000));
+
+  // Verify
+  // 50 detents, the first ones while the smoothed speed builds up
+  TEST_ASSERT_GREATER_THAN(400, steps);
+  TEST_ASSERT_LESS_OR_EQUAL(500, steps);
+  TEST_ASSERT_EQUAL_UINT32(50, test.getSpeed());
+}
+
+void test_shouldGoBackwardWithNegativeSteps() {
+  // Prepare
+  RotaryAccelerator test(&PROFILE);
+
+  // Execute
+  int32_t steps = feed(&test, countsAtSpeed(1000, -5, 2000));
+
+  // Verify
+  TEST_ASSERT_EQUAL_INT32(-10, steps);
+}
+
+void test_shouldIgnoreJitterAroundADetent() {
+  // Prepare
+  RotaryAccelerator test(&PROFILE);
+  std::vector<int32_t> counts = {8, 9, 8, 7, 8, 9, 10, 9, 8, 7, 6, 7, 8};
+
+  // Execute
+  int32_t steps = feed(&test, counts);
+
+  // Verify
+  TEST_ASSERT_EQUAL_INT32(0, steps);
+}
+
+void test_shouldRestartSlowWhenReversing() {
+  // Prepare
+  RotaryAccelerator test(&PROFILE);
+  feed(&test, countsAtSpeed(0, 50, 500));
+
+  // Execute
+  int32_t steps = test.update(100 - 4, POLL_MS);
+
+  // Verify
+  TEST_ASSERT_EQUAL_INT32(-1, steps);
+}
+
+void test_shouldSurviveTheWrapAroundOfTheCount() {
+  // Prepare
+  RotaryAccelerator test(&PROFILE);
+
+  // Execute
+  int32_t steps = feed(&test, countsAtSpeed(INT32_MAX - 20, 5, 2000));
+
+  // Verify
+  TEST_ASSERT_EQUAL_INT32(10, steps);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldGiveOneStepPerDetentWhenSlow);
+  RUN_TEST(test_shouldAccelerateWhenFast);
+  RUN_TEST(test_shouldGoBackwardWithNegativeSteps);
+  RUN_TEST(test_shouldIgnoreJitterAroundADetent);
+  RUN_TEST(test_shouldRestartSlowWhenReversing);
+  RUN_TEST(test_shouldSurviveTheWrapAroundOfTheCount);
+  UNITY_END();
+}
@@ -0,0 +1,274 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Ntp Simplist'.
+// ---
+// 'Ntp Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Ntp Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Ntp Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "SntpResponder.hpp"
+#include "UdpEndpointUsingSockets.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <sys/time.h>
+#include <thread>
+#include <unity.h>
+#include <vector>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+const int64_t SECOND = 1000000;
+const int64_t SOME_TIME = 1700000000LL * SECOND; // Nov. 2023
+SntpReference dummyReference = {.upstreamStratum = 2,
+                                .referenceId = {192, 168, 1, 1},
+                                .referenceTime = SOME_TIME - 10 * SECOND,
+                                .precision = -20,
+                                .rootDelay = 0x00000200,
+                                .rootDispersion = 0x00000100};
+UdpPeer dummyClient = {.address = {.v4 = {192, 168, 1, 20}}, .port = 12345};
+UdpPeer dummyClient2 = {.address = {.v4 = {192, 168, 1, 21}}, .port = 12345};
+
+int64_t localNow() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (int64_t)tv.tv_sec * SECOND + tv.tv_usec;
+}
+
+size_t makeRequest(uint8_t *packet, int64_t transmit, uint8_t version = 4) {
+  NtpPacketDescription desc;
+  memset(&desc, 0, sizeof(desc));
+  desc.version = version;
+  desc.mode = NTP_MODE_CLIENT;
+  desc.transmitTimestamp = NtpPacket::toNtpTimestamp(transmit);
+  return NtpPacket::encode(&desc, packet);
+}
+
+void test_shouldNotAnswerWhenNotSynchronized() {
+  // Prepare
+  SntpResponder test;
+  uint8_t request[NTP_PACKET_SIZE];
+  uint8_t reply[NTP_PACKET_SIZE];
+  size_t size = makeRequest(request, SOME_TIME);
+
+  // Execute
+  size_t result =
+      test.respond(request, size, &dummyClient, SOME_TIME, SOME_TIME, reply);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(0, result);
+  TEST_ASSERT_EQUAL_UINT32(1, test.getDroppedCount());
+}
+
+void test_shouldAnswerAsNextStratumEchoingRequest() {
+  // Prepare
+  SntpResponder test;
+  test.updateReference(&dummyReference);
+  uint8_t request[NTP_PACKET_SIZE];
+  uint8_t reply[NTP_PACKET_SIZE];
+  size_t size = makeRequest(request, SOME_TIME - 5 * SECOND, 3);
+
+  // Execute
+  size_t result = test.respond(request, size, &dummyClient, SOME_TIME,
+                               SOME_TIME + 20, reply);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(NTP_PACKET_SIZE, result);
+  NtpPacketDescription desc;
+  NtpPacket::decode(reply, result, &desc);
+  TEST_ASSERT_EQUAL_INT(NTP_MODE_SERVER, desc.mode);
+  TEST_ASSERT_EQUAL_UINT8(3, desc.version);
+  TEST_ASSERT_EQUAL_UINT8(3, desc.stratum);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(dummyReference.referenceId, desc.referenceId,
+                                4);
+  TEST_ASSERT_EQUAL_MEMORY(request + NTP_OFFSET_TRANSMIT_TIMESTAMP,
+                           reply + NTP_OFFSET_ORIGIN_TIMESTAMP, 8);
+  TEST_ASSERT_INT64_WITHIN(1, SOME_TIME,
+                           NtpPacket::toUnixMicros(&desc.receiveTimestamp));
+  TEST_ASSERT_INT64_WITHIN(1, SOME_TIME + 20,
+                           NtpPacket::toUnixMicros(&desc.transmitTimestamp));
+}
+
+void test_shouldIgnoreNonClientPackets() {
+  // Prepare
+  SntpResponder test;
+  test.updateReference(&dummyReference);
+  uint8_t request[NTP_PACKET_SIZE];
+  uint8_t reply[NTP_PACKET_SIZE];
+  size_t size = makeRequest(request, SOME_TIME);
+  request[0] = (request[0] & 0xf8) | NTP_MODE_SERVER;
+
+  // Execute & Verify
+  TEST_ASSERT_EQUAL_UINT32(0, test.respond(request, size, &dummyClient,
+                                           SOME_TIME, SOME_TIME, reply));
+  TEST_ASSERT_EQUAL_UINT32(0, test.respond(request, size - 1, &dummyClient,
+                                           SOME_TIME, SOME_TIME, reply));
+}
+
+void test_shouldKissOffGreedyClientOnly() {
+  // Prepare : burst of 2, then one request every second
+  NtpRateLimiter limiter(1000, 1000, SECOND, 2);
+  SntpResponder test(&limiter);
+  test.updateReference(&dummyReference);
+  uint8_t request[NTP_PACKET_SIZE];
+  uint8_t reply[NTP_PACKET_SIZE];
+  size_t size = makeRequest(request, SOME_TIME);
+
+  // Execute & Verify
+  TEST_ASSERT_EQUAL_UINT32(NTP_PACKET_SIZE,
+                           test.respond(request, size, &dummyClient, SOME_TIME,
+                                        SOME_TIME, reply));
+  TEST_ASSERT_EQUAL_UINT32(NTP_PACKET_SIZE,
+                           test.respond(request, size, &dummyClient, SOME_TIME,
+                                        SOME_TIME, reply));
+  TEST_ASSERT_EQUAL_UINT32(NTP_PACKET_SIZE,
+                           test.respond(request, size, &dummyClient, SOME_TIME,
+                                        SOME_TIME, reply));
+  NtpPacketDescription desc;
+  NtpPacket::decode(reply, NTP_PACKET_SIZE, &desc);
+  TEST_ASSERT_EQUAL_UINT8(0, desc.stratum);
+  TEST_ASSERT_EQUAL_INT(NTP_LEAP_ALARM, desc.leapIndicator);
+  TEST_ASSERT_EQUAL_MEMORY("RATE", desc.referenceId, 4);
+  // another client is not impacted
+  test.respond(request, size, &dummyClient2, SOME_TIME, SOME_TIME, reply);
+  NtpPacket::decode(reply, NTP_PACKET_SIZE, &desc);
+  TEST_ASSERT_EQUAL_UINT8(3, desc.stratum);
+  // the greedy client is served again after waiting
+  test.respond(request, size, &dummyClient, SOME_TIME + SECOND,
+               SOME_TIME + SECOND, reply);
+  NtpPacket::decode(reply, NTP_PACKET_SIZE, &desc);
+  TEST_ASSERT_EQUAL_UINT8(3, desc.stratum);
+  TEST_ASSERT_EQUAL_UINT32(4, test.getAnsweredCount());
+  TEST_ASSERT_EQUAL_UINT32(1, test.getKissedCount());
+}
+
+void test_shouldDropWhenGloballyOverloaded() {
+  // Prepare : 10 replies per second, burst of 5
+  NtpRateLimiter limiter(10, 5, SECOND, 100);
+  SntpResponder test(&limiter);
+  test.updateReference(&dummyReference);
+  uint8_t request[NTP_PACKET_SIZE];
+  uint8_t reply[NTP_PACKET_SIZE];
+  size_t size = makeRequest(request, SOME_TIME);
+
+  // Execute
+  for (int i = 0; i < 20; i++) {
+    test.respond(request, size, &dummyClient, SOME_TIME, SOME_TIME, reply);
+  }
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(5, test.getAnsweredCount());
+  TEST_ASSERT_EQUAL_UINT32(15, test.getDroppedCount());
+}
+
+/**
+ * @brief The loop that the clock would run, on the loopback interface.
+ */
+void runResponder(UdpEndpointUsingSockets *server, SntpResponder *responder,
+                  std::atomic<bool> *running) {
+  uint8_t request[NTP_PACKET_SIZE];
+  uint8_t reply[NTP_PACKET_SIZE];
+  UdpPeer client;
+  while (*running) {
+    int received =
+        server->receiveFrom(request, sizeof(request), &client, 100);
+    if (received <= 0) {
+      continue;
+    }
+    int64_t receivedAt = localNow();
+    size_t size = responder->respond(request, received, &client, receivedAt,
+                                     localNow(), reply);
+    if (size > 0) {
+      server->sendTo(&client, reply, size);
+    }
+  }
+}
+
+/**
+ * @brief Stand-in client sending bursts of queries, reports throughput and
+ * round trip latency.
+ */
+void test_shouldSustainBurstsOfQueries() {
+  // Prepare
+  const int BURSTS = 50;
+  const int BURST_SIZE = 32;
+  NtpRateLimiter limiter(1000000, 1000000, 0, 1000000);
+  SntpResponder responder(&limiter);
+  dummyReference.referenceTime = localNow();
+  responder.updateReference(&dummyReference);
+  UdpEndpointUsingSockets server;
+  UdpEndpointUsingSockets client;
+  TEST_ASSERT_TRUE(server.open(0, false));
+  TEST_ASSERT_TRUE(client.open(0, false));
+  UdpPeer serverPeer = {.address = {.v4 = {127, 0, 0, 1}},
+                        .port = server.getLocalPort()};
+  std::atomic<bool> running(true);
+  std::thread serverThread(runResponder, &server, &responder, &running);
+  uint8_t request[NTP_PACKET_SIZE];
+  uint8_t reply[NTP_PACKET_SIZE];
+  std::vector<int64_t> latencies;
+  int answers = 0;
+
+  // Execute
+  int64_t start = localNow();
+  for (int burst = 0; burst < BURSTS; burst++) {
+    for (int i = 0; i < BURST_SIZE; i++) {
+      size_t size = makeRequest(request, localNow());
+      client.sendTo(&serverPeer, request, size);
+    }
+    int received;
+    while (answers < (burst + 1) * BURST_SIZE &&
+           (received = client.receiveFrom(reply, sizeof(reply), nullptr,
+                                          200)) > 0) {
+      int64_t now = localNow();
+      NtpPacketDescription desc;
+      NtpPacket::decode(reply, received, &desc);
+      latencies.push_back(now - NtpPacket::toUnixMicros(&desc.originTimestamp));
+      ++answers;
+    }
+  }
+  int64_t elapsed = localNow() - start;
+  running = false;
+  serverThread.join();
+
+  // Verify
+  TEST_ASSERT_EQUAL_INT(BURSTS * BURST_SIZE, answers);
+  std::sort(latencies.begin(), latencies.end());
+  char message[160];
+  snprintf(message, sizeof(message),
+           "%d replies in %lld us : %lld replies/s ; round trip p50 %lld us, "
+           "p99 %lld us, max %lld us",
+           answers, (long long)elapsed,
+           (long long)(answers * SECOND / (elapsed > 0 ? elapsed : 1)),
+           (long long)latencies[latencies.size() / 2],
+           (long long)latencies[latencies.size() * 99 / 100],
+           (long long)latencies.back());
+  TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldNotAnswerWhenNotSynchronized);
+  RUN_TEST(test_shouldAnswerAsNextStratumEchoingRequest);
+  RUN_TEST(test_shouldIgnoreNonClientPackets);
+  RUN_TEST(test_shouldKissOffGreedyClientOnly);
+  RUN_TEST(test_shouldDropWhenGloballyOverloaded);
+  RUN_TEST(test_shouldSustainBurstsOfQueries);
+  UNITY_END();
+}
@@ -0,0 +1,90 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist'.
+// ---
+// 'Scheduler Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "SchedulerSimplist.hpp"
+#include <unity.h>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+void test_shouldComputeTheShareSinceThePreviousSampling() {
+  // Prepare
+  TaskUsageTracker tracker(2);
+  TaskSample first[] = {{1, "display", 1000, 512, 10},
+                        {2, "idle", 3000, 1024, 0}};
+  TaskSample second[] = {{1, "display", 1500, 480, 25},
+                         {2, "idle", 5500, 1024, 0}};
+  TaskUsage usages[2];
+  tracker.update(first, 2, 2000, usages);
+
+  // Execute
+  uint8_t count = tracker.update(second, 2, 3500, usages);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT8(2, count);
+  TEST_ASSERT_EQUAL_UINT32(166, usages[0].cpuPermille); // 500 / (1500 * 2)
+  TEST_ASSERT_EQUAL_UINT32(833, usages[1].cpuPermille);
+  TEST_ASSERT_EQUAL_UINT32(480, usages[0].stackFree);
+  TEST_ASSERT_EQUAL_UINT32(15, usages[0].wakeUps);
+}
+
+void test_shouldSupportWrappingCounters() {
+  // Prepare
+  TaskUsageTracker tracker;
+  TaskSample first[] = {{1, "clock", UINT32_MAX - 99, 512, UINT32_MAX}};
+  TaskSample second[] = {{1, "clock", 100, 512, 4}};
+  TaskUsage usages[1];
+  tracker.update(first, 1, UINT32_MAX - 199, usages);
+
+  // Execute
+  tracker.update(second, 1, 200, usages);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(500, usages[0].cpuPermille); // 200 / 400
+  TEST_ASSERT_EQUAL_UINT32(5, usages[0].wakeUps);
+}
+
+void test_shouldCompareANewTaskToItsStart() {
+  // Prepare
+  TaskUsageTracker tracker;
+  TaskSample first[] = {{1, "clock", 100, 512, 1}};
+  TaskSample second[] = {{1, "clock", 200, 512, 2}, {7, "sntp", 300, 256, 3}};
+  TaskUsage usages[2];
+  tracker.update(first, 1, 1000, usages);
+
+  // Execute
+  tracker.update(second, 2, 2000, usages);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(100, usages[0].cpuPermille);
+  TEST_ASSERT_EQUAL_UINT32(300, usages[1].cpuPermille);
+  TEST_ASSERT_EQUAL_UINT32(3, usages[1].wakeUps);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldComputeTheShareSinceThePreviousSampling);
+  RUN_TEST(test_shouldSupportWrappingCounters);
+  RUN_TEST(test_shouldCompareANewTaskToItsStart);
+  UNITY_END();
+}
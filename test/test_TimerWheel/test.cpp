@@ -0,0 +1,164 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Scheduler Simplist'.
+// ---
+// 'Scheduler Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Scheduler Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Scheduler Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "SchedulerSimplist.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <unity.h>
+#include <vector>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+class RecordingJob : public TimerJob {
+public:
+  std::vector<uint64_t> runs;
+  TimerWheel *wheel = nullptr;
+  TimerJob *toCancel = nullptr;
+  virtual void onTimer(uint64_t now) {
+    runs.push_back(now);
+    if (nullptr != toCancel) {
+      wheel->cancel(toCancel);
+    }
+  }
+};
+
+void test_shouldRunOneShotJobsAtTheirDeadline() {
+  // Prepare
+  TimerWheel test;
+  RecordingJob soon, later, muchLater, beyondRange;
+  test.schedule(&soon, 5);
+  test.schedule(&later, 1000);
+  test.schedule(&muchLater, 300000);
+  test.schedule(&beyondRange, 20000000); // more than 64^4 ticks
+
+  // Execute & Verify
+  TEST_ASSERT_EQUAL_UINT64(5, test.getNextDeadline());
+  test.advance(4);
+  TEST_ASSERT_EQUAL_UINT32(0, soon.runs.size());
+  test.advance(5000);
+  TEST_ASSERT_EQUAL_UINT32(1, soon.runs.size());
+  TEST_ASSERT_EQUAL_UINT64(5, soon.runs[0]);
+  TEST_ASSERT_EQUAL_UINT64(1000, later.runs[0]);
+  TEST_ASSERT_EQUAL_UINT64(300000, test.getNextDeadline());
+  test.advance(25000000);
+  TEST_ASSERT_EQUAL_UINT64(300000, muchLater.runs[0]);
+  TEST_ASSERT_EQUAL_UINT32(1, beyondRange.runs.size());
+  TEST_ASSERT_EQUAL_UINT64(20000000, beyondRange.runs[0]);
+  TEST_ASSERT_EQUAL_UINT32(0, test.getJobCount());
+  TEST_ASSERT_EQUAL_UINT64(TIMER_WHEEL_NEVER, test.getNextDeadline());
+}
+
+void test_shouldRunPeriodicJobsKeepingTheirPhase() {
+  // Prepare
+  TimerWheel test;
+  RecordingJob job;
+  test.schedule(&job, 3, 10);
+
+  // Execute
+  while (test.getNextDeadline() <= 50) {
+    test.advance(test.getNextDeadline());
+  }
+  test.advance(1000); // late : runs once, the missed runs are skipped
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(6, job.runs.size());
+  TEST_ASSERT_EQUAL_UINT64(43, job.runs[4]);
+  TEST_ASSERT_EQUAL_UINT64(53, job.runs[5]);
+  TEST_ASSERT_EQUAL_UINT64(1003, test.getNextDeadline());
+}
+
+void test_shouldCancelJobs() {
+  // Prepare
+  TimerWheel test;
+  RecordingJob first, second, third;
+  test.schedule(&first, 10);
+  test.schedule(&second, 10);
+  test.schedule(&third, 20);
+  first.wheel = &test;
+  first.toCancel = &second; // same tick, already detached
+  second.wheel = &test;
+  second.toCancel = &first;
+
+  // Execute
+  test.cancel(&third);
+  test.advance(100);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(1, first.runs.size() + second.runs.size());
+  TEST_ASSERT_EQUAL_UINT32(0, third.runs.size());
+  TEST_ASSERT_FALSE(third.isScheduled());
+  TEST_ASSERT_EQUAL_UINT32(0, test.getJobCount());
+}
+
+void test_shouldMatchAReferenceScheduler() {
+  // Prepare : random jobs, checked against their expected run ticks
+  srand(1234);
+  const int JOB_COUNT = 500;
+  const uint64_t END = 1000000;
+  TimerWheel test;
+  std::vector<RecordingJob> jobs(JOB_COUNT);
+  std::vector<uint64_t> delays(JOB_COUNT);
+  std::vector<uint64_t> periods(JOB_COUNT);
+  uint64_t expectedRuns = 0;
+  for (int i = 0; i < JOB_COUNT; i++) {
+    delays[i] = 1 + rand() % 200000;
+    periods[i] = 0 == i % 3 ? 0 : 1 + rand() % 50000;
+    test.schedule(&jobs[i], delays[i], periods[i]);
+    if (delays[i] <= END) {
+      expectedRuns += 0 == periods[i] ? 1 : 1 + (END - delays[i]) / periods[i];
+    }
+  }
+
+  // Execute : sleep from deadline to deadline
+  uint32_t wakeUps = 0;
+  auto start = std::chrono::steady_clock::now();
+  while (test.getNextDeadline() <= END) {
+    test.advance(test.getNextDeadline());
+    ++wakeUps;
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(expectedRuns, test.getRunCount());
+  for (int i = 0; i < JOB_COUNT; i++) {
+    for (size_t run = 0; run < jobs[i].runs.size(); run++) {
+      TEST_ASSERT_EQUAL_UINT64(delays[i] + run * periods[i], jobs[i].runs[run]);
+    }
+  }
+  char message[100];
+  snprintf(message, sizeof(message), "%u runs, %u wake ups, %lld us",
+           (unsigned)test.getRunCount(), (unsigned)wakeUps, (long long)elapsed);
+  TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldRunOneShotJobsAtTheirDeadline);
+  RUN_TEST(test_shouldRunPeriodicJobsKeepingTheirPhase);
+  RUN_TEST(test_shouldCancelJobs);
+  RUN_TEST(test_shouldMatchAReferenceScheduler);
+  UNITY_END();
+}
@@ -0,0 +1,204 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Input Simplist'.
+// ---
+// 'Input Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Input Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Input Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "InputSimplist.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <unity.h>
+#include <vector>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+const uint8_t PINS[] = {15, 16, 17, 18, 34, 35, 36, 39};
+const uint8_t PIN_COUNT = sizeof(PINS) / sizeof(PINS[0]);
+
+uint64_t maskOfPins() {
+  uint64_t mask = 0;
+  for (uint8_t i = 0; i < PIN_COUNT; i++) {
+    mask |= 1ULL << PINS[i];
+  }
+  return mask;
+}
+
+struct Change {
+  uint32_t sample;
+  uint8_t pin;
+  bool high;
+  bool operator==(const Change &other) const {
+    return sample == other.sample && pin == other.pin && high == other.high;
+  }
+};
+
+/**
+ * @brief The per button path : one read of the input per button, and a
+ * debouncer per button accepting a level after 4 identical samples.
+ */
+class PerButtonDebouncer {
+public:
+  uint8_t pin;
+  bool state = true;
+  uint8_t history = 0xf;
+  PerButtonDebouncer(uint8_t pin) : pin(pin) {}
+  bool update(bool level) {
+    history = ((history << 1) | (level ? 1 : 0)) & 0xf;
+    if ((0xf == history && !state) || (0 == history && state)) {
+      state = !state;
+      return true;
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief Reads one input of the sample, not inlined like a driver call.
+ */
+__attribute__((noinline)) bool readPin(const uint64_t *registers,
+                                       uint8_t pin) {
+  return 0 != (*registers & (1ULL << pin));
+}
+
+/**
+ * @brief Simulate buttons bouncing for a few samples at each press and
+ * release, and some isolated glitches.
+ */
+std::vector<uint64_t> simulateSamples(uint32_t count, unsigned seed) {
+  srand(seed);
+  std::vector<uint64_t> samples;
+  uint64_t levels = ~0ULL;
+  uint8_t bouncing[64] = {0};
+  for (uint32_t i = 0; i < count; i++) {
+    uint64_t sample = levels;
+    for (uint8_t p = 0; p < PIN_COUNT; p++) {
+      uint8_t pin = PINS[p];
+      if (0 < bouncing[pin]) {
+        --bouncing[pin];
+        if (rand() % 2) {
+          sample ^= 1ULL << pin;
+        }
+      } else if (0 == rand() % 200) {
+        levels ^= 1ULL << pin; // press or release
+        sample ^= 1ULL << pin;
+        bouncing[pin] = rand() % 6;
+      } else if (0 == rand() % 500) {
+        sample ^= 1ULL << pin; // glitch
+      }
+    }
+    samples.push_back(sample);
+  }
+  return samples;
+}
+
+void test_shouldToggleAfterFourIdenticalSamples() {
+  // Prepare
+  VerticalCounterDebouncer test(0b1111, 0b1111);
+  uint64_t samples[] = {0b1110, 0b1110, 0b1111, 0b1110,
+                        0b1110, 0b1110, 0b1110, 0b1110};
+  uint64_t expected[] = {0, 0, 0, 0, 0, 0, 0b0001, 0};
+
+  // Execute & Verify
+  for (uint8_t i = 0; i < 8; i++) {
+    TEST_ASSERT_EQUAL_UINT64(expected[i], test.update(samples[i]));
+  }
+  TEST_ASSERT_EQUAL_UINT64(0b1110, test.getState());
+  TEST_ASSERT_FALSE(test.isHigh(0));
+}
+
+void test_shouldIgnoreBitsOutsideOfTheMask() {
+  // Prepare
+  VerticalCounterDebouncer test(0b0101, 0b0101);
+
+  // Execute
+  uint64_t toggled = 0;
+  for (uint8_t i = 0; i < 8; i++) {
+    toggled |= test.update(0b1010);
+  }
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT64(0b0101, toggled);
+  TEST_ASSERT_EQUAL_UINT64(0, test.getState());
+}
+
+void test_shouldMatchThePerButtonPath() {
+  // Prepare
+  const uint32_t SAMPLE_COUNT = 200000;
+  std::vector<uint64_t> samples = simulateSamples(SAMPLE_COUNT, 1234);
+  std::vector<PerButtonDebouncer> perButton;
+  for (uint8_t p = 0; p < PIN_COUNT; p++) {
+    perButton.push_back(PerButtonDebouncer(PINS[p]));
+  }
+  VerticalCounterDebouncer vertical(maskOfPins(), ~0ULL);
+  std::vector<Change> changesPerButton, changesVertical;
+  changesPerButton.reserve(SAMPLE_COUNT);
+  changesVertical.reserve(SAMPLE_COUNT);
+
+  // Execute
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < SAMPLE_COUNT; i++) {
+    for (PerButtonDebouncer &button : perButton) {
+      if (button.update(readPin(&samples[i], button.pin))) {
+        changesPerButton.push_back({i, button.pin, button.state});
+      }
+    }
+  }
+  auto middle = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < SAMPLE_COUNT; i++) {
+    uint64_t toggled = vertical.update(samples[i]);
+    while (0 != toggled) {
+      uint8_t pin = __builtin_ctzll(toggled);
+      changesVertical.push_back({i, pin, vertical.isHigh(pin)});
+      toggled &= toggled - 1;
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  auto elapsedPerButton =
+      std::chrono::duration_cast<std::chrono::microseconds>(middle - start)
+          .count();
+  auto elapsedVertical =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - middle)
+          .count();
+
+  // Verify
+  TEST_ASSERT_TRUE(0 < changesVertical.size());
+  TEST_ASSERT_EQUAL_UINT32(changesPerButton.size(), changesVertical.size());
+  for (size_t i = 0; i < changesVertical.size(); i++) {
+    TEST_ASSERT_TRUE(changesPerButton[i] == changesVertical[i]);
+  }
+  char message[120];
+  snprintf(message, sizeof(message),
+           "%u samples of %u buttons, %u changes : per button %lld us, "
+           "vertical %lld us",
+           (unsigned)SAMPLE_COUNT, (unsigned)PIN_COUNT,
+           (unsigned)changesVertical.size(), (long long)elapsedPerButton,
+           (long long)elapsedVertical);
+  TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldToggleAfterFourIdenticalSamples);
+  RUN_TEST(test_shouldIgnoreBitsOutsideOfTheMask);
+  RUN_TEST(test_shouldMatchThePerButtonPath);
+  UNITY_END();
+}
@@ -0,0 +1,144 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Wifi Simplist'.
+// ---
+// 'Wifi Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Wifi Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Wifi Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "WifiAccessPointSelector.hpp"
+#include <cstring>
+#include <unity.h>
+
+uint8_t dummySsid[MAX_LENGTH_OF_SSID] = "The dummy ssid";
+uint8_t dummySsid2[MAX_LENGTH_OF_SSID] = "The dummy ssid - 2";
+uint8_t dummySsid3[MAX_LENGTH_OF_SSID] = "The dummy ssid - 3";
+uint8_t dummyKey[MAX_LENGTH_OF_KEYPASS] = "One dummy key pass";
+
+static WifiScannedAccessPoint scannedOf(const uint8_t *ssid, uint8_t last,
+                                        int8_t rssi) {
+  WifiScannedAccessPoint result = {};
+  memcpy(result.ssid, ssid, MAX_LENGTH_OF_SSID);
+  result.bssid[5] = last;
+  result.channel = last;
+  result.rssi = rssi;
+  return result;
+}
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+void test_shouldSkipTheAbsentAndUnknownNetworks() {
+  // Prepare
+  WifiCredentials wc1(dummySsid, dummyKey, PRESHAREDKEY);
+  WifiCredentials wc2(dummySsid2, dummyKey, PRESHAREDKEY);
+  WifiCredentialsRegistry registry;
+  registry.put(&wc2);
+  registry.put(&wc1); // wc1 first, absent
+  uint8_t unknownSsid[MAX_LENGTH_OF_SSID] = "The neighbour";
+  WifiScannedAccessPoint scanned[] = {scannedOf(unknownSsid, 1, -40),
+                                      scannedOf(dummySsid2, 6, -70)};
+  WifiAccessPointSelector test;
+
+  // Execute
+  uint8_t count = test.select(&registry, scanned, 2);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT8(1, count);
+  WifiCandidate *candidate = test.next();
+  TEST_ASSERT_TRUE(wc2.isSameSsid(candidate->credentials));
+  TEST_ASSERT_EQUAL_UINT8(1, candidate->rank);
+  TEST_ASSERT_EQUAL_UINT8(6, candidate->accessPoint.channel);
+  TEST_ASSERT_FALSE(test.hasNext());
+}
+
+void test_shouldOrderBySignalLoweredByRank() {
+  // Prepare
+  WifiCredentials wc1(dummySsid, dummyKey, PRESHAREDKEY);
+  WifiCredentials wc2(dummySsid2, dummyKey, PRESHAREDKEY);
+  WifiCredentials wc3(dummySsid3, dummyKey, PRESHAREDKEY);
+  WifiCredentialsRegistry registry;
+  registry.put(&wc3);
+  registry.put(&wc2);
+  registry.put(&wc1); // ranks : wc1, wc2, wc3
+  WifiScannedAccessPoint scanned[] = {
+      scannedOf(dummySsid, 1, -80),  // score -80
+      scannedOf(dummySsid2, 2, -65), // score -75, strong enough
+      scannedOf(dummySsid3, 3, -62), // score -82, not strong enough
+      scannedOf(dummySsid, 4, -95),  // too weak
+  };
+  WifiAccessPointSelector test(-90, 10);
+
+  // Execute
+  uint8_t count = test.select(&registry, scanned, 4);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT8(3, count);
+  TEST_ASSERT_EQUAL_UINT8(2, test.next()->accessPoint.channel);
+  TEST_ASSERT_EQUAL_UINT8(1, test.next()->accessPoint.channel);
+  TEST_ASSERT_EQUAL_UINT8(3, test.next()->accessPoint.channel);
+  TEST_ASSERT_NULL(test.next());
+}
+
+void test_shouldPreferTheBetterRankedNetworkOnATie() {
+  // Prepare
+  WifiCredentials wc1(dummySsid, dummyKey, PRESHAREDKEY);
+  WifiCredentials wc2(dummySsid2, dummyKey, PRESHAREDKEY);
+  WifiCredentialsRegistry registry;
+  registry.put(&wc2);
+  registry.put(&wc1);
+  WifiScannedAccessPoint scanned[] = {scannedOf(dummySsid2, 2, -60),
+                                      scannedOf(dummySsid, 1, -70)};
+  WifiAccessPointSelector test(-90, 10);
+
+  // Execute
+  test.select(&registry, scanned, 2);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT8(1, test.next()->accessPoint.channel);
+  TEST_ASSERT_EQUAL_UINT8(2, test.next()->accessPoint.channel);
+}
+
+void test_shouldSkipTheAccessPointAlreadyTried() {
+  // Prepare
+  WifiCredentials wc1(dummySsid, dummyKey, PRESHAREDKEY);
+  WifiCredentialsRegistry registry;
+  registry.put(&wc1);
+  WifiCredentials *tried = registry.rewind()->next();
+  uint8_t bssid[LENGTH_OF_BSSID] = {0, 0, 0, 0, 0, 1};
+  tried->setAccessPoint(bssid, 1, 0);
+  WifiScannedAccessPoint scanned[] = {scannedOf(dummySsid, 1, -50),
+                                      scannedOf(dummySsid, 2, -70)};
+  WifiAccessPointSelector test;
+
+  // Execute
+  uint8_t count = test.select(&registry, scanned, 2, tried);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT8(1, count);
+  TEST_ASSERT_EQUAL_UINT8(2, test.next()->accessPoint.channel);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldSkipTheAbsentAndUnknownNetworks);
+  RUN_TEST(test_shouldOrderBySignalLoweredByRank);
+  RUN_TEST(test_shouldPreferTheBetterRankedNetworkOnATie);
+  RUN_TEST(test_shouldSkipTheAccessPointAlreadyTried);
+  UNITY_END();
+}
@@ -30,6 +30,7 @@ void tearDown(void) {}
 uint8_t dummySsid[MAX_LENGTH_OF_SSID] = "The dummy ssid";
 uint8_t dummyKey[MAX_LENGTH_OF_KEYPASS] = "One dummy key pass";
 uint8_t dummyKey2[MAX_LENGTH_OF_KEYPASS] = "Another dummy key pass";
+uint8_t dummyBssid[LENGTH_OF_BSSID] = {0x02, 0x11, 0x22, 0x33, 0x44, 0x55};
 
 bool shouldHaveSameRank(WifiCredentials *wc1, WifiCredentials *wc2) {
   return false == (WifiCredentials::compareByRank(wc1, wc2) ||
@@ -132,11 +133,36 @@ void test_changeOfKey() {
   TEST_ASSERT_TRUE(dummyKey2 != test.getKey());
 }
 
+void test_shouldCopyTheAccessPointOnlyWhenKnown() {
+  // Prepare
+  WifiCredentials test(dummySsid, dummyKey, WifiKeyType::PASSWORD);
+  WifiCredentials seen(dummySsid, dummyKey, WifiKeyType::PASSWORD);
+  WifiCredentials unseen(dummySsid, dummyKey, WifiKeyType::PASSWORD);
+  seen.setAccessPoint(dummyBssid, 6, 3);
+
+  // Execute
+  bool fromUnseen = test.copyAccessPointFrom(&unseen);
+  bool fromSeen = test.copyAccessPointFrom(&seen);
+  bool again = test.copyAccessPointFrom(&seen);
+  WifiCredentials copy(test);
+
+  // Verify
+  TEST_ASSERT_FALSE(unseen.hasAccessPoint());
+  TEST_ASSERT_FALSE(fromUnseen);
+  TEST_ASSERT_TRUE(fromSeen);
+  TEST_ASSERT_FALSE(again);
+  TEST_ASSERT_TRUE(copy.hasAccessPoint());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(dummyBssid, copy.getBssid(), LENGTH_OF_BSSID);
+  TEST_ASSERT_EQUAL_UINT8(6, copy.getChannel());
+  TEST_ASSERT_EQUAL_UINT8(3, copy.getAuthMode());
+}
+
 int main(int argc, char **argv) {
   UNITY_BEGIN();
   RUN_TEST(test_simpleConstructor);
   RUN_TEST(test_copyConstructor);
   RUN_TEST(test_rankManagementAndComparison);
   RUN_TEST(test_changeOfKey);
+  RUN_TEST(test_shouldCopyTheAccessPointOnlyWhenKnown);
   UNITY_END();
 }
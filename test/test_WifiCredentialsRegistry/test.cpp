@@ -22,6 +22,7 @@ uint8_t dummySsid2[MAX_LENGTH_OF_SSID] = "The dummy ssid - 2";
 uint8_t dummySsid3[MAX_LENGTH_OF_SSID] = "The dummy ssid - 3";
 uint8_t dummySsid4[MAX_LENGTH_OF_SSID] = "The dummy ssid - 4";
 uint8_t dummyKey[MAX_LENGTH_OF_KEYPASS] = "One dummy key pass";
+uint8_t dummyBssid[LENGTH_OF_BSSID] = {0x02, 0x11, 0x22, 0x33, 0x44, 0x55};
 
 /**
  * @brief Before test
@@ -194,6 +195,30 @@ void test_shouldRemoveSpecifiedCredentials() {
   TEST_ASSERT_FALSE(test.hasNext());
 }
 
+void test_shouldRecordTheAccessPointWithSetPreferredAndKeepItOnUpdate() {
+  // Prepare
+  WifiCredentials wc1(dummySsid, dummyKey, PRESHAREDKEY);
+  WifiCredentials wc2(dummySsid2, dummyKey, PRESHAREDKEY);
+  WifiCredentialsRegistry test;
+  test.put(&wc1);
+  test.put(&wc2);
+  WifiCredentials connected(wc1);
+  connected.setAccessPoint(dummyBssid, 11, 3);
+
+  // Execute
+  test.setPreferred(&connected);
+  test.put(&wc1); // e.g. the same network given again by wps
+
+  // Verify
+  WifiCredentials *creds = test.rewind()->next();
+  TEST_ASSERT_TRUE(wc1.isSameSsid(creds));
+  TEST_ASSERT_TRUE(creds->hasAccessPoint());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(dummyBssid, creds->getBssid(),
+                                LENGTH_OF_BSSID);
+  TEST_ASSERT_EQUAL_UINT8(11, creds->getChannel());
+  TEST_ASSERT_FALSE(test.next()->hasAccessPoint());
+}
+
 int main(int argc, char **argv) {
   UNITY_BEGIN();
   RUN_TEST(test_shouldBeEmptyAfterCreation);
@@ -203,5 +228,6 @@ int main(int argc, char **argv) {
   RUN_TEST(test_shouldChangeOrderWithSetPreferred);
   RUN_TEST(test_shouldReturnToBeginningOfSequenceWithRewind);
   RUN_TEST(test_shouldRemoveSpecifiedCredentials);
+  RUN_TEST(test_shouldRecordTheAccessPointWithSetPreferredAndKeepItOnUpdate);
   UNITY_END();
 }
@@ -0,0 +1,115 @@
+// Copyright 2023 David SPORN
+// ---
+// This file is part of 'Wifi Simplist'.
+// ---
+// 'Wifi Simplist' is free software: you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// 'Wifi Simplist' is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+// Public License for more details.
+
+// You should have received a copy of the GNU General Public License along
+// with 'Wifi Simplist'. If not, see <https://www.gnu.org/licenses/>. 
+#include "WifiReconnectBackoff.hpp"
+#include <unity.h>
+
+/**
+ * @brief Before test
+ */
+void setUp(void) {}
+
+/**
+ * @brief After test.
+ */
+void tearDown(void) {}
+
+void test_shouldDoubleTheDelayUpToTheCap() {
+  // Prepare
+  WifiReconnectBackoff test(1000, 5000, 0);
+  test.onLinkLost(0);
+
+  // Execute
+  uint32_t delays[5];
+  for (int i = 0; i < 5; i++) {
+    delays[i] = test.nextDelayMs(12345);
+  }
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(1000, delays[0]);
+  TEST_ASSERT_EQUAL_UINT32(2000, delays[1]);
+  TEST_ASSERT_EQUAL_UINT32(4000, delays[2]);
+  TEST_ASSERT_EQUAL_UINT32(5000, delays[3]);
+  TEST_ASSERT_EQUAL_UINT32(5000, delays[4]);
+  TEST_ASSERT_EQUAL_UINT16(5, test.getAttempts());
+}
+
+void test_shouldSpreadTheDelayWithinTheJitter() {
+  // Prepare
+  WifiReconnectBackoff test(1000, 5000, 25);
+  test.onLinkLost(0);
+
+  // Execute
+  uint32_t lowest = test.nextDelayMs(0);
+  test.onConnected(1);
+  test.onLinkLost(2);
+  uint32_t highest = test.nextDelayMs(500);
+
+  // Verify
+  TEST_ASSERT_EQUAL_UINT32(750, lowest);
+  TEST_ASSERT_EQUAL_UINT32(1250, highest);
+}
+
+void test_shouldTryWpsEveryGivenAttempts() {
+  // Prepare
+  WifiReconnectBackoff test(1000, 5000, 0, 3);
+  test.onLinkLost(0);
+
+  // Execute
+  bool wps[6];
+  for (int i = 0; i < 6; i++) {
+    test.nextDelayMs(0);
+    wps[i] = test.isWpsAttempt();
+  }
+
+  // Verify
+  TEST_ASSERT_FALSE(wps[0]);
+  TEST_ASSERT_FALSE(wps[1]);
+  TEST_ASSERT_TRUE(wps[2]);
+  TEST_ASSERT_FALSE(wps[3]);
+  TEST_ASSERT_FALSE(wps[4]);
+  TEST_ASSERT_TRUE(wps[5]);
+}
+
+void test_shouldMeasureTheTimeToRecover() {
+  // Prepare
+  WifiReconnectBackoff test;
+  test.onLinkLost(1000000);
+  test.nextDelayMs(0);
+  test.onLinkLost(2000000); // still the same recovery
+  test.nextDelayMs(0);
+
+  // Execute
+  bool recovered = test.onConnected(7500000);
+
+  // Verify
+  TEST_ASSERT_TRUE(recovered);
+  TEST_ASSERT_FALSE(test.isRecovering());
+  TEST_ASSERT_EQUAL_INT64(6500000, test.getLastTimeToRecover());
+  TEST_ASSERT_EQUAL_UINT16(2, test.getAttempts());
+  TEST_ASSERT_EQUAL_UINT32(2, test.getTotalAttempts());
+  TEST_ASSERT_EQUAL_UINT32(1, test.getRecoveryCount());
+  TEST_ASSERT_FALSE(test.onConnected(8000000));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_shouldDoubleTheDelayUpToTheCap);
+  RUN_TEST(test_shouldSpreadTheDelayWithinTheJitter);
+  RUN_TEST(test_shouldTryWpsEveryGivenAttempts);
+  RUN_TEST(test_shouldMeasureTheTimeToRecover);
+  UNITY_END();
+}